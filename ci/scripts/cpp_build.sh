@@ -95,6 +95,7 @@ cmake -G "${CMAKE_GENERATOR:-Ninja}" \
       -DARROW_WITH_BROTLI=${ARROW_WITH_BROTLI:-OFF} \
       -DARROW_WITH_BZ2=${ARROW_WITH_BZ2:-OFF} \
       -DARROW_WITH_LZ4=${ARROW_WITH_LZ4:-OFF} \
+      -DARROW_WITH_RE2=${ARROW_WITH_RE2:-OFF} \
       -DARROW_WITH_SNAPPY=${ARROW_WITH_SNAPPY:-OFF} \
       -DARROW_WITH_ZLIB=${ARROW_WITH_ZLIB:-OFF} \
       -DARROW_WITH_ZSTD=${ARROW_WITH_ZSTD:-OFF} \
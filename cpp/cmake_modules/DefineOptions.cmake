@@ -284,6 +284,9 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
   define_option(ARROW_WITH_ZLIB "Build with zlib compression" OFF)
   define_option(ARROW_WITH_ZSTD "Build with zstd compression" OFF)
 
+  define_option(ARROW_WITH_RE2
+                "Build with support for regular expressions using the re2 library" OFF)
+
   #----------------------------------------------------------------------
   if(MSVC)
     set_option_category("MSVC")
@@ -1803,7 +1803,7 @@ if(ARROW_WITH_ZSTD)
 endif()
 
 # ----------------------------------------------------------------------
-# RE2 (required for Gandiva)
+# RE2 (required for Gandiva and for regular expressions in arrow/compute)
 
 macro(build_re2)
   message(STATUS "Building re2 from source")
@@ -1830,7 +1830,7 @@ macro(build_re2)
   add_dependencies(RE2::re2 re2_ep)
 endmacro()
 
-if(ARROW_GANDIVA)
+if(ARROW_WITH_RE2 OR ARROW_GANDIVA)
   resolve_dependency(RE2)
 
   # TODO: Don't use global includes but rather target_include_directories
@@ -20,6 +20,9 @@
 #include "arrow/compute/context.h"  // IWYU pragma: export
 #include "arrow/compute/kernel.h"   // IWYU pragma: export
 
+#include "arrow/compute/kernels/approx_distinct.h"  // IWYU pragma: export
+#include "arrow/compute/kernels/approx_quantile.h"  // IWYU pragma: export
+#include "arrow/compute/kernels/arithmetic.h"       // IWYU pragma: export
 #include "arrow/compute/kernels/boolean.h"          // IWYU pragma: export
 #include "arrow/compute/kernels/cast.h"             // IWYU pragma: export
 #include "arrow/compute/kernels/compare.h"          // IWYU pragma: export
@@ -29,6 +32,9 @@
 #include "arrow/compute/kernels/isin.h"             // IWYU pragma: export
 #include "arrow/compute/kernels/mean.h"             // IWYU pragma: export
 #include "arrow/compute/kernels/nth_to_indices.h"   // IWYU pragma: export
+#include "arrow/compute/kernels/partition.h"        // IWYU pragma: export
+#include "arrow/compute/kernels/row_hash.h"         // IWYU pragma: export
 #include "arrow/compute/kernels/sort_to_indices.h"  // IWYU pragma: export
+#include "arrow/compute/kernels/string.h"           // IWYU pragma: export
 #include "arrow/compute/kernels/sum.h"              // IWYU pragma: export
 #include "arrow/compute/kernels/take.h"             // IWYU pragma: export
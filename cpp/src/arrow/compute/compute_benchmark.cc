@@ -26,6 +26,7 @@
 #include "arrow/testing/util.h"
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/arithmetic.h"
 #include "arrow/compute/kernels/hash.h"
 
 namespace arrow {
@@ -219,5 +220,112 @@ BENCHMARK(UniqueUInt8WithNulls)
     ->Args({kHashBenchmarkLength, 200})
     ->Unit(benchmark::kMicrosecond);
 
+// Arithmetic kernels, on the data shape of the gandiva micro-benchmarks
+// (gandiva/tests/micro_benchmarks.cc) so that the two can be compared: 1M
+// int64 values per iteration, in batches of 16K cycling over 16 batches.  The
+// argument is the percentage of nulls, gandiva's inputs have none.
+
+constexpr int64_t kArithmeticBatchSize = 16 * 1024;
+constexpr int64_t kArithmeticNumRecords = 1024 * 1024;
+constexpr int kArithmeticNumBatches = 16;
+
+using BinaryArithmeticFunction = Status (*)(FunctionContext*, const Datum&,
+                                            const Datum&, ArithmeticOptions, Datum*);
+using UnaryArithmeticFunction = Status (*)(FunctionContext*, const Datum&,
+                                           ArithmeticOptions, Datum*);
+
+static std::vector<std::shared_ptr<Array>> ArithmeticBatches(int64_t min, int64_t max,
+                                                             double null_probability,
+                                                             random::SeedType seed) {
+  random::RandomArrayGenerator rand(seed);
+  std::vector<std::shared_ptr<Array>> batches;
+  for (int i = 0; i < kArithmeticNumBatches; ++i) {
+    batches.push_back(rand.Int64(kArithmeticBatchSize, min, max, null_probability));
+  }
+  return batches;
+}
+
+static void BenchBinaryArithmetic(benchmark::State& state,
+                                  BinaryArithmeticFunction function,
+                                  bool check_overflow = false,
+                                  bool scalar_right = false) {
+  const double null_probability = static_cast<double>(state.range(0)) / 100;
+  // Keep the values small enough to not overflow and the divisors non-zero
+  auto left = ArithmeticBatches(-1000, 1000, null_probability, 0x5eed);
+  auto right = ArithmeticBatches(1, 1000, null_probability, 0x5eee);
+  const Datum scalar(std::make_shared<Int64Scalar>(7));
+  ArithmeticOptions options;
+  options.check_overflow = check_overflow;
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kArithmeticNumRecords / kArithmeticBatchSize; ++i) {
+      const int batch = static_cast<int>(i % kArithmeticNumBatches);
+      Datum out;
+      ABORT_NOT_OK(function(&ctx, left[batch], scalar_right ? scalar : right[batch],
+                            options, &out));
+      benchmark::DoNotOptimize(out);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kArithmeticNumRecords);
+}
+
+static void BenchUnaryArithmetic(benchmark::State& state,
+                                 UnaryArithmeticFunction function,
+                                 bool check_overflow = false) {
+  const double null_probability = static_cast<double>(state.range(0)) / 100;
+  auto values = ArithmeticBatches(-1000, 1000, null_probability, 0x5eed);
+  ArithmeticOptions options;
+  options.check_overflow = check_overflow;
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kArithmeticNumRecords / kArithmeticBatchSize; ++i) {
+      Datum out;
+      ABORT_NOT_OK(function(&ctx, values[i % kArithmeticNumBatches], options, &out));
+      benchmark::DoNotOptimize(out);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kArithmeticNumRecords);
+}
+
+static void SubtractInt64(benchmark::State& state) {
+  BenchBinaryArithmetic(state, &Subtract);
+}
+
+static void SubtractInt64Checked(benchmark::State& state) {
+  BenchBinaryArithmetic(state, &Subtract, /*check_overflow=*/true);
+}
+
+static void SubtractInt64Scalar(benchmark::State& state) {
+  BenchBinaryArithmetic(state, &Subtract, /*check_overflow=*/false,
+                        /*scalar_right=*/true);
+}
+
+static void MultiplyInt64(benchmark::State& state) {
+  BenchBinaryArithmetic(state, &Multiply);
+}
+
+static void MultiplyInt64Checked(benchmark::State& state) {
+  BenchBinaryArithmetic(state, &Multiply, /*check_overflow=*/true);
+}
+
+static void DivideInt64(benchmark::State& state) {
+  BenchBinaryArithmetic(state, &Divide);
+}
+
+static void NegateInt64(benchmark::State& state) { BenchUnaryArithmetic(state, &Negate); }
+
+static void AbsInt64(benchmark::State& state) { BenchUnaryArithmetic(state, &Abs); }
+
+BENCHMARK(SubtractInt64)->Arg(0)->Arg(10);
+BENCHMARK(SubtractInt64Checked)->Arg(0)->Arg(10);
+BENCHMARK(SubtractInt64Scalar)->Arg(0)->Arg(10);
+BENCHMARK(MultiplyInt64)->Arg(0)->Arg(10);
+BENCHMARK(MultiplyInt64Checked)->Arg(0)->Arg(10);
+BENCHMARK(DivideInt64)->Arg(0)->Arg(10);
+BENCHMARK(NegateInt64)->Arg(0)->Arg(10);
+BENCHMARK(AbsInt64)->Arg(0)->Arg(10);
+
 }  // namespace compute
 }  // namespace arrow
@@ -69,10 +69,23 @@ class ARROW_EXPORT FunctionContext {
 
   internal::CpuInfo* cpu_info() const { return cpu_info_; }
 
+  /// \brief Whether functions may spread their work over the CPU thread pool
+  ///
+  /// When enabled, functions taking a ChunkedArray or Table (e.g. Cast,
+  /// Filter, Take and the aggregates) process the chunks or columns, or
+  /// morsels of large chunks, as separate tasks on the CPU thread pool and
+  /// reassemble the results in order.  Functions invoked from within such a
+  /// task don't use threads themselves.  Disabled by default.
+  bool use_threads() const { return use_threads_; }
+
+  /// \brief Enable or disable multithreaded execution, see use_threads()
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
  private:
   Status status_;
   MemoryPool* pool_;
   internal::CpuInfo* cpu_info_;
+  bool use_threads_;
 };
 
 }  // namespace compute
@@ -16,8 +16,8 @@
 // under the License.
 
 #include "arrow/compute/kernels/add.h"
-#include "arrow/builder.h"
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/arithmetic.h"
 #include "arrow/type_traits.h"
 
 namespace arrow {
@@ -31,16 +31,11 @@ class AddKernelImpl : public AddKernel {
 
   Status Add(FunctionContext* ctx, const std::shared_ptr<ArrayType>& lhs,
              const std::shared_ptr<ArrayType>& rhs, std::shared_ptr<Array>* result) {
-    NumericBuilder<ArrowType> builder;
-    RETURN_NOT_OK(builder.Reserve(lhs->length()));
-    for (int i = 0; i < lhs->length(); i++) {
-      if (lhs->IsNull(i) || rhs->IsNull(i)) {
-        builder.UnsafeAppendNull();
-      } else {
-        builder.UnsafeAppend(lhs->Value(i) + rhs->Value(i));
-      }
-    }
-    return builder.Finish(result);
+    Datum out;
+    RETURN_NOT_OK(compute::Add(ctx, Datum(lhs->data()), Datum(rhs->data()),
+                               ArithmeticOptions(), &out));
+    *result = out.make_array();
+    return Status::OK();
   }
 
  public:
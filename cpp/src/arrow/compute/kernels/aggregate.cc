@@ -16,9 +16,12 @@
 // under the License.
 
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
 
 namespace arrow {
 namespace compute {
@@ -58,22 +61,30 @@ Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datu
     return Status::OutOfMemory("AggregateState allocation failed");
   }
 
+  // Consume each chunk (or morsel, see detail::SplitMorsels) into its own state,
+  // possibly in parallel, then merge the states in order
+  std::vector<std::shared_ptr<Array>> morsels;
   if (input.is_array()) {
-    auto array = input.make_array();
-    RETURN_NOT_OK(aggregate_function_->Consume(*array, state->mutable_data()));
+    morsels.push_back(input.make_array());
   } else {
-    auto chunked_array = input.chunked_array();
-    for (int i = 0; i < chunked_array->num_chunks(); i++) {
-      auto tmp_state =
-          ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
-      if (!tmp_state) {
-        return Status::OutOfMemory("AggregateState allocation failed");
-      }
-      RETURN_NOT_OK(aggregate_function_->Consume(*chunked_array->chunk(i),
-                                                 tmp_state->mutable_data()));
-      RETURN_NOT_OK(
-          aggregate_function_->Merge(tmp_state->mutable_data(), state->mutable_data()));
-    }
+    morsels = input.chunked_array()->chunks();
+  }
+  morsels = detail::SplitMorsels(*ctx, morsels);
+
+  std::vector<std::shared_ptr<ManagedAggregateState>> morsel_states(morsels.size());
+  RETURN_NOT_OK(detail::ParallelForTasks(
+      ctx, static_cast<int>(morsels.size()), [&](FunctionContext* task_ctx, int i) {
+        morsel_states[i] =
+            ManagedAggregateState::Make(aggregate_function_, task_ctx->memory_pool());
+        if (!morsel_states[i]) {
+          return Status::OutOfMemory("AggregateState allocation failed");
+        }
+        return aggregate_function_->Consume(*morsels[i],
+                                            morsel_states[i]->mutable_data());
+      }));
+  for (const auto& morsel_state : morsel_states) {
+    RETURN_NOT_OK(
+        aggregate_function_->Merge(morsel_state->mutable_data(), state->mutable_data()));
   }
 
   return aggregate_function_->Finalize(state->mutable_data(), out);
@@ -23,8 +23,11 @@
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/memory_pool.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/bit_util.h"
@@ -328,5 +331,85 @@ static void SumKernel(benchmark::State& state) {
 
 BENCHMARK(SumKernel)->Apply(RegressionSetArgs);
 
+// Run a Sum, Mean or MinMax kernel over random values of the given type,
+// across the null densities of RegressionSetArgs
+template <typename ArrowType, typename Op>
+static void AggregateKernelBench(benchmark::State& state, Op&& op) {
+  using CType = typename ArrowType::c_type;
+
+  RegressionArgs args(state);
+  const int64_t array_size = args.size / sizeof(CType);
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Numeric<ArrowType>(array_size, -100, 100, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(op(&ctx, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+template <typename ArrowType>
+static void SumKernelNumeric(benchmark::State& state) {
+  AggregateKernelBench<ArrowType>(
+      state, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+        return Sum(ctx, value, out);
+      });
+}
+
+template <typename ArrowType>
+static void MeanKernelNumeric(benchmark::State& state) {
+  AggregateKernelBench<ArrowType>(
+      state, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+        return Mean(ctx, value, out);
+      });
+}
+
+template <typename ArrowType>
+static void MinMaxKernelNumeric(benchmark::State& state) {
+  AggregateKernelBench<ArrowType>(
+      state, [](FunctionContext* ctx, const Datum& value, Datum* out) {
+        return MinMax(ctx, MinMaxOptions(), value, out);
+      });
+}
+
+BENCHMARK_TEMPLATE(SumKernelNumeric, Int32Type)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(SumKernelNumeric, FloatType)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(SumKernelNumeric, DoubleType)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(MeanKernelNumeric, Int64Type)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(MeanKernelNumeric, DoubleType)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(MinMaxKernelNumeric, Int32Type)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(MinMaxKernelNumeric, Int64Type)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(MinMaxKernelNumeric, DoubleType)->Apply(RegressionSetArgs);
+
+// Sum over a ChunkedArray, with the chunks dispatched to the CPU thread pool
+static void SumKernelThreaded(benchmark::State& state) {
+  const int64_t array_size = state.range(0) / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Int64(array_size, -100, 100, null_percent);
+  ArrayVector chunks;
+  const int64_t chunk_size = BitUtil::CeilDiv(array_size, 64);
+  for (int64_t offset = 0; offset < array_size; offset += chunk_size) {
+    chunks.push_back(array->Slice(offset, chunk_size));
+  }
+  auto chunked_array = std::make_shared<ChunkedArray>(chunks);
+
+  FunctionContext ctx;
+  ctx.set_use_threads(true);
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Sum(&ctx, Datum(chunked_array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+}
+
+BENCHMARK(SumKernelThreaded)->Apply(RegressionSetArgs)->UseRealTime();
+
 }  // namespace compute
 }  // namespace arrow
@@ -16,19 +16,32 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <numeric>
+#include <random>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/approx_distinct.h"
+#include "arrow/compute/kernels/approx_quantile.h"
 #include "arrow/compute/kernels/count.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/hash.h"
 #include "arrow/compute/kernels/mean.h"
 #include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -40,6 +53,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace compute {
@@ -196,18 +210,100 @@ TYPED_TEST(TestRandomNumericSumKernel, RandomSliceArraySum) {
     ValidateSum<TypeParam>(&this->ctx_, *slice);
   }
 
-  // Trigger ConsumeSparse with different slice offsets.
+  // Validity blocks and tails at different slice offsets
   auto rand = random::RandomArrayGenerator(0xfa432643);
-  const int64_t length = 1U << 5;
+  const int64_t length = 1U << 8;
   auto array = rand.Numeric<TypeParam>(length, 0, 10, 0.5);
-  for (size_t i = 1; i < 16; i++) {
-    for (size_t j = 1; j < 16; j++) {
-      auto slice = array->Slice(i, length - j);
+  for (size_t i = 1; i < 72; i += 3) {
+    for (size_t j = 1; j < 72; j += 5) {
+      auto slice = array->Slice(i, length - i - j);
       ValidateSum<TypeParam>(&this->ctx_, *slice);
     }
   }
 }
 
+TYPED_TEST(TestNumericSumKernel, SelectionSum) {
+  using SumType = typename FindAccumulatorType<TypeParam>::Type;
+  using ScalarType = typename TypeTraits<SumType>::ScalarType;
+
+  auto array = ArrayFromJSON(TypeTraits<TypeParam>::type_singleton(),
+                             "[1, null, 3, 4, 5, null, 7]");
+  auto selection = ArrayFromJSON(int64(), "[6, null, 1, 0, 3, 0]");
+  Datum result;
+  ASSERT_OK(Sum(&this->ctx_, *array, *selection, &result));
+  DatumEqual<SumType>::EnsureEqual(result, Datum(std::make_shared<ScalarType>(13)));
+
+  ASSERT_OK(Sum(&this->ctx_, *array, *ArrayFromJSON(int64(), "[1, null]"), &result));
+  DatumEqual<SumType>::EnsureEqual(result, Datum(std::make_shared<ScalarType>()));
+
+  ASSERT_RAISES(IndexError,
+                Sum(&this->ctx_, *array, *ArrayFromJSON(int64(), "[7]"), &result));
+  ASSERT_RAISES(IndexError,
+                Sum(&this->ctx_, *array, *ArrayFromJSON(int64(), "[-1]"), &result));
+  ASSERT_RAISES(TypeError,
+                Sum(&this->ctx_, *array, *ArrayFromJSON(int32(), "[0]"), &result));
+}
+
+TYPED_TEST(TestRandomNumericSumKernel, RandomSelectionSum) {
+  auto rand = random::RandomArrayGenerator(0x2a5b37e);
+  const int64_t length = 10000;
+  auto array = rand.Numeric<TypeParam>(length + 3, 0, 100, 0.1)->Slice(3);
+  for (auto filter_null_probability : {0.0, 0.1}) {
+    auto filter = rand.Boolean(length, 0.75, filter_null_probability);
+    std::shared_ptr<Array> selection, taken;
+    ASSERT_OK(GetSelectionVector(&this->ctx_, *filter, &selection));
+    ASSERT_OK(Take(&this->ctx_, *array, *selection, TakeOptions(), &taken));
+
+    // Summing the selected values is summing the taken values
+    Datum result, expected;
+    ASSERT_OK(Sum(&this->ctx_, *array, *selection, &result));
+    ASSERT_OK(Sum(&this->ctx_, *taken, &expected));
+    ASSERT_TRUE(result.scalar()->Equals(*expected.scalar()));
+  }
+}
+
+TEST(TestSumKernelPrecision, PairwiseSum) {
+  // A running sum of 0.1 accumulates a relative error of about 1e-10 after
+  // 2^20 additions, pairwise summation is much more accurate
+  const int64_t length = 1 << 20;
+  DoubleBuilder builder;
+  ASSERT_OK(builder.Reserve(length));
+  for (int64_t i = 0; i < length; i++) {
+    if (i % 7 == 0) {
+      builder.UnsafeAppendNull();
+    } else {
+      builder.UnsafeAppend(0.1);
+    }
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+  const double expected = 0.1 * static_cast<double>(length - array->null_count());
+
+  FunctionContext ctx;
+  Datum result;
+  ASSERT_OK(Sum(&ctx, *array, &result));
+  ASSERT_NEAR(checked_cast<const DoubleScalar&>(*result.scalar()).value, expected,
+              expected * 1e-14);
+  ASSERT_OK(Mean(&ctx, *array, &result));
+  ASSERT_NEAR(checked_cast<const DoubleScalar&>(*result.scalar()).value, 0.1, 1e-15);
+}
+
+TYPED_TEST(TestRandomNumericSumKernel, ThreadedSum) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  const int64_t length = 1 << 20;
+  auto array = rand.Numeric<TypeParam>(length, 0, 100, 0.1);
+  auto expected = NaiveSum<TypeParam>(*array);
+
+  // Large arrays and chunks are split into morsels
+  this->ctx_.set_use_threads(true);
+  ValidateSum<TypeParam>(&this->ctx_, *array, expected);
+  ArrayVector chunks;
+  for (int64_t offset = 0; offset < length; offset += length / 4) {
+    chunks.push_back(array->Slice(offset, length / 4));
+  }
+  ValidateSum<TypeParam>(&this->ctx_, std::make_shared<ChunkedArray>(chunks), expected);
+}
+
 ///
 /// Mean
 ///
@@ -396,6 +492,38 @@ TYPED_TEST(TestNumericMinMaxKernel, Basics) {
   this->AssertMinMaxIs("[5, null, 2, 3, 4]", 2, 5, options);
 }
 
+TYPED_TEST(TestNumericMinMaxKernel, RandomSlices) {
+  using c_type = typename TypeParam::c_type;
+  auto rand = random::RandomArrayGenerator(0x2e4f57);
+  for (auto null_probability : {0.0, 0.1, 0.9}) {
+    const int64_t length = 300;
+    auto array = rand.Numeric<TypeParam>(length, std::numeric_limits<c_type>::min(),
+                                         std::numeric_limits<c_type>::max(),
+                                         null_probability);
+    for (int64_t offset : {0, 1, 7, 64, 65}) {
+      for (int64_t slice_length : {0, 1, 63, 64, 130, 200}) {
+        auto slice = checked_pointer_cast<NumericArray<TypeParam>>(
+            array->Slice(offset, slice_length));
+        c_type expected_min = std::numeric_limits<c_type>::max();
+        c_type expected_max = std::numeric_limits<c_type>::min();
+        for (int64_t i = 0; i < slice->length(); i++) {
+          if (slice->IsValid(i)) {
+            expected_min = std::min(expected_min, slice->Value(i));
+            expected_max = std::max(expected_max, slice->Value(i));
+          }
+        }
+        Datum out;
+        ASSERT_OK(MinMax(&this->ctx_, MinMaxOptions(), *slice, &out));
+        auto col = out.collection();
+        ASSERT_EQ(checked_cast<const NumericScalar<TypeParam>&>(*col[0].scalar()).value,
+                  expected_min);
+        ASSERT_EQ(checked_cast<const NumericScalar<TypeParam>&>(*col[1].scalar()).value,
+                  expected_max);
+      }
+    }
+  }
+}
+
 TYPED_TEST_SUITE(TestFloatingMinMaxKernel, RealArrowTypes);
 TYPED_TEST(TestFloatingMinMaxKernel, Floats) {
   MinMaxOptions options;
@@ -404,6 +532,299 @@ TYPED_TEST(TestFloatingMinMaxKernel, Floats) {
   this->AssertMinMaxIs("[5, Inf, 2, 3, 4]", 2.0, INFINITY, options);
   this->AssertMinMaxIs("[5, NaN, 2, 3, 4]", 2, 5, options);
   this->AssertMinMaxIs("[5, -Inf, 2, 3, 4]", -INFINITY, 5, options);
+
+  // NaNs and nulls in full validity blocks
+  std::string values = "[NaN";
+  for (int i = 1; i < 150; i++) {
+    values += i % 3 == 0 ? ", null" : i % 5 == 0 ? ", NaN" : ", " + std::to_string(i);
+  }
+  values += "]";
+  this->AssertMinMaxIs(values, 1, 149, options);
+}
+
+///
+/// Approximate distinct count
+///
+
+class TestApproxDistinctKernel : public ComputeFixture, public TestBase {
+ public:
+  int64_t Estimate(const Datum& values, int precision = 12) {
+    Datum out;
+    ABORT_NOT_OK(ApproxDistinct(&ctx_, ApproxDistinctOptions(precision), values, &out));
+    EXPECT_TRUE(out.is_scalar());
+    return checked_cast<const Int64Scalar&>(*out.scalar()).value;
+  }
+
+  std::shared_ptr<Array> Sketches(const std::vector<Datum>& parts, int precision = 12) {
+    BinaryBuilder builder;
+    for (const auto& part : parts) {
+      Datum out;
+      ABORT_NOT_OK(ApproxDistinct(&ctx_, ApproxDistinctOptions(precision, false, true),
+                                  part, &out));
+      EXPECT_TRUE(out.type()->Equals(binary()));
+      ABORT_NOT_OK(builder.Append(
+          checked_cast<const BinaryScalar&>(*out.scalar()).value->ToString()));
+    }
+    ABORT_NOT_OK(builder.AppendNull());
+    std::shared_ptr<Array> sketches;
+    ABORT_NOT_OK(builder.Finish(&sketches));
+    return sketches;
+  }
+
+  // Assert that the estimate is within the given relative error of the
+  // exact number of distinct values
+  void AssertEstimateNear(int64_t expected, int64_t actual, double error) {
+    ASSERT_LE(std::abs(static_cast<double>(actual - expected)), error * expected)
+        << "expected about " << expected << ", got " << actual;
+  }
+};
+
+TEST_F(TestApproxDistinctKernel, Basics) {
+  EXPECT_EQ(Estimate(ArrayFromJSON(int32(), "[]")), 0);
+  EXPECT_EQ(Estimate(ArrayFromJSON(int32(), "[null, null]")), 0);
+  EXPECT_EQ(Estimate(ArrayFromJSON(int32(), "[1, 2, null, 1, 3, 2, null]")), 3);
+  EXPECT_EQ(Estimate(ArrayFromJSON(float64(), "[0.0, -0.0, NaN, NaN, 1.5]")), 3);
+  EXPECT_EQ(Estimate(ArrayFromJSON(utf8(), R"(["a", "b", "a", null, ""])")), 3);
+  EXPECT_EQ(Estimate(DictArrayFromJSON(dictionary(int8(), utf8()), "[0, 1, 2, 0, null]",
+                                       R"(["a", "b", "a"])")),
+            2);
+  EXPECT_EQ(Estimate(ArrayFromJSON(boolean(), "[true, false, true]"), 4), 2);
+}
+
+TEST_F(TestApproxDistinctKernel, Accuracy) {
+  const int64_t length = 100000;
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  for (int precision : {8, 12, 14}) {
+    SCOPED_TRACE(precision);
+    // Allow about four standard errors
+    const double error = 4 * 1.04 / std::sqrt(static_cast<double>(1 << precision));
+    for (int64_t distinct : {100, 1000, 10000, 100000}) {
+      auto ints = rand.Int64(length, 0, distinct - 1, /*null_probability=*/0.1);
+      std::shared_ptr<Array> counts;
+      ASSERT_OK(ValueCounts(&ctx_, ints, &counts));
+      const int64_t exact = counts->length() - 1;  // minus the null
+      AssertEstimateNear(exact, Estimate(ints, precision), error);
+    }
+    auto strings = rand.String(length, 5, 30, /*null_probability=*/0);
+    AssertEstimateNear(length, Estimate(strings, precision), error);
+  }
+}
+
+TEST_F(TestApproxDistinctKernel, ChunkedArray) {
+  auto rand = random::RandomArrayGenerator(0x7abe12);
+  auto values = rand.Int32(50000, 0, 20000, /*null_probability=*/0.2);
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      values->Slice(0, 10000), values->Slice(10000, 15000), values->Slice(25000)});
+  const int64_t expected = Estimate(values);
+  ASSERT_EQ(Estimate(chunked), expected);
+  ctx_.set_use_threads(true);
+  ASSERT_EQ(Estimate(chunked), expected);
+}
+
+TEST_F(TestApproxDistinctKernel, MergeSketches) {
+  auto rand = random::RandomArrayGenerator(0x1a2b3c);
+  auto values = rand.String(20000, 1, 10, /*null_probability=*/0.1);
+  auto sketches = Sketches({values->Slice(0, 5000), values->Slice(5000)}, 10);
+
+  Datum merged;
+  ASSERT_OK(ApproxDistinct(&ctx_, ApproxDistinctOptions(10, true), sketches, &merged));
+  ASSERT_EQ(checked_cast<const Int64Scalar&>(*merged.scalar()).value,
+            Estimate(values, 10));
+
+  // Sketches are closed under merging
+  ASSERT_OK(ApproxDistinct(&ctx_, ApproxDistinctOptions(10, true, true), sketches,
+                           &merged));
+  auto whole = checked_pointer_cast<BinaryArray>(Sketches({values}, 10));
+  ASSERT_EQ(checked_cast<const BinaryScalar&>(*merged.scalar()).value->ToString(),
+            whole->GetString(0));
+}
+
+TEST_F(TestApproxDistinctKernel, Errors) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+  Datum out;
+  ASSERT_RAISES(Invalid, ApproxDistinct(&ctx_, ApproxDistinctOptions(3), *values, &out));
+  ASSERT_RAISES(Invalid,
+                ApproxDistinct(&ctx_, ApproxDistinctOptions(19), *values, &out));
+  ASSERT_RAISES(TypeError, ApproxDistinct(&ctx_, ApproxDistinctOptions(12, true),
+                                          *values, &out));
+  ASSERT_EQ(MakeApproxDistinctAggregateFunction(*int32(), &ctx_,
+                                                ApproxDistinctOptions(12, true)),
+            nullptr);
+
+  // Sketches of another precision, or garbage
+  auto sketches = Sketches({values}, 10);
+  ASSERT_RAISES(Invalid, ApproxDistinct(&ctx_, ApproxDistinctOptions(12, true),
+                                        *sketches, &out));
+  auto garbage = ArrayFromJSON(binary(), R"(["", "xyz"])");
+  ASSERT_RAISES(Invalid, ApproxDistinct(&ctx_, ApproxDistinctOptions(12, true),
+                                        *garbage, &out));
+}
+
+///
+/// Approximate quantiles
+///
+
+class TestApproxQuantileKernel : public ComputeFixture, public TestBase {
+ public:
+  std::shared_ptr<Array> Quantiles(const Datum& values,
+                                   const ApproxQuantileOptions& options) {
+    Datum out;
+    ABORT_NOT_OK(ApproxQuantile(&ctx_, options, values, &out));
+    EXPECT_TRUE(out.is_array());
+    auto quantiles = out.make_array();
+    ABORT_NOT_OK(quantiles->ValidateFull());
+    EXPECT_TRUE(quantiles->type()->Equals(float64()));
+    EXPECT_EQ(quantiles->length(), static_cast<int64_t>(options.quantiles.size()));
+    return quantiles;
+  }
+
+  std::shared_ptr<Scalar> Sketch(const Datum& values, double compression = 100) {
+    Datum out;
+    ABORT_NOT_OK(ApproxQuantile(
+        &ctx_, ApproxQuantileOptions({0.5}, compression, false, true), values, &out));
+    EXPECT_TRUE(out.type()->Equals(binary()));
+    return out.scalar();
+  }
+
+  // The values 0 to length - 1, shuffled, with some nulls and NaNs
+  std::shared_ptr<Array> ShuffledRange(int64_t length) {
+    std::vector<double> values(length);
+    std::iota(values.begin(), values.end(), 0);
+    std::default_random_engine engine(0x3c4a);
+    std::shuffle(values.begin(), values.end(), engine);
+
+    DoubleBuilder builder;
+    ABORT_NOT_OK(builder.Reserve(length + length / 10));
+    for (int64_t i = 0; i < length; i++) {
+      builder.UnsafeAppend(values[i]);
+      if (i % 20 == 0) {
+        builder.UnsafeAppendNull();
+        builder.UnsafeAppend(NAN);
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+    return out;
+  }
+
+  // Assert that the estimates of the quantiles of ShuffledRange(length) have a
+  // rank error below the given fraction of the length
+  void AssertRangeQuantiles(const std::vector<double>& quantiles, int64_t length,
+                            const Array& estimates, double error) {
+    const auto& values = checked_cast<const DoubleArray&>(estimates);
+    for (size_t i = 0; i < quantiles.size(); i++) {
+      ASSERT_NEAR(values.Value(i), quantiles[i] * (length - 1), error * length)
+          << "at quantile " << quantiles[i];
+    }
+  }
+};
+
+TEST_F(TestApproxQuantileKernel, Basics) {
+  ApproxQuantileOptions options({0, 0.5, 1});
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[null, null, null]"),
+                    *Quantiles(ArrayFromJSON(int32(), "[]"), options));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[null, null, null]"),
+                    *Quantiles(ArrayFromJSON(float64(), "[null, NaN]"), options));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[5, 5, 5]"),
+                    *Quantiles(ArrayFromJSON(uint8(), "[null, 5]"), options));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[-3, 2, 9]"),
+                    *Quantiles(ArrayFromJSON(int64(), "[9, 2, null, -3, 1, 4]"),
+                               ApproxQuantileOptions({0, 0.5, 1})));
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[]"),
+                    *Quantiles(ArrayFromJSON(int64(), "[1, 2]"),
+                               ApproxQuantileOptions(std::vector<double>{})));
+}
+
+TEST_F(TestApproxQuantileKernel, Accuracy) {
+  const int64_t length = 100000;
+  auto values = ShuffledRange(length);
+  std::vector<double> quantiles = {0, 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1};
+  for (double compression : {50, 100, 200}) {
+    SCOPED_TRACE(compression);
+    auto estimates = Quantiles(values, ApproxQuantileOptions(quantiles, compression));
+    AssertRangeQuantiles(quantiles, length, *estimates, 1 / compression);
+    // The extremes are exact
+    const auto& doubles = checked_cast<const DoubleArray&>(*estimates);
+    ASSERT_EQ(doubles.Value(0), 0);
+    ASSERT_EQ(doubles.Value(quantiles.size() - 1), length - 1);
+  }
+}
+
+TEST_F(TestApproxQuantileKernel, ChunkedArray) {
+  const int64_t length = 50000;
+  auto values = ShuffledRange(length);
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      values->Slice(0, 100), values->Slice(100, 20000), values->Slice(20100)});
+  std::vector<double> quantiles = {0.01, 0.3, 0.5, 0.99};
+  ApproxQuantileOptions options(quantiles);
+  AssertRangeQuantiles(quantiles, length, *Quantiles(chunked, options), 0.01);
+  ctx_.set_use_threads(true);
+  AssertRangeQuantiles(quantiles, length, *Quantiles(chunked, options), 0.01);
+}
+
+TEST_F(TestApproxQuantileKernel, MergeSketches) {
+  const int64_t length = 30000;
+  auto values = ShuffledRange(length);
+  BinaryBuilder builder;
+  for (const auto& part :
+       {values->Slice(0, 10000), values->Slice(10000, 0), values->Slice(10000)}) {
+    ASSERT_OK(builder.Append(
+        checked_cast<const BinaryScalar&>(*Sketch(part)).value->ToString()));
+  }
+  ASSERT_OK(builder.AppendNull());
+  std::shared_ptr<Array> sketches;
+  ASSERT_OK(builder.Finish(&sketches));
+
+  std::vector<double> quantiles = {0, 0.05, 0.5, 0.95, 1};
+  AssertRangeQuantiles(
+      quantiles, length,
+      *Quantiles(sketches, ApproxQuantileOptions(quantiles, 100, true)), 0.01);
+
+  // Merged sketches can be merged again
+  Datum merged;
+  ASSERT_OK(ApproxQuantile(&ctx_, ApproxQuantileOptions({0.5}, 100, true, true),
+                           sketches, &merged));
+  std::shared_ptr<Array> remerged;
+  ASSERT_OK(MakeArrayFromScalar(*merged.scalar(), 1, &remerged));
+  AssertRangeQuantiles(
+      quantiles, length,
+      *Quantiles(remerged, ApproxQuantileOptions(quantiles, 100, true)), 0.01);
+}
+
+TEST_F(TestApproxQuantileKernel, Errors) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+  Datum out;
+  ASSERT_RAISES(Invalid,
+                ApproxQuantile(&ctx_, ApproxQuantileOptions({1.5}), *values, &out));
+  ASSERT_RAISES(Invalid,
+                ApproxQuantile(&ctx_, ApproxQuantileOptions({NAN}), *values, &out));
+  ASSERT_RAISES(Invalid,
+                ApproxQuantile(&ctx_, ApproxQuantileOptions({0.5}, 5), *values, &out));
+  ASSERT_RAISES(Invalid, ApproxQuantile(&ctx_, ApproxQuantileOptions(), *ArrayFromJSON(
+                                                   utf8(), R"(["a"])"), &out));
+  ASSERT_RAISES(Invalid,
+                ApproxQuantile(&ctx_, ApproxQuantileOptions({0.5}, 100, true), *values,
+                               &out));
+  auto garbage = ArrayFromJSON(binary(), R"(["", "xyz"])");
+  ASSERT_RAISES(Invalid, ApproxQuantile(&ctx_, ApproxQuantileOptions({0.5}, 100, true),
+                                        *garbage, &out));
+
+  // A centroid count whose size in bytes overflows to the actual size
+  std::string sketch =
+      checked_cast<const BinaryScalar&>(*Sketch(ArrayFromJSON(int32(), "[1]")))
+          .value->ToString();
+  const size_t count_offset = 1 + 2 * sizeof(double);
+  uint64_t num_centroids;
+  std::memcpy(&num_centroids, sketch.data() + count_offset, sizeof(num_centroids));
+  ASSERT_EQ(num_centroids, 1);
+  num_centroids += uint64_t(1) << 60;
+  std::memcpy(&sketch[count_offset], &num_centroids, sizeof(num_centroids));
+  BinaryBuilder builder;
+  ASSERT_OK(builder.Append(sketch));
+  std::shared_ptr<Array> malformed;
+  ASSERT_OK(builder.Finish(&malformed));
+  ASSERT_RAISES(Invalid, ApproxQuantile(&ctx_, ApproxQuantileOptions({0.5}, 100, true),
+                                        *malformed, &out));
 }
 
 }  // namespace compute
@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/approx_distinct.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/row_hash.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+constexpr int kMinPrecision = 4;
+constexpr int kMaxPrecision = 18;
+
+// Serialized sketches are a format version byte, a precision byte, then one
+// byte per register
+constexpr uint8_t kSketchVersion = 1;
+constexpr int64_t kSketchHeaderSize = 2;
+
+struct HyperLogLogState {
+  // Empty until values are added
+  std::vector<uint8_t> registers;
+
+  void Init(int precision) {
+    if (registers.empty()) {
+      registers.assign(static_cast<size_t>(1) << precision, 0);
+    }
+  }
+
+  // Add a value by its hash: the high bits select a register, which keeps the
+  // maximum position of the first set bit in the remaining bits
+  void Add(uint64_t hash, int precision) {
+    const uint64_t index = hash >> (64 - precision);
+    const uint64_t rest = hash << precision;
+    const int rank =
+        rest == 0 ? 64 - precision + 1 : BitUtil::CountLeadingZeros(rest) + 1;
+    registers[index] = std::max(registers[index], static_cast<uint8_t>(rank));
+  }
+
+  void Merge(const uint8_t* other_registers, int64_t num_registers) {
+    for (int64_t i = 0; i < num_registers; ++i) {
+      registers[i] = std::max(registers[i], other_registers[i]);
+    }
+  }
+
+  // The HyperLogLog estimate, with linear counting for small cardinalities
+  // (there is no large range correction with 64-bit hashes)
+  int64_t Estimate(int precision) const {
+    const double m = static_cast<double>(static_cast<int64_t>(1) << precision);
+    double sum = 0;
+    int64_t zeros = 0;
+    for (uint8_t reg : registers) {
+      sum += std::ldexp(1.0, -reg);
+      zeros += reg == 0;
+    }
+    double alpha;
+    switch (precision) {
+      case 4:
+        alpha = 0.673;
+        break;
+      case 5:
+        alpha = 0.697;
+        break;
+      case 6:
+        alpha = 0.709;
+        break;
+      default:
+        alpha = 0.7213 / (1 + 1.079 / m);
+    }
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zeros > 0) {
+      estimate = m * std::log(m / static_cast<double>(zeros));
+    }
+    return static_cast<int64_t>(std::llround(estimate));
+  }
+};
+
+class ApproxDistinctAggregateFunction final
+    : public AggregateFunctionStaticState<HyperLogLogState> {
+ public:
+  ApproxDistinctAggregateFunction(MemoryPool* pool, const ApproxDistinctOptions& options)
+      : pool_(pool), options_(options) {}
+
+  Status Consume(const Array& input, HyperLogLogState* state) const override {
+    state->Init(options_.precision);
+    if (input.null_count() == input.length()) {
+      return Status::OK();
+    }
+    return options_.sketch_input ? ConsumeSketches(input, state)
+                                 : ConsumeValues(input, state);
+  }
+
+  Status Merge(const HyperLogLogState& src, HyperLogLogState* dst) const override {
+    if (!src.registers.empty()) {
+      dst->Init(options_.precision);
+      dst->Merge(src.registers.data(), static_cast<int64_t>(src.registers.size()));
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(const HyperLogLogState& src, Datum* output) const override {
+    HyperLogLogState state = src;
+    state.Init(options_.precision);
+    if (!options_.sketch_output) {
+      std::shared_ptr<Scalar> estimate =
+          std::make_shared<Int64Scalar>(state.Estimate(options_.precision));
+      *output = estimate;
+      return Status::OK();
+    }
+
+    const auto num_registers = static_cast<int64_t>(state.registers.size());
+    std::shared_ptr<Buffer> sketch;
+    RETURN_NOT_OK(AllocateBuffer(pool_, kSketchHeaderSize + num_registers, &sketch));
+    uint8_t* data = sketch->mutable_data();
+    data[0] = kSketchVersion;
+    data[1] = static_cast<uint8_t>(options_.precision);
+    std::memcpy(data + kSketchHeaderSize, state.registers.data(), num_registers);
+    std::shared_ptr<Scalar> scalar = std::make_shared<BinaryScalar>(std::move(sketch));
+    *output = scalar;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return options_.sketch_output ? binary() : int64();
+  }
+
+ private:
+  Status ConsumeValues(const Array& input, HyperLogLogState* state) const {
+    // Hash the values like Hash() does, then skip the hashes of nulls
+    auto batch = RecordBatch::Make(schema({field("values", input.type())}),
+                                   input.length(), {MakeArray(input.data())});
+    FunctionContext hash_ctx(pool_);
+    std::shared_ptr<Array> hashes;
+    RETURN_NOT_OK(Hash(&hash_ctx, *batch, {0}, &hashes));
+
+    const uint64_t* values = checked_cast<const UInt64Array&>(*hashes).raw_values();
+    if (input.null_count() != 0) {
+      internal::BitmapReader reader(input.null_bitmap_data(), input.offset(),
+                                    input.length());
+      for (int64_t i = 0; i < input.length(); i++) {
+        if (reader.IsSet()) {
+          state->Add(values[i], options_.precision);
+        }
+        reader.Next();
+      }
+    } else {
+      for (int64_t i = 0; i < input.length(); i++) {
+        state->Add(values[i], options_.precision);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status ConsumeSketches(const Array& input, HyperLogLogState* state) const {
+    const auto& sketches = checked_cast<const BinaryArray&>(input);
+    const int64_t num_registers = static_cast<int64_t>(1) << options_.precision;
+    for (int64_t i = 0; i < sketches.length(); i++) {
+      if (sketches.IsNull(i)) {
+        continue;
+      }
+      int32_t length;
+      const uint8_t* data = sketches.GetValue(i, &length);
+      if (length < kSketchHeaderSize || data[0] != kSketchVersion) {
+        return Status::Invalid("Invalid HyperLogLog sketch");
+      }
+      if (data[1] != options_.precision ||
+          length != kSketchHeaderSize + num_registers) {
+        return Status::Invalid("Cannot merge a HyperLogLog sketch of precision ",
+                               static_cast<int>(data[1]), " with precision ",
+                               options_.precision);
+      }
+      state->Merge(data + kSketchHeaderSize, num_registers);
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ApproxDistinctOptions options_;
+};
+
+std::shared_ptr<AggregateFunction> MakeApproxDistinctAggregateFunction(
+    const DataType& type, FunctionContext* ctx, const ApproxDistinctOptions& options) {
+  if (options.precision < kMinPrecision || options.precision > kMaxPrecision ||
+      (options.sketch_input && type.id() != Type::BINARY)) {
+    return nullptr;
+  }
+  return std::make_shared<ApproxDistinctAggregateFunction>(ctx->memory_pool(), options);
+}
+
+Status ApproxDistinct(FunctionContext* ctx, const ApproxDistinctOptions& options,
+                      const Datum& value, Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr) {
+    return Status::Invalid("Datum must be array-like");
+  }
+  if (options.precision < kMinPrecision || options.precision > kMaxPrecision) {
+    return Status::Invalid("HyperLogLog precision must be between ", kMinPrecision,
+                           " and ", kMaxPrecision, ", got ", options.precision);
+  }
+  if (options.sketch_input && data_type->id() != Type::BINARY) {
+    return Status::TypeError("HyperLogLog sketches must be binary, got ", *data_type);
+  }
+
+  auto aggregate = MakeApproxDistinctAggregateFunction(*data_type, ctx, options);
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+  return kernel->Call(ctx, value, out);
+}
+
+Status ApproxDistinct(FunctionContext* ctx, const ApproxDistinctOptions& options,
+                      const Array& array, Datum* out) {
+  return ApproxDistinct(ctx, options, array.data(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class Status;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \class ApproxDistinctOptions
+///
+/// The user controls the accuracy of the ApproxDistinct kernel, and whether it
+/// consumes or produces serialized sketches, with this class.  Sketches allow
+/// partial aggregates computed separately (e.g. per batch, or on different
+/// machines) to be combined: aggregate each part with sketch_output, then
+/// aggregate a binary array of the sketches with sketch_input.
+struct ARROW_EXPORT ApproxDistinctOptions {
+  explicit ApproxDistinctOptions(int precision = 12, bool sketch_input = false,
+                                 bool sketch_output = false)
+      : precision(precision), sketch_input(sketch_input), sketch_output(sketch_output) {}
+
+  /// Log2 of the number of HyperLogLog registers, in [4, 18].  The relative
+  /// standard error of the estimate is about 1.04 / sqrt(2 ^ precision), i.e.
+  /// 1.6% for the default of 12, and a sketch takes 2 ^ precision bytes.
+  int precision;
+  /// Whether the input is a binary array of sketches to merge, rather than
+  /// values to count.  The sketches must have the given precision.
+  bool sketch_input;
+  /// Whether to output the serialized sketch as a binary scalar, rather than
+  /// the estimated number of distinct values as an int64 scalar.
+  bool sketch_output;
+};
+
+/// \brief Return an ApproxDistinct aggregate function, or nullptr if the options
+/// are invalid for the input type
+///
+/// \param[in] type the type of the values to count, or of the sketches
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxDistinctOptions for more information
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeApproxDistinctAggregateFunction(
+    const DataType& type, FunctionContext* ctx, const ApproxDistinctOptions& options);
+
+/// \brief Estimate the number of distinct non-null values with HyperLogLog
+///
+/// Values are hashed like with Hash(), so that e.g. 0.0 and -0.0 are the same
+/// value, and a dictionary array is counted like its decoded values.  Memory use
+/// is constant, and the chunks of a ChunkedArray are sketched in parallel if the
+/// FunctionContext allows it.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxDistinctOptions for more information
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[out] out the estimate as an Int64Scalar, or the sketch as a
+/// BinaryScalar
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxDistinct(FunctionContext* ctx, const ApproxDistinctOptions& options,
+                      const Datum& value, Datum* out);
+
+/// \brief Estimate the number of distinct non-null values with HyperLogLog
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxDistinctOptions for more information
+/// \param[in] array input array
+/// \param[out] out the estimate as an Int64Scalar, or the sketch as a
+/// BinaryScalar
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxDistinct(FunctionContext* ctx, const ApproxDistinctOptions& options,
+                      const Array& array, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
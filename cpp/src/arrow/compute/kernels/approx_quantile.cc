@@ -0,0 +1,365 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/approx_quantile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+constexpr double kMinCompression = 10;
+constexpr double kPi = 3.14159265358979323846;
+
+// Serialized sketches are a format version byte, the minimum and maximum values,
+// the number of centroids, then the mean and weight of each centroid
+constexpr uint8_t kSketchVersion = 1;
+constexpr int64_t kSketchHeaderSize = 1 + 3 * sizeof(double);
+constexpr int64_t kSketchCentroidSize = 2 * sizeof(double);
+
+struct Centroid {
+  double mean;
+  double weight;
+};
+
+// A merging t-digest (Dunning & Ertl, "Computing extremely accurate quantiles
+// using t-digests"): values are buffered, then merged with the centroids in one
+// sorted pass whenever the buffer is full.  The k1 scale function bounds the
+// weight of centroids, so that they are small in the tails.
+struct TDigestState {
+  std::vector<Centroid> centroids;
+  std::vector<double> buffer;
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+
+  static size_t BufferSize(double compression) {
+    return static_cast<size_t>(5 * compression);
+  }
+
+  void Add(double value, double compression) {
+    min = std::min(min, value);
+    max = std::max(max, value);
+    buffer.push_back(value);
+    if (buffer.size() >= BufferSize(compression)) {
+      Compress(compression);
+    }
+  }
+
+  void Merge(const TDigestState& other, double compression) {
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    buffer.insert(buffer.end(), other.buffer.begin(), other.buffer.end());
+    Compress(compression, other.centroids);
+  }
+
+  // The largest quantile a centroid starting at quantile q may extend to
+  static double QuantileLimit(double q, double compression) {
+    const double k = compression / (2 * kPi) * std::asin(2 * q - 1) + 1;
+    if (k >= compression / 4) {
+      return 1;
+    }
+    return (std::sin(k * 2 * kPi / compression) + 1) / 2;
+  }
+
+  void Compress(double compression, const std::vector<Centroid>& others = {}) {
+    std::vector<Centroid> all;
+    all.reserve(centroids.size() + others.size() + buffer.size());
+    all.insert(all.end(), centroids.begin(), centroids.end());
+    all.insert(all.end(), others.begin(), others.end());
+    for (double value : buffer) {
+      all.push_back({value, 1});
+    }
+    buffer.clear();
+    centroids.clear();
+    if (all.empty()) {
+      return;
+    }
+    std::sort(all.begin(), all.end(), [](const Centroid& left, const Centroid& right) {
+      return left.mean < right.mean;
+    });
+
+    double total_weight = 0;
+    for (const Centroid& centroid : all) {
+      total_weight += centroid.weight;
+    }
+    double weight_so_far = 0;
+    double weight_limit = QuantileLimit(0, compression) * total_weight;
+    Centroid current = all[0];
+    for (size_t i = 1; i < all.size(); ++i) {
+      const Centroid& next = all[i];
+      if (weight_so_far + current.weight + next.weight <= weight_limit) {
+        current.weight += next.weight;
+        current.mean += (next.mean - current.mean) * next.weight / current.weight;
+      } else {
+        centroids.push_back(current);
+        weight_so_far += current.weight;
+        weight_limit =
+            QuantileLimit(weight_so_far / total_weight, compression) * total_weight;
+        current = next;
+      }
+    }
+    centroids.push_back(current);
+  }
+
+  // Interpolate between the centers of the centroids, and between the extreme
+  // centroids and the minimum and maximum.  Must be compressed.
+  double Quantile(double q) const {
+    double total_weight = 0;
+    for (const Centroid& centroid : centroids) {
+      total_weight += centroid.weight;
+    }
+    const double target = q * total_weight;
+    const Centroid& first = centroids.front();
+    const Centroid& last = centroids.back();
+    if (target <= first.weight / 2) {
+      return min + (first.mean - min) * target / (first.weight / 2);
+    }
+    if (target >= total_weight - last.weight / 2) {
+      return max - (max - last.mean) * (total_weight - target) / (last.weight / 2);
+    }
+    double center = first.weight / 2;
+    for (size_t i = 0; i + 1 < centroids.size(); ++i) {
+      const double gap = (centroids[i].weight + centroids[i + 1].weight) / 2;
+      if (target < center + gap) {
+        return centroids[i].mean +
+               (centroids[i + 1].mean - centroids[i].mean) * (target - center) / gap;
+      }
+      center += gap;
+    }
+    return last.mean;
+  }
+};
+
+class ApproxQuantileAggregateFunction final
+    : public AggregateFunctionStaticState<TDigestState> {
+ public:
+  ApproxQuantileAggregateFunction(MemoryPool* pool, const ApproxQuantileOptions& options)
+      : pool_(pool), options_(options) {}
+
+  Status Consume(const Array& input, TDigestState* state) const override {
+    if (input.null_count() == input.length()) {
+      return Status::OK();
+    }
+    if (options_.sketch_input) {
+      return ConsumeSketches(input, state);
+    }
+    switch (input.type_id()) {
+      case Type::UINT8:
+        return ConsumeValues<UInt8Type>(input, state);
+      case Type::INT8:
+        return ConsumeValues<Int8Type>(input, state);
+      case Type::UINT16:
+        return ConsumeValues<UInt16Type>(input, state);
+      case Type::INT16:
+        return ConsumeValues<Int16Type>(input, state);
+      case Type::UINT32:
+        return ConsumeValues<UInt32Type>(input, state);
+      case Type::INT32:
+        return ConsumeValues<Int32Type>(input, state);
+      case Type::UINT64:
+        return ConsumeValues<UInt64Type>(input, state);
+      case Type::INT64:
+        return ConsumeValues<Int64Type>(input, state);
+      case Type::FLOAT:
+        return ConsumeValues<FloatType>(input, state);
+      case Type::DOUBLE:
+        return ConsumeValues<DoubleType>(input, state);
+      default:
+        return Status::NotImplemented("Quantiles of ", *input.type(),
+                                      " values are not implemented");
+    }
+  }
+
+  Status Merge(const TDigestState& src, TDigestState* dst) const override {
+    dst->Merge(src, options_.compression);
+    return Status::OK();
+  }
+
+  Status Finalize(const TDigestState& src, Datum* output) const override {
+    TDigestState state = src;
+    state.Compress(options_.compression);
+    if (options_.sketch_output) {
+      return Serialize(state, output);
+    }
+
+    DoubleBuilder builder(pool_);
+    RETURN_NOT_OK(builder.Reserve(options_.quantiles.size()));
+    for (double q : options_.quantiles) {
+      if (state.centroids.empty()) {
+        builder.UnsafeAppendNull();
+      } else {
+        builder.UnsafeAppend(state.Quantile(q));
+      }
+    }
+    std::shared_ptr<Array> quantiles;
+    RETURN_NOT_OK(builder.Finish(&quantiles));
+    *output = quantiles;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return options_.sketch_output ? binary() : float64();
+  }
+
+ private:
+  template <typename ArrowType>
+  Status ConsumeValues(const Array& input, TDigestState* state) const {
+    const auto values =
+        checked_cast<const typename TypeTraits<ArrowType>::ArrayType&>(input)
+            .raw_values();
+    auto add = [&](int64_t i) {
+      const auto value = static_cast<double>(values[i]);
+      if (!std::isnan(value)) {
+        state->Add(value, options_.compression);
+      }
+    };
+    if (input.null_count() != 0) {
+      internal::BitmapReader reader(input.null_bitmap_data(), input.offset(),
+                                    input.length());
+      for (int64_t i = 0; i < input.length(); i++) {
+        if (reader.IsSet()) {
+          add(i);
+        }
+        reader.Next();
+      }
+    } else {
+      for (int64_t i = 0; i < input.length(); i++) {
+        add(i);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status ConsumeSketches(const Array& input, TDigestState* state) const {
+    const auto& sketches = checked_cast<const BinaryArray&>(input);
+    for (int64_t i = 0; i < sketches.length(); i++) {
+      if (sketches.IsNull(i)) {
+        continue;
+      }
+      int32_t length;
+      const uint8_t* data = sketches.GetValue(i, &length);
+      TDigestState sketch;
+      uint64_t num_centroids = 0;
+      if (length >= kSketchHeaderSize && data[0] == kSketchVersion) {
+        std::memcpy(&sketch.min, data + 1, sizeof(double));
+        std::memcpy(&sketch.max, data + 1 + sizeof(double), sizeof(double));
+        std::memcpy(&num_centroids, data + 1 + 2 * sizeof(double), sizeof(uint64_t));
+      }
+      // Divide rather than multiply, as a crafted count could overflow
+      if (length < kSketchHeaderSize || data[0] != kSketchVersion ||
+          (length - kSketchHeaderSize) % kSketchCentroidSize != 0 ||
+          static_cast<uint64_t>(length - kSketchHeaderSize) / kSketchCentroidSize !=
+              num_centroids) {
+        return Status::Invalid("Invalid t-digest sketch");
+      }
+      sketch.centroids.resize(num_centroids);
+      std::memcpy(sketch.centroids.data(), data + kSketchHeaderSize,
+                  num_centroids * kSketchCentroidSize);
+      state->Merge(sketch, options_.compression);
+    }
+    return Status::OK();
+  }
+
+  Status Serialize(const TDigestState& state, Datum* output) const {
+    const uint64_t num_centroids = state.centroids.size();
+    std::shared_ptr<Buffer> sketch;
+    RETURN_NOT_OK(AllocateBuffer(
+        pool_, kSketchHeaderSize + num_centroids * kSketchCentroidSize, &sketch));
+    uint8_t* data = sketch->mutable_data();
+    data[0] = kSketchVersion;
+    std::memcpy(data + 1, &state.min, sizeof(double));
+    std::memcpy(data + 1 + sizeof(double), &state.max, sizeof(double));
+    std::memcpy(data + 1 + 2 * sizeof(double), &num_centroids, sizeof(uint64_t));
+    std::memcpy(data + kSketchHeaderSize, state.centroids.data(),
+                num_centroids * kSketchCentroidSize);
+    std::shared_ptr<Scalar> scalar = std::make_shared<BinaryScalar>(std::move(sketch));
+    *output = scalar;
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ApproxQuantileOptions options_;
+};
+
+static Status ValidateOptions(const ApproxQuantileOptions& options) {
+  for (double q : options.quantiles) {
+    if (!(q >= 0 && q <= 1)) {
+      return Status::Invalid("Quantile must be between 0 and 1, got ", q);
+    }
+  }
+  if (!(options.compression >= kMinCompression)) {
+    return Status::Invalid("t-digest compression must be at least ", kMinCompression,
+                           ", got ", options.compression);
+  }
+  return Status::OK();
+}
+
+std::shared_ptr<AggregateFunction> MakeApproxQuantileAggregateFunction(
+    const DataType& type, FunctionContext* ctx, const ApproxQuantileOptions& options) {
+  const bool valid_type = options.sketch_input
+                              ? type.id() == Type::BINARY
+                              : is_integer(type.id()) || is_floating(type.id());
+  if (!valid_type || type.id() == Type::HALF_FLOAT || !ValidateOptions(options).ok()) {
+    return nullptr;
+  }
+  return std::make_shared<ApproxQuantileAggregateFunction>(ctx->memory_pool(), options);
+}
+
+Status ApproxQuantile(FunctionContext* ctx, const ApproxQuantileOptions& options,
+                      const Datum& value, Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr) {
+    return Status::Invalid("Datum must be array-like");
+  }
+  RETURN_NOT_OK(ValidateOptions(options));
+  if (options.sketch_input && data_type->id() != Type::BINARY) {
+    return Status::TypeError("t-digest sketches must be binary, got ", *data_type);
+  }
+
+  auto aggregate = MakeApproxQuantileAggregateFunction(*data_type, ctx, options);
+  if (!aggregate) {
+    return Status::Invalid("Datum must contain a NumericType");
+  }
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+  return kernel->Call(ctx, value, out);
+}
+
+Status ApproxQuantile(FunctionContext* ctx, const ApproxQuantileOptions& options,
+                      const Array& array, Datum* out) {
+  return ApproxQuantile(ctx, options, array.data(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
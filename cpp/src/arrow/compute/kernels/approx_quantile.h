@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+class Status;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \class ApproxQuantileOptions
+///
+/// The user chooses the quantiles to estimate, the accuracy of the estimates, and
+/// whether the ApproxQuantile kernel consumes or produces serialized sketches
+/// with this class.  As with ApproxDistinctOptions, sketches allow partial
+/// aggregates computed separately to be combined.
+struct ARROW_EXPORT ApproxQuantileOptions {
+  explicit ApproxQuantileOptions(std::vector<double> quantiles = {0.5},
+                                 double compression = 100, bool sketch_input = false,
+                                 bool sketch_output = false)
+      : quantiles(std::move(quantiles)),
+        compression(compression),
+        sketch_input(sketch_input),
+        sketch_output(sketch_output) {}
+
+  /// The quantiles to estimate, in [0, 1]
+  std::vector<double> quantiles;
+  /// The t-digest compression, at least 10.  A sketch keeps at most about
+  /// compression / 2 centroids, and the error on the rank of an estimate is
+  /// about 1 / compression in the middle of the distribution, and much
+  /// smaller in the tails.
+  double compression;
+  /// Whether the input is a binary array of sketches to merge, rather than
+  /// numeric values.
+  bool sketch_input;
+  /// Whether to output the serialized sketch as a binary scalar, rather than
+  /// the estimated quantiles.
+  bool sketch_output;
+};
+
+/// \brief Return an ApproxQuantile aggregate function, or nullptr if the options
+/// are invalid for the input type
+///
+/// \param[in] type the type of the values, or of the sketches
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxQuantileOptions for more information
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeApproxQuantileAggregateFunction(
+    const DataType& type, FunctionContext* ctx, const ApproxQuantileOptions& options);
+
+/// \brief Estimate quantiles of numeric values with a t-digest
+///
+/// Nulls and NaNs are ignored.  Memory use is bounded by the compression, and
+/// the chunks of a ChunkedArray are sketched in parallel if the FunctionContext
+/// allows it.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxQuantileOptions for more information
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[out] out a DoubleArray of the estimate of each quantile (null if
+/// there are no values), or the sketch as a BinaryScalar
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxQuantile(FunctionContext* ctx, const ApproxQuantileOptions& options,
+                      const Datum& value, Datum* out);
+
+/// \brief Estimate quantiles of numeric values with a t-digest
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxQuantileOptions for more information
+/// \param[in] array input array
+/// \param[out] out a DoubleArray of the estimate of each quantile (null if
+/// there are no values), or the sketch as a BinaryScalar
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxQuantile(FunctionContext* ctx, const ApproxQuantileOptions& options,
+                      const Array& array, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,519 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+template <typename T, typename R = T>
+using enable_if_c_integer = enable_if_t<std::is_integral<T>::value, R>;
+
+template <typename T, typename R = T>
+using enable_if_signed_c_integer =
+    enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value, R>;
+
+template <typename T, typename R = T>
+using enable_if_unsigned_c_integer =
+    enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value, R>;
+
+template <typename T, typename R = T>
+using enable_if_c_floating_point = enable_if_t<std::is_floating_point<T>::value, R>;
+
+// Integer arithmetic is carried out on unsigned integers at least as wide as
+// int, on which overflow wraps around rather than being undefined
+template <typename T>
+using WrapType = typename std::make_unsigned<
+    typename std::common_type<T, unsigned int>::type>::type;
+
+template <typename T>
+T WrappingNegate(T value) {
+  return static_cast<T>(WrapType<T>(0) - static_cast<WrapType<T>>(value));
+}
+
+// Each operation defines Call(), which must be defined for any input including
+// the unspecified values of null slots, and Overflows(), which tells whether
+// an integer result wrapped around.  Both are kept branch-free where possible
+// so that the loops applying them are auto-vectorized.
+
+struct AddOp {
+  static constexpr bool kDivision = false;
+
+  template <typename T>
+  static enable_if_c_floating_point<T> Call(T left, T right) {
+    return left + right;
+  }
+
+  template <typename T>
+  static enable_if_c_integer<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrapType<T>>(left) +
+                          static_cast<WrapType<T>>(right));
+  }
+
+  template <typename T>
+  static enable_if_signed_c_integer<T, bool> Overflows(T left, T right, T result) {
+    // The result has a different sign than both operands
+    return ((left ^ result) & (right ^ result)) < 0;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_c_integer<T, bool> Overflows(T left, T right, T result) {
+    return result < left;
+  }
+};
+
+struct SubtractOp {
+  static constexpr bool kDivision = false;
+
+  template <typename T>
+  static enable_if_c_floating_point<T> Call(T left, T right) {
+    return left - right;
+  }
+
+  template <typename T>
+  static enable_if_c_integer<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrapType<T>>(left) -
+                          static_cast<WrapType<T>>(right));
+  }
+
+  template <typename T>
+  static enable_if_signed_c_integer<T, bool> Overflows(T left, T right, T result) {
+    // The operands have different signs and the result the sign of the right one
+    return ((left ^ right) & (left ^ result)) < 0;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_c_integer<T, bool> Overflows(T left, T right, T result) {
+    return left < right;
+  }
+};
+
+struct MultiplyOp {
+  static constexpr bool kDivision = false;
+
+  template <typename T>
+  static enable_if_c_floating_point<T> Call(T left, T right) {
+    return left * right;
+  }
+
+  template <typename T>
+  static enable_if_c_integer<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrapType<T>>(left) *
+                          static_cast<WrapType<T>>(right));
+  }
+
+  // Products of integers up to 32 bits wide are exact in 64 bits
+  template <typename T>
+  static enable_if_t<std::is_integral<T>::value && (sizeof(T) < 8), bool> Overflows(
+      T left, T right, T result) {
+    using Wide = typename std::conditional<std::is_signed<T>::value, int64_t,
+                                           uint64_t>::type;
+    return static_cast<Wide>(left) * static_cast<Wide>(right) !=
+           static_cast<Wide>(result);
+  }
+
+  static bool Overflows(int64_t left, int64_t right, int64_t result) {
+    if (right == -1) {
+      return left == std::numeric_limits<int64_t>::min();
+    }
+    return right != 0 && result / right != left;
+  }
+
+  static bool Overflows(uint64_t left, uint64_t right, uint64_t result) {
+    return left != 0 && result / left != right;
+  }
+};
+
+struct DivideOp {
+  static constexpr bool kDivision = true;
+
+  template <typename T>
+  static enable_if_c_floating_point<T> Call(T left, T right) {
+    return left / right;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_c_integer<T> Call(T left, T right) {
+    return right == 0 ? 0 : left / right;
+  }
+
+  template <typename T>
+  static enable_if_signed_c_integer<T> Call(T left, T right) {
+    if (right == 0) {
+      return 0;
+    }
+    // The smallest value divided by -1 wraps around like a negation
+    return right == -1 ? WrappingNegate(left) : static_cast<T>(left / right);
+  }
+
+  template <typename T>
+  static enable_if_signed_c_integer<T, bool> Overflows(T left, T right, T result) {
+    return right == -1 && left == std::numeric_limits<T>::min();
+  }
+
+  template <typename T>
+  static enable_if_unsigned_c_integer<T, bool> Overflows(T left, T right, T result) {
+    return false;
+  }
+};
+
+struct NegateOp {
+  template <typename T>
+  static enable_if_c_floating_point<T> Call(T value) {
+    return -value;
+  }
+
+  template <typename T>
+  static enable_if_c_integer<T> Call(T value) {
+    return WrappingNegate(value);
+  }
+
+  template <typename T>
+  static enable_if_signed_c_integer<T, bool> Overflows(T value) {
+    return value == std::numeric_limits<T>::min();
+  }
+
+  template <typename T>
+  static enable_if_unsigned_c_integer<T, bool> Overflows(T value) {
+    return value != 0;
+  }
+};
+
+struct AbsOp {
+  template <typename T>
+  static enable_if_c_floating_point<T> Call(T value) {
+    return value < 0 ? -value : value;
+  }
+
+  template <typename T>
+  static enable_if_signed_c_integer<T> Call(T value) {
+    return value < 0 ? WrappingNegate(value) : value;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_c_integer<T> Call(T value) {
+    return value;
+  }
+
+  template <typename T>
+  static enable_if_signed_c_integer<T, bool> Overflows(T value) {
+    return value == std::numeric_limits<T>::min();
+  }
+
+  template <typename T>
+  static enable_if_unsigned_c_integer<T, bool> Overflows(T value) {
+    return false;
+  }
+};
+
+template <typename T>
+struct ArrayValues {
+  T operator[](int64_t i) const { return values[i]; }
+  const T* values;
+};
+
+template <typename T>
+struct RepeatedValue {
+  T operator[](int64_t) const { return value; }
+  T value;
+};
+
+// Whether the predicate holds for any slot.  The loop doesn't exit early so
+// that it can be vectorized, assuming errors are rare.
+template <typename Predicate>
+bool AnySlot(int64_t length, Predicate&& predicate) {
+  bool result = false;
+  for (int64_t i = 0; i < length; ++i) {
+    result |= predicate(i);
+  }
+  return result;
+}
+
+// Whether the predicate holds for any non-null slot of out
+template <typename Predicate>
+bool AnyValidSlot(const ArrayData& out, Predicate&& predicate) {
+  if (out.GetNullCount() == 0) {
+    return AnySlot(out.length, std::forward<Predicate>(predicate));
+  }
+  internal::BitmapReader valid(out.buffers[0]->data(), out.offset, out.length);
+  for (int64_t i = 0; i < out.length; ++i) {
+    if (valid.IsSet() && predicate(i)) {
+      return true;
+    }
+    valid.Next();
+  }
+  return false;
+}
+
+template <typename Predicate>
+bool AnyError(const ArrayData& out, Predicate&& predicate) {
+  // Null slots only need to be excluded if the fast check found an error
+  return AnySlot(out.length, predicate) && AnyValidSlot(out, predicate);
+}
+
+template <typename ArrowType, typename Op>
+class BinaryArithmeticKernel final : public BinaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  explicit BinaryArithmeticKernel(ArithmeticOptions options) : options_(options) {}
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    ArrayData* result = out->array().get();
+    if (left.is_array() && right.is_array()) {
+      RETURN_NOT_OK(
+          detail::AssignNullIntersection(ctx, *left.array(), *right.array(), result));
+      return Apply(Values(*left.array()), Values(*right.array()), result);
+    }
+    if (left.is_array() && right.is_scalar()) {
+      RETURN_NOT_OK(AssignNulls(ctx, *left.array(), *right.scalar(), result));
+      return Apply(Values(*left.array()), Value(*right.scalar()), result);
+    }
+    if (left.is_scalar() && right.is_array()) {
+      RETURN_NOT_OK(AssignNulls(ctx, *right.array(), *left.scalar(), result));
+      return Apply(Value(*left.scalar()), Values(*right.array()), result);
+    }
+    return Status::Invalid("Invalid datum signature for arithmetic kernel");
+  }
+
+ private:
+  static ArrayValues<T> Values(const ArrayData& data) {
+    return ArrayValues<T>{data.GetValues<T>(1)};
+  }
+
+  static RepeatedValue<T> Value(const Scalar& scalar) {
+    return RepeatedValue<T>{checked_cast<const ScalarType&>(scalar).value};
+  }
+
+  static Status AssignNulls(FunctionContext* ctx, const ArrayData& array,
+                            const Scalar& scalar, ArrayData* out) {
+    return scalar.is_valid ? detail::PropagateNulls(ctx, array, out)
+                           : detail::SetAllNulls(ctx, array, out);
+  }
+
+  template <typename Left, typename Right>
+  Status Apply(Left left, Right right, ArrayData* out) {
+    T* out_values = out->GetMutableValues<T>(1);
+    for (int64_t i = 0; i < out->length; ++i) {
+      out_values[i] = Op::template Call<T>(left[i], right[i]);
+    }
+    return CheckErrors(left, right, out_values, *out);
+  }
+
+  template <typename Left, typename Right, typename U = T>
+  enable_if_c_floating_point<U, Status> CheckErrors(Left, Right, const T*,
+                                                    const ArrayData&) {
+    return Status::OK();
+  }
+
+  template <typename Left, typename Right, typename U = T>
+  enable_if_c_integer<U, Status> CheckErrors(Left left, Right right, const T* out_values,
+                                             const ArrayData& out) {
+    if (Op::kDivision && AnyError(out, [&](int64_t i) { return right[i] == 0; })) {
+      return Status::Invalid("Divide by zero");
+    }
+    if (options_.check_overflow && AnyError(out, [&](int64_t i) {
+          return Op::Overflows(left[i], right[i], out_values[i]);
+        })) {
+      return Status::Invalid("Integer overflow");
+    }
+    return Status::OK();
+  }
+
+  ArithmeticOptions options_;
+};
+
+template <typename ArrowType, typename Op>
+class UnaryArithmeticKernel final : public UnaryKernel {
+ public:
+  using T = typename ArrowType::c_type;
+
+  explicit UnaryArithmeticKernel(ArithmeticOptions options) : options_(options) {}
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    if (!input.is_array()) {
+      return Status::Invalid("Invalid datum signature for arithmetic kernel");
+    }
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, *input.array(), result));
+
+    const T* values = input.array()->GetValues<T>(1);
+    T* out_values = result->GetMutableValues<T>(1);
+    for (int64_t i = 0; i < result->length; ++i) {
+      out_values[i] = Op::template Call<T>(values[i]);
+    }
+    return CheckErrors(values, *result);
+  }
+
+ private:
+  template <typename U = T>
+  enable_if_c_floating_point<U, Status> CheckErrors(const T*, const ArrayData&) {
+    return Status::OK();
+  }
+
+  template <typename U = T>
+  enable_if_c_integer<U, Status> CheckErrors(const T* values, const ArrayData& out) {
+    if (options_.check_overflow &&
+        AnyError(out, [&](int64_t i) { return Op::Overflows(values[i]); })) {
+      return Status::Invalid("Integer overflow");
+    }
+    return Status::OK();
+  }
+
+  ArithmeticOptions options_;
+};
+
+#define ARITHMETIC_KERNEL_CASE(Kernel, ArrowType)  \
+  case ArrowType::type_id:                         \
+    out->reset(new Kernel<ArrowType, Op>(options)); \
+    break
+
+#define ARITHMETIC_KERNEL_CASES(Kernel)         \
+  ARITHMETIC_KERNEL_CASE(Kernel, UInt8Type);    \
+  ARITHMETIC_KERNEL_CASE(Kernel, Int8Type);     \
+  ARITHMETIC_KERNEL_CASE(Kernel, UInt16Type);   \
+  ARITHMETIC_KERNEL_CASE(Kernel, Int16Type);    \
+  ARITHMETIC_KERNEL_CASE(Kernel, UInt32Type);   \
+  ARITHMETIC_KERNEL_CASE(Kernel, Int32Type);    \
+  ARITHMETIC_KERNEL_CASE(Kernel, UInt64Type);   \
+  ARITHMETIC_KERNEL_CASE(Kernel, Int64Type);    \
+  ARITHMETIC_KERNEL_CASE(Kernel, FloatType);    \
+  ARITHMETIC_KERNEL_CASE(Kernel, DoubleType)
+
+template <typename Op>
+Status MakeBinaryKernel(const DataType& type, ArithmeticOptions options,
+                        std::unique_ptr<BinaryKernel>* out) {
+  switch (type.id()) {
+    ARITHMETIC_KERNEL_CASES(BinaryArithmeticKernel);
+    default:
+      return Status::NotImplemented("Arithmetic operations on ", type, " arrays");
+  }
+  return Status::OK();
+}
+
+template <typename Op>
+Status MakeUnaryKernel(const DataType& type, ArithmeticOptions options,
+                       std::unique_ptr<UnaryKernel>* out) {
+  switch (type.id()) {
+    ARITHMETIC_KERNEL_CASES(UnaryArithmeticKernel);
+    default:
+      return Status::NotImplemented("Arithmetic operations on ", type, " arrays");
+  }
+  return Status::OK();
+}
+
+#undef ARITHMETIC_KERNEL_CASES
+#undef ARITHMETIC_KERNEL_CASE
+
+template <typename Op>
+Status ExecBinary(FunctionContext* ctx, const Datum& left, const Datum& right,
+                  ArithmeticOptions options, Datum* out) {
+  if (!left.type()->Equals(right.type())) {
+    return Status::TypeError("Arithmetic operands must have the same type, got ",
+                             *left.type(), " and ", *right.type());
+  }
+  if (left.is_array() && right.is_array() && left.length() != right.length()) {
+    return Status::Invalid("Arithmetic operands must have the same length");
+  }
+  const Datum& array = left.is_array() ? left : right;
+  if (!array.is_array()) {
+    return Status::Invalid("Invalid datum signature for arithmetic kernel");
+  }
+
+  std::unique_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK(MakeBinaryKernel<Op>(*left.type(), options, &kernel));
+  out->value = ArrayData::Make(kernel->out_type(), array.length());
+  return detail::PrimitiveAllocatingBinaryKernel(kernel.get())
+      .Call(ctx, left, right, out);
+}
+
+template <typename Op>
+Status ExecUnary(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+                 Datum* out) {
+  if (!value.is_array()) {
+    return Status::Invalid("Invalid datum signature for arithmetic kernel");
+  }
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeUnaryKernel<Op>(*value.type(), options, &kernel));
+  out->value = ArrayData::Make(kernel->out_type(), value.length());
+  return detail::PrimitiveAllocatingUnaryKernel(kernel.get()).Call(ctx, value, out);
+}
+
+}  // namespace
+
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           ArithmeticOptions options, Datum* out) {
+  return ExecBinary<AddOp>(ctx, left, right, options, out);
+}
+
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out) {
+  return ExecBinary<SubtractOp>(ctx, left, right, options, out);
+}
+
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out) {
+  return ExecBinary<MultiplyOp>(ctx, left, right, options, out);
+}
+
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              ArithmeticOptions options, Datum* out) {
+  return ExecBinary<DivideOp>(ctx, left, right, options, out);
+}
+
+Status Negate(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+              Datum* out) {
+  return ExecUnary<NegateOp>(ctx, value, options, out);
+}
+
+Status Abs(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+           Datum* out) {
+  return ExecUnary<AbsOp>(ctx, value, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
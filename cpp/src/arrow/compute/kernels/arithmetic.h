@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+struct ARROW_EXPORT ArithmeticOptions {
+  ArithmeticOptions() : check_overflow(false) {}
+
+  /// If true, integer overflow is an error, otherwise results wrap around
+  /// modulo 2^bit_width.  Floating point results follow IEEE-754 semantics
+  /// regardless.
+  bool check_overflow;
+};
+
+/// \brief Element-wise arithmetic on numeric data
+///
+/// The binary functions accept two arrays of the same length, or an array
+/// and a scalar, of the same integer or floating point type.  The output has
+/// the type of the inputs and is null wherever an input is null; the
+/// validity bitmaps are combined word-wise, or reused without copying when
+/// only one input has nulls.
+///
+/// For example given left = [5, null, 3] and right = 2, Subtract outputs
+/// [3, null, 1].
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the first operand, an Array or a Scalar
+/// \param[in] right the second operand, an Array or a Scalar
+/// \param[in] options arithmetic options
+/// \param[out] out the resulting Array
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           ArithmeticOptions options, Datum* out);
+
+/// \brief Compute left - right, see Add()
+ARROW_EXPORT
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out);
+
+/// \brief Compute left * right, see Add()
+ARROW_EXPORT
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out);
+
+/// \brief Compute left / right, see Add()
+///
+/// Integer division truncates towards zero, and a zero divisor in a non-null
+/// slot is always an error.  Floating point division follows IEEE-754.
+ARROW_EXPORT
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              ArithmeticOptions options, Datum* out);
+
+/// \brief Compute -value element-wise
+///
+/// Negating the smallest value of a signed integer type or a non-zero value
+/// of an unsigned integer type overflows.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value the input Array
+/// \param[in] options arithmetic options
+/// \param[out] out the resulting Array
+ARROW_EXPORT
+Status Negate(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+              Datum* out);
+
+/// \brief Compute the absolute value element-wise, see Negate()
+///
+/// The absolute value of the smallest value of a signed integer type
+/// overflows.
+ARROW_EXPORT
+Status Abs(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+           Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,275 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+
+using BinaryFunction = Status (*)(FunctionContext*, const Datum&, const Datum&,
+                                  ArithmeticOptions, Datum*);
+using UnaryFunction = Status (*)(FunctionContext*, const Datum&, ArithmeticOptions,
+                                 Datum*);
+
+class TestArithmetic : public ComputeFixture, public TestBase {
+ protected:
+  void AssertResult(const Datum& actual, const std::shared_ptr<DataType>& type,
+                    const std::string& expected) {
+    ASSERT_EQ(actual.kind(), Datum::ARRAY);
+    auto array = actual.make_array();
+    ASSERT_OK(array->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(type, expected), *array, /*verbose=*/true);
+  }
+
+  void AssertBinary(BinaryFunction function, const std::shared_ptr<DataType>& type,
+                    const std::string& left, const std::string& right,
+                    const std::string& expected,
+                    ArithmeticOptions options = ArithmeticOptions()) {
+    Datum actual;
+    ASSERT_OK(function(&ctx_, ArrayFromJSON(type, left), ArrayFromJSON(type, right),
+                       options, &actual));
+    AssertResult(actual, type, expected);
+  }
+
+  void AssertBinary(BinaryFunction function, const std::shared_ptr<DataType>& type,
+                    const std::string& left, const std::shared_ptr<Scalar>& right,
+                    const std::string& expected,
+                    ArithmeticOptions options = ArithmeticOptions()) {
+    Datum actual;
+    ASSERT_OK(function(&ctx_, ArrayFromJSON(type, left), right, options, &actual));
+    AssertResult(actual, type, expected);
+  }
+
+  void AssertBinary(BinaryFunction function, const std::shared_ptr<DataType>& type,
+                    const std::shared_ptr<Scalar>& left, const std::string& right,
+                    const std::string& expected,
+                    ArithmeticOptions options = ArithmeticOptions()) {
+    Datum actual;
+    ASSERT_OK(function(&ctx_, left, ArrayFromJSON(type, right), options, &actual));
+    AssertResult(actual, type, expected);
+  }
+
+  void AssertBinaryRaises(BinaryFunction function, const std::shared_ptr<DataType>& type,
+                          const std::string& left, const std::string& right,
+                          ArithmeticOptions options = ArithmeticOptions()) {
+    Datum actual;
+    ASSERT_RAISES(Invalid, function(&ctx_, ArrayFromJSON(type, left),
+                                    ArrayFromJSON(type, right), options, &actual));
+  }
+
+  void AssertUnary(UnaryFunction function, const std::shared_ptr<DataType>& type,
+                   const std::string& values, const std::string& expected,
+                   ArithmeticOptions options = ArithmeticOptions()) {
+    Datum actual;
+    ASSERT_OK(function(&ctx_, ArrayFromJSON(type, values), options, &actual));
+    AssertResult(actual, type, expected);
+  }
+
+  void AssertUnaryRaises(UnaryFunction function, const std::shared_ptr<DataType>& type,
+                         const std::string& values,
+                         ArithmeticOptions options = ArithmeticOptions()) {
+    Datum actual;
+    ASSERT_RAISES(Invalid,
+                  function(&ctx_, ArrayFromJSON(type, values), options, &actual));
+  }
+
+  static ArithmeticOptions Checked() {
+    ArithmeticOptions options;
+    options.check_overflow = true;
+    return options;
+  }
+};
+
+template <typename ArrowType>
+class TestArithmeticNumeric : public TestArithmetic {
+ protected:
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<Scalar> MakeScalar(typename ArrowType::c_type value) {
+    return std::make_shared<typename TypeTraits<ArrowType>::ScalarType>(value);
+  }
+};
+
+typedef ::testing::Types<UInt8Type, Int8Type, UInt16Type, Int16Type, UInt32Type,
+                         Int32Type, UInt64Type, Int64Type, FloatType, DoubleType>
+    ArithmeticArrowTypes;
+TYPED_TEST_SUITE(TestArithmeticNumeric, ArithmeticArrowTypes);
+
+TYPED_TEST(TestArithmeticNumeric, ArrayArray) {
+  for (auto options : {ArithmeticOptions(), TestArithmetic::Checked()}) {
+    this->AssertBinary(Add, this->type(), "[]", "[]", "[]", options);
+    this->AssertBinary(Add, this->type(), "[3, null, 6, 1]", "[4, 5, null, 2]",
+                       "[7, null, null, 3]", options);
+    this->AssertBinary(Subtract, this->type(), "[30, null, 6, 12]", "[4, 5, null, 2]",
+                       "[26, null, null, 10]", options);
+    this->AssertBinary(Multiply, this->type(), "[3, null, 6, 12]", "[4, 5, null, 2]",
+                       "[12, null, null, 24]", options);
+    this->AssertBinary(Divide, this->type(), "[30, null, 6, 12]", "[3, 5, null, 2]",
+                       "[10, null, null, 6]", options);
+  }
+}
+
+TYPED_TEST(TestArithmeticNumeric, ArrayScalar) {
+  this->AssertBinary(Subtract, this->type(), "[30, null, 6, 12]", this->MakeScalar(5),
+                     "[25, null, 1, 7]");
+  this->AssertBinary(Subtract, this->type(), this->MakeScalar(40), "[30, null, 6, 12]",
+                     "[10, null, 34, 28]");
+  this->AssertBinary(Multiply, this->type(), "[3, null, 6]", this->MakeScalar(2),
+                     "[6, null, 12]");
+  this->AssertBinary(Divide, this->type(), this->MakeScalar(60), "[30, null, 6]",
+                     "[2, null, 10]");
+
+  // A null scalar gives an all-null result
+  auto null_scalar = MakeNullScalar(this->type());
+  this->AssertBinary(Add, this->type(), "[1, null, 2]", null_scalar,
+                     "[null, null, null]");
+  this->AssertBinary(Divide, this->type(), null_scalar, "[0, null, 2]",
+                     "[null, null, null]", TestArithmetic::Checked());
+}
+
+TYPED_TEST(TestArithmeticNumeric, Unary) {
+  this->AssertUnary(Abs, this->type(), "[]", "[]");
+  this->AssertUnary(Abs, this->type(), "[3, null, 0, 12]", "[3, null, 0, 12]");
+  this->AssertUnary(Negate, this->type(), "[0, null]", "[0, null]",
+                    TestArithmetic::Checked());
+}
+
+TYPED_TEST(TestArithmeticNumeric, SlicedInputs) {
+  auto left = ArrayFromJSON(this->type(), "[1, 2, null, 4, 5, 6, 7, 8, 9, null]");
+  auto right = ArrayFromJSON(this->type(), "[null, 1, 1, 1, 2, 2, null, 3, 3, 3]");
+  Datum actual;
+  ASSERT_OK(Add(&this->ctx_, left->Slice(1, 8), right->Slice(2, 8), ArithmeticOptions(),
+                &actual));
+  this->AssertResult(actual, this->type(), "[3, null, 5, 7, 8, null, 11, 12]");
+}
+
+TEST_F(TestArithmetic, Negative) {
+  for (auto type : {int8(), int64(), float32()}) {
+    AssertBinary(Subtract, type, "[1, -2, null]", "[3, -5, 1]", "[-2, 3, null]");
+    AssertUnary(Negate, type, "[1, -2, null, 0]", "[-1, 2, null, 0]");
+    AssertUnary(Abs, type, "[1, -2, null, 0]", "[1, 2, null, 0]");
+    // Integer division truncates towards zero
+    AssertBinary(Divide, type, "[-8, 8, -8]", "[2, -2, -2]", "[-4, -4, 4]");
+  }
+  AssertBinary(Divide, int32(), "[7, -7]", "[2, 2]", "[3, -3]");
+}
+
+TEST_F(TestArithmetic, IntegerOverflow) {
+  // Results wrap around unless overflow checking is requested
+  AssertBinary(Add, int8(), "[127, 1]", "[1, 1]", "[-128, 2]");
+  AssertBinaryRaises(Add, int8(), "[127, 1]", "[1, 1]", Checked());
+  AssertBinary(Add, uint8(), "[255]", "[2]", "[1]");
+  AssertBinaryRaises(Add, uint8(), "[255]", "[2]", Checked());
+  AssertBinary(Subtract, int8(), "[-128]", "[1]", "[127]");
+  AssertBinaryRaises(Subtract, int8(), "[-128]", "[1]", Checked());
+  AssertBinary(Subtract, uint32(), "[1]", "[2]", "[4294967295]");
+  AssertBinaryRaises(Subtract, uint32(), "[1]", "[2]", Checked());
+  AssertBinary(Multiply, int16(), "[256]", "[256]", "[0]");
+  AssertBinaryRaises(Multiply, int16(), "[256]", "[256]", Checked());
+  AssertBinary(Multiply, uint16(), "[65535]", "[65535]", "[1]");
+  AssertBinaryRaises(Multiply, uint16(), "[65535]", "[65535]", Checked());
+  AssertBinary(Multiply, int64(), "[4611686018427387904, -1]",
+               "[2, -9223372036854775808]",
+               "[-9223372036854775808, -9223372036854775808]");
+  AssertBinaryRaises(Multiply, int64(), "[4611686018427387904]", "[2]", Checked());
+  AssertBinaryRaises(Multiply, int64(), "[-1]", "[-9223372036854775808]", Checked());
+  AssertBinary(Multiply, int64(), "[-4611686018427387904]", "[2]",
+               "[-9223372036854775808]", Checked());
+  AssertBinaryRaises(Multiply, uint64(), "[4294967296]", "[4294967296]", Checked());
+  AssertBinary(Divide, int8(), "[-128]", "[-1]", "[-128]");
+  AssertBinaryRaises(Divide, int8(), "[-128]", "[-1]", Checked());
+  AssertUnary(Negate, int32(), "[-2147483648]", "[-2147483648]");
+  AssertUnaryRaises(Negate, int32(), "[-2147483648]", Checked());
+  AssertUnary(Negate, uint8(), "[1]", "[255]");
+  AssertUnaryRaises(Negate, uint8(), "[1]", Checked());
+  AssertUnary(Abs, int64(), "[-9223372036854775808]", "[-9223372036854775808]");
+  AssertUnaryRaises(Abs, int64(), "[-9223372036854775808]", Checked());
+}
+
+TEST_F(TestArithmetic, OverflowInNullSlots) {
+  // The values behind null slots are unspecified and must not raise errors
+  auto left = ArrayFromJSON(int8(), "[127, 1, 100]");
+  auto right = ArrayFromJSON(int8(), "[null, 1, null]");
+  Datum actual;
+  ASSERT_OK(Add(&ctx_, left, right, Checked(), &actual));
+  AssertResult(actual, int8(), "[null, 2, null]");
+  ASSERT_OK(Multiply(&ctx_, left, right, Checked(), &actual));
+  AssertResult(actual, int8(), "[null, 1, null]");
+  ASSERT_OK(Divide(&ctx_, left, right, Checked(), &actual));
+  AssertResult(actual, int8(), "[null, 1, null]");
+  ASSERT_OK(Negate(&ctx_, ArrayFromJSON(int8(), "[-128, null]")->Slice(1), Checked(),
+                   &actual));
+  AssertResult(actual, int8(), "[null]");
+}
+
+TEST_F(TestArithmetic, DivideByZero) {
+  for (auto options : {ArithmeticOptions(), Checked()}) {
+    AssertBinaryRaises(Divide, int32(), "[1, 2]", "[1, 0]", options);
+    AssertBinaryRaises(Divide, uint64(), "[1, null]", "[0, 1]", options);
+    // A zero divisor in a null slot is fine
+    AssertBinary(Divide, int32(), "[1, null]", "[1, 0]", "[1, null]", options);
+  }
+  Datum actual;
+  std::shared_ptr<Scalar> zero = std::make_shared<Int16Scalar>(0);
+  ASSERT_RAISES(Invalid, Divide(&ctx_, ArrayFromJSON(int16(), "[1, 2]"), zero,
+                                ArithmeticOptions(), &actual));
+
+  // Floating point division follows IEEE-754
+  AssertBinary(Divide, float64(), "[1, -1, 0]", "[0, 0, 1]", "[Infinity, -Infinity, 0]");
+  ASSERT_OK(Divide(&ctx_, ArrayFromJSON(float64(), "[0]"),
+                   ArrayFromJSON(float64(), "[0]"), Checked(), &actual));
+  const auto& quotient = checked_cast<const DoubleArray&>(*actual.make_array());
+  ASSERT_TRUE(std::isnan(quotient.Value(0)));
+}
+
+TEST_F(TestArithmetic, InvalidInputs) {
+  Datum actual;
+  ASSERT_RAISES(TypeError, Add(&ctx_, ArrayFromJSON(int32(), "[1]"),
+                               ArrayFromJSON(int64(), "[1]"), ArithmeticOptions(),
+                               &actual));
+  ASSERT_RAISES(Invalid, Add(&ctx_, ArrayFromJSON(int32(), "[1]"),
+                             ArrayFromJSON(int32(), "[1, 2]"), ArithmeticOptions(),
+                             &actual));
+  std::shared_ptr<Scalar> one = std::make_shared<Int32Scalar>(1);
+  ASSERT_RAISES(Invalid, Add(&ctx_, one, one, ArithmeticOptions(), &actual));
+  ASSERT_RAISES(NotImplemented, Add(&ctx_, ArrayFromJSON(utf8(), R"(["a"])"),
+                                    ArrayFromJSON(utf8(), R"(["b"])"),
+                                    ArithmeticOptions(), &actual));
+  ASSERT_RAISES(NotImplemented,
+                Negate(&ctx_, ArrayFromJSON(boolean(), "[true]"), ArithmeticOptions(),
+                       &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
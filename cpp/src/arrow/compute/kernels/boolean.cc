@@ -73,7 +73,8 @@ Status Invert(FunctionContext* ctx, const Datum& value, Datum* out) {
   detail::PrimitiveAllocatingUnaryKernel kernel(&invert);
 
   std::vector<Datum> result;
-  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, value, &result));
+  RETURN_NOT_OK(detail::ParallelInvokeUnaryArrayKernel(ctx, &kernel, value,
+                                                       /*split_morsels=*/true, &result));
 
   *out = detail::WrapDatumsLike(value, invert.out_type(), result);
   return Status::OK();
@@ -792,12 +792,19 @@ bool NeedToPreallocate(const DataType& type) { return is_fixed_width(type.id());
 Status InvokeWithAllocation(FunctionContext* ctx, UnaryKernel* func, const Datum& input,
                             Datum* out) {
   std::vector<Datum> result;
+  // Some casts of nested types don't support sliced input, so only split flat
+  // chunks into morsels
+  const DataType& in_type = *input.type();
+  const bool split_morsels =
+      in_type.num_children() == 0 && in_type.id() != Type::EXTENSION;
   if (NeedToPreallocate(*func->out_type())) {
     // Create wrapper that allocates output memory for primitive types
     detail::PrimitiveAllocatingUnaryKernel wrapper(func);
-    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &wrapper, input, &result));
+    RETURN_NOT_OK(detail::ParallelInvokeUnaryArrayKernel(ctx, &wrapper, input,
+                                                         split_morsels, &result));
   } else {
-    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, func, input, &result));
+    RETURN_NOT_OK(
+        detail::ParallelInvokeUnaryArrayKernel(ctx, func, input, split_morsels, &result));
   }
   ARROW_RETURN_IF_ERROR(ctx);
   *out = detail::WrapDatumsLike(input, func->out_type(), result);
@@ -1216,6 +1216,28 @@ TEST_F(TestCast, ChunkedArray) {
   ASSERT_TRUE(out.chunked_array()->Equals(*ex_carr));
 }
 
+TEST_F(TestCast, ChunkedArrayThreaded) {
+  ArrayVector chunks, expected_chunks;
+  for (int i = 0; i < 50; ++i) {
+    chunks.push_back(ArrayFromJSON(int16(), "[0, null, " + std::to_string(i) + "]"));
+    expected_chunks.push_back(
+        ArrayFromJSON(int64(), "[0, null, " + std::to_string(i) + "]"));
+  }
+  this->ctx_.set_use_threads(true);
+
+  Datum out;
+  ASSERT_OK(Cast(&this->ctx_, std::make_shared<ChunkedArray>(chunks), int64(),
+                 CastOptions(), &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(ChunkedArray(expected_chunks), *out.chunked_array());
+
+  // Errors in any chunk are reported
+  chunks[17] = ArrayFromJSON(int16(), "[0, -1]");
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, std::make_shared<ChunkedArray>(chunks),
+                              uint8(), CastOptions(), &out));
+  ASSERT_FALSE(this->ctx_.HasError());
+}
+
 TEST_F(TestCast, UnsupportedTarget) {
   std::vector<bool> is_valid = {true, false, true, true, true};
   std::vector<int32_t> v1 = {0, 1, 2, 3, 4};
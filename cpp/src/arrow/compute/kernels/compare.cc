@@ -17,6 +17,7 @@
 
 #include "arrow/compute/kernels/compare.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "arrow/compute/context.h"
@@ -160,6 +161,64 @@ RangeType MakeRange(const BaseBinaryArray<T>& array) {
   return RangeType{&array};
 }
 
+// Random access to the values of arrays and scalars, to compare the values at
+// the positions of a selection vector only
+template <typename Value>
+struct RepeatedValueAtIndex {
+  Value operator()(int64_t) const { return value_; }
+  Value value_;
+};
+
+template <typename T>
+struct ValueAtIndex {
+  T operator()(int64_t index) const { return values_[index]; }
+  const T* values_;
+};
+
+struct BitAtIndex {
+  bool operator()(int64_t index) const {
+    return BitUtil::GetBit(bitmap_, offset_ + index);
+  }
+  const uint8_t* bitmap_;
+  int64_t offset_;
+};
+
+template <typename ArrayType>
+struct ViewAtIndex {
+  string_view operator()(int64_t index) const { return array_->GetView(index); }
+  const ArrayType* array_;
+};
+
+template <typename T>
+RepeatedValueAtIndex<typename T::c_type> MakeIndexedRange(
+    const TemporalScalar<T>& scalar) {
+  return {scalar.value};
+}
+
+template <typename T>
+RepeatedValueAtIndex<typename T::c_type> MakeIndexedRange(
+    const internal::PrimitiveScalar<T>& scalar) {
+  return {scalar.value};
+}
+
+RepeatedValueAtIndex<string_view> MakeIndexedRange(const BaseBinaryScalar& scalar) {
+  return {string_view(*scalar.value)};
+}
+
+BitAtIndex MakeIndexedRange(const BooleanArray& array) {
+  return {array.values()->data(), array.offset()};
+}
+
+template <typename T>
+ValueAtIndex<typename T::c_type> MakeIndexedRange(const NumericArray<T>& array) {
+  return {array.raw_values()};
+}
+
+template <typename T>
+ViewAtIndex<BaseBinaryArray<T>> MakeIndexedRange(const BaseBinaryArray<T>& array) {
+  return {&array};
+}
+
 inline Status AssignNulls(FunctionContext* ctx, const Array& array, const Scalar& scalar,
                           ArrayData* out) {
   return scalar.is_valid ? detail::PropagateNulls(ctx, *array.data(), out)
@@ -171,6 +230,52 @@ inline Status AssignNulls(FunctionContext* ctx, const Array& left, const Array&
   return detail::AssignNullIntersection(ctx, *left.data(), *right.data(), out);
 }
 
+// Assign the validity bitmap of comparing the values at the positions of a
+// selection vector: valid where the selection and is_valid(index) are
+template <typename IsValid>
+Status AssignSelectedNulls(FunctionContext* ctx, const Int64Array& selection,
+                           bool values_have_nulls, IsValid&& is_valid, ArrayData* out) {
+  if (selection.null_count() == 0 && !values_have_nulls) {
+    out->buffers[0] = nullptr;
+    out->null_count = 0;
+    return Status::OK();
+  }
+
+  std::shared_ptr<Buffer> bitmap;
+  RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(out->length), &bitmap));
+  const int64_t* indices = selection.raw_values();
+  int64_t i = 0;
+  int64_t null_count = 0;
+  internal::GenerateBitsUnrolled(bitmap->mutable_data(), 0, out->length, [&]() -> bool {
+    const bool valid = selection.IsValid(i) && is_valid(indices[i]);
+    null_count += !valid;
+    ++i;
+    return valid;
+  });
+  out->buffers[0] = std::move(bitmap);
+  out->null_count = null_count;
+  return Status::OK();
+}
+
+inline Status AssignSelectedNulls(FunctionContext* ctx, const Int64Array& selection,
+                                  const Array& array, const Scalar& scalar,
+                                  ArrayData* out) {
+  if (!scalar.is_valid) {
+    return detail::SetAllNulls(ctx, *selection.data(), out);
+  }
+  return AssignSelectedNulls(
+      ctx, selection, array.null_count() != 0,
+      [&](int64_t index) { return array.IsValid(index); }, out);
+}
+
+inline Status AssignSelectedNulls(FunctionContext* ctx, const Int64Array& selection,
+                                  const Array& left, const Array& right,
+                                  ArrayData* out) {
+  return AssignSelectedNulls(
+      ctx, selection, left.null_count() != 0 || right.null_count() != 0,
+      [&](int64_t index) { return left.IsValid(index) && right.IsValid(index); }, out);
+}
+
 template <CompareOperator Op, typename L, typename R>
 Status Compare(L&& get_left, R&& get_right, ArrayData* out) {
   auto out_bitmap = out->buffers[1]->mutable_data();
@@ -180,12 +285,37 @@ Status Compare(L&& get_left, R&& get_right, ArrayData* out) {
   return Status::OK();
 }
 
+// Compare the values at the positions of a selection vector, into an output
+// whose validity bitmap is assigned (see AssignSelectedNulls)
+template <CompareOperator Op, typename L, typename R>
+Status CompareSelected(L&& get_left, R&& get_right, const Int64Array& selection,
+                       ArrayData* out) {
+  const int64_t* indices = selection.raw_values();
+  const uint8_t* out_validity = out->null_count != 0 ? out->buffers[0]->data() : nullptr;
+  auto out_bitmap = out->buffers[1]->mutable_data();
+  int64_t i = 0;
+  internal::GenerateBitsUnrolled(out_bitmap, 0, out->length, [&]() -> bool {
+    const int64_t position = i++;
+    // The index at a null position of the selection may be out of bounds
+    if (out_validity && !BitUtil::GetBit(out_validity, position)) {
+      return false;
+    }
+    const int64_t index = indices[position];
+    return Comparator<decltype(get_left(index)), Op>::Compare(get_left(index),
+                                                             get_right(index));
+  });
+  return Status::OK();
+}
+
 template <typename ArrowType, CompareOperator Op>
 class CompareKernel final : public BinaryKernel {
  public:
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
   using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
 
+  // If selection is given, only the values at its positions are compared
+  explicit CompareKernel(const Int64Array* selection = NULLPTR) : selection_(selection) {}
+
   std::shared_ptr<DataType> out_type() const override { return boolean(); }
 
   Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
@@ -197,11 +327,25 @@ class CompareKernel final : public BinaryKernel {
     auto right_scalar = AsScalar(right);
 
     if (left_array && right_array) {
+      if (selection_) {
+        RETURN_NOT_OK(AssignSelectedNulls(ctx, *selection_, *left_array, *right_array,
+                                          out.get()));
+        return CompareSelected<Op>(MakeIndexedRange(*left_array),
+                                   MakeIndexedRange(*right_array), *selection_,
+                                   out.get());
+      }
       RETURN_NOT_OK(AssignNulls(ctx, *left_array, *right_array, out.get()));
       return Compare<Op>(MakeRange(*left_array), MakeRange(*right_array), out.get());
     }
 
     if (left_array && right_scalar) {
+      if (selection_) {
+        RETURN_NOT_OK(AssignSelectedNulls(ctx, *selection_, *left_array, *right_scalar,
+                                          out.get()));
+        return CompareSelected<Op>(MakeIndexedRange(*left_array),
+                                   MakeIndexedRange(*right_scalar), *selection_,
+                                   out.get());
+      }
       RETURN_NOT_OK(AssignNulls(ctx, *left_array, *right_scalar, out.get()));
       return Compare<Op>(MakeRange(*left_array), MakeRange(*right_scalar), out.get());
     }
@@ -210,6 +354,8 @@ class CompareKernel final : public BinaryKernel {
   }
 
  private:
+  const Int64Array* selection_;
+
   static std::shared_ptr<ArrayType> AsArray(const Datum& datum) {
     if (datum.kind() != Datum::ARRAY) return nullptr;
     return checked_pointer_cast<ArrayType>(datum.make_array());
@@ -222,25 +368,32 @@ class CompareKernel final : public BinaryKernel {
 };
 
 template <typename ArrowType>
-std::shared_ptr<BinaryKernel> UnpackOperator(CompareOperator op) {
+std::shared_ptr<BinaryKernel> UnpackOperator(CompareOperator op,
+                                             const Int64Array* selection) {
   switch (op) {
     case CompareOperator::EQUAL:
-      return std::make_shared<CompareKernel<ArrowType, CompareOperator::EQUAL>>();
+      return std::make_shared<CompareKernel<ArrowType, CompareOperator::EQUAL>>(
+          selection);
 
     case CompareOperator::NOT_EQUAL:
-      return std::make_shared<CompareKernel<ArrowType, CompareOperator::NOT_EQUAL>>();
+      return std::make_shared<CompareKernel<ArrowType, CompareOperator::NOT_EQUAL>>(
+          selection);
 
     case CompareOperator::GREATER:
-      return std::make_shared<CompareKernel<ArrowType, CompareOperator::GREATER>>();
+      return std::make_shared<CompareKernel<ArrowType, CompareOperator::GREATER>>(
+          selection);
 
     case CompareOperator::GREATER_EQUAL:
-      return std::make_shared<CompareKernel<ArrowType, CompareOperator::GREATER_EQUAL>>();
+      return std::make_shared<CompareKernel<ArrowType, CompareOperator::GREATER_EQUAL>>(
+          selection);
 
     case CompareOperator::LESS:
-      return std::make_shared<CompareKernel<ArrowType, CompareOperator::LESS>>();
+      return std::make_shared<CompareKernel<ArrowType, CompareOperator::LESS>>(
+          selection);
 
     case CompareOperator::LESS_EQUAL:
-      return std::make_shared<CompareKernel<ArrowType, CompareOperator::LESS_EQUAL>>();
+      return std::make_shared<CompareKernel<ArrowType, CompareOperator::LESS_EQUAL>>(
+          selection);
   }
 
   return nullptr;
@@ -250,25 +403,25 @@ struct UnpackType {
   Status Visit(const NullType& unreachable) { return Status::OK(); }
 
   Status Visit(const BooleanType& t) {
-    *out_ = UnpackOperator<BooleanType>(options_.op);
+    *out_ = UnpackOperator<BooleanType>(options_.op, selection_);
     return Status::OK();
   }
 
   template <typename Numeric>
   enable_if_number<Numeric, Status> Visit(const Numeric& t) {
-    *out_ = UnpackOperator<Numeric>(options_.op);
+    *out_ = UnpackOperator<Numeric>(options_.op, selection_);
     return Status::OK();
   }
 
   template <typename Temporal>
   enable_if_temporal<Temporal, Status> Visit(const Temporal& t) {
-    *out_ = UnpackOperator<Temporal>(options_.op);
+    *out_ = UnpackOperator<Temporal>(options_.op, selection_);
     return Status::OK();
   }
 
   template <typename StringLike>
   enable_if_base_binary<StringLike, Status> Visit(const StringLike& t) {
-    *out_ = UnpackOperator<StringLike>(options_.op);
+    *out_ = UnpackOperator<StringLike>(options_.op, selection_);
     return Status::OK();
   }
 
@@ -292,29 +445,32 @@ struct UnpackType {
 
   std::shared_ptr<BinaryKernel>* out_;
   CompareOptions options_;
+  const Int64Array* selection_;
 };
 
 // make a compare kernel and invoke it
 inline Status FinishCompare(FunctionContext* context, const Datum& left,
-                            const Datum& right, CompareOptions options, Datum* out) {
+                            const Datum& right, CompareOptions options,
+                            const Int64Array* selection, Datum* out) {
   std::shared_ptr<BinaryKernel> kernel;
-  UnpackType visitor{&kernel, options};
+  UnpackType visitor{&kernel, options, selection};
   RETURN_NOT_OK(VisitTypeInline(*left.type(), &visitor));
 
-  out->value = ArrayData::Make(kernel->out_type(), left.length());
+  const int64_t length = selection ? selection->length() : left.length();
+  out->value = ArrayData::Make(kernel->out_type(), length);
 
   return detail::PrimitiveAllocatingBinaryKernel(kernel.get())
       .Call(context, left, right, out);
 }
 
-Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
-               CompareOptions options, Datum* out) {
+static Status CompareSelection(FunctionContext* context, const Datum& left,
+                               const Datum& right, const Array* selection,
+                               CompareOptions options, Datum* out) {
   if (!left.type()->Equals(right.type())) {
     return Status::TypeError("Cannot compare data of differing type ", *left.type(),
                              " vs ", *right.type());
   }
 
-  std::shared_ptr<BinaryKernel> kernel;
   if (left.is_scalar()) {
     if (right.is_scalar()) {
       return Status::Invalid("Invalid datum signature for Compare");
@@ -322,10 +478,28 @@ Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
 
     // flip the comparison so that the scalar is the right hand side
     options.op = FlippedCompareOperator(options.op);
-    return FinishCompare(context, right, left, options, out);
+    return CompareSelection(context, right, left, selection, options, out);
+  }
+
+  if (selection == nullptr) {
+    return FinishCompare(context, left, right, options, nullptr, out);
+  }
+  if (right.kind() == Datum::ARRAY && right.length() != left.length()) {
+    return Status::Invalid("Arrays to compare must have the same length");
   }
+  RETURN_NOT_OK(detail::ValidateSelectionVector(*selection, left.length()));
+  return FinishCompare(context, left, right, options,
+                       &checked_cast<const Int64Array&>(*selection), out);
+}
+
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               CompareOptions options, Datum* out) {
+  return CompareSelection(context, left, right, nullptr, options, out);
+}
 
-  return FinishCompare(context, left, right, options, out);
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               const Array& selection, CompareOptions options, Datum* out) {
+  return CompareSelection(context, left, right, &selection, options, out);
 }
 
 }  // namespace compute
@@ -24,6 +24,7 @@
 
 namespace arrow {
 
+class Array;
 class DataType;
 class Status;
 
@@ -68,5 +69,26 @@ ARROW_EXPORT
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                struct CompareOptions options, Datum* out);
 
+/// \brief Compare the values of an array at the positions of a selection
+/// vector with a scalar or the values of another array at the same positions.
+///
+/// The output has the length of the selection, and is null where the selection
+/// or a compared value is null.  This is comparing the values taken at the
+/// selection (see Take), without taking them first.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left datum to compare, must be an Array
+/// \param[in] right datum to compare, must be a Scalar or an Array of the same
+///            length, of the same type than left Datum.
+/// \param[in] selection Int64Array of positions in the arrays (see
+///            GetSelectionVector)
+/// \param[in] options compare options
+/// \param[out] out resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               const Array& selection, struct CompareOptions options, Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -27,6 +27,8 @@
 #include "arrow/array.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
@@ -423,6 +425,54 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TYPED_TEST(TestNumericCompareKernel, SelectionCompare) {
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  auto lhs = ArrayFromJSON(type, "[1, 2, null, 4, 5]");
+  auto rhs = ArrayFromJSON(type, "[2, 2, 3, null, 4]");
+  auto selection = ArrayFromJSON(int64(), "[4, null, 0, 2, 1, 3]");
+  CompareOptions gte(CompareOperator::GREATER_EQUAL);
+
+  Datum result;
+  ASSERT_OK(Compare(&this->ctx_, lhs, rhs, *selection, gte, &result));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[1, null, 0, null, 1, null]"),
+                    *result.make_array());
+
+  auto two = Datum(std::make_shared<typename TypeTraits<TypeParam>::ScalarType>(2));
+  ASSERT_OK(Compare(&this->ctx_, lhs, two, *selection, gte, &result));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[1, null, 0, null, 1, 1]"),
+                    *result.make_array());
+  // The scalar is flipped to the right hand side
+  ASSERT_OK(Compare(&this->ctx_, two, lhs, *selection, gte, &result));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[0, null, 1, null, 1, 0]"),
+                    *result.make_array());
+
+  ASSERT_RAISES(IndexError, Compare(&this->ctx_, lhs, rhs,
+                                    *ArrayFromJSON(int64(), "[5]"), gte, &result));
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, lhs, rhs->Slice(1), *selection, gte,
+                                 &result));
+}
+
+TYPED_TEST(TestNumericCompareKernel, RandomSelectionCompare) {
+  auto rand = random::RandomArrayGenerator(0x3f1c2a9);
+  const int64_t length = 1000;
+  auto lhs = rand.Numeric<TypeParam>(length, 0, 100, 0.1);
+  auto rhs = rand.Numeric<TypeParam>(length, 0, 100, 0.1);
+  auto filter = rand.Boolean(length, 0.5, 0.1);
+  std::shared_ptr<Array> selection, taken_lhs, taken_rhs;
+  ASSERT_OK(GetSelectionVector(&this->ctx_, *filter, &selection));
+  ASSERT_OK(Take(&this->ctx_, *lhs, *selection, TakeOptions(), &taken_lhs));
+  ASSERT_OK(Take(&this->ctx_, *rhs, *selection, TakeOptions(), &taken_rhs));
+
+  // Comparing the selected values is comparing the taken values
+  for (auto op : {EQUAL, NOT_EQUAL, GREATER, LESS_EQUAL}) {
+    Datum result, expected;
+    ASSERT_OK(Compare(&this->ctx_, lhs, rhs, *selection, CompareOptions(op), &result));
+    ASSERT_OK(
+        Compare(&this->ctx_, taken_lhs, taken_rhs, CompareOptions(op), &expected));
+    AssertArraysEqual(*expected.make_array(), *result.make_array());
+  }
+}
+
 class TestStringCompareKernel : public ComputeFixture, public TestBase {};
 
 TEST_F(TestStringCompareKernel, SimpleCompareArrayScalar) {
@@ -552,5 +602,22 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST_F(TestStringCompareKernel, SelectionCompare) {
+  auto lhs = ArrayFromJSON(utf8(), R"(["a", "b", null, "d"])");
+  auto rhs = ArrayFromJSON(utf8(), R"(["b", "b", "c", "c"])");
+  auto selection = ArrayFromJSON(int64(), "[3, null, 2, 0, 1]");
+  CompareOptions lt(CompareOperator::LESS);
+
+  Datum result;
+  ASSERT_OK(Compare(&this->ctx_, lhs, rhs, *selection, lt, &result));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[0, null, null, 1, 0]"),
+                    *result.make_array());
+
+  Datum c(std::make_shared<StringScalar>("c"));
+  ASSERT_OK(Compare(&this->ctx_, lhs, c, *selection, lt, &result));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[0, null, null, 1, 1]"),
+                    *result.make_array());
+}
+
 }  // namespace compute
 }  // namespace arrow
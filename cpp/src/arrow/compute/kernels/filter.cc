@@ -17,16 +17,21 @@
 
 #include "arrow/compute/kernels/filter.h"
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 #include "arrow/array/concatenate.h"
 #include "arrow/builder.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
@@ -67,15 +72,104 @@ class FilterIndexSequence {
   int64_t index_ = 0, out_length_ = -1;
 };
 
-// TODO(bkietz) this can be optimized
-static int64_t OutputSize(const BooleanArray& filter) {
-  int64_t size = 0;
-  for (auto i = 0; i < filter.length(); ++i) {
-    if (filter.IsNull(i) || filter.Value(i)) {
-      ++size;
+// The position of the first bit equal to value in [start, end) of a bitmap, or
+// end if there is none.  Whole bytes of the other value are skipped at once.
+static int64_t FindBit(const uint8_t* bitmap, int64_t start, int64_t end, bool value) {
+  const uint8_t skipped_byte = value ? 0x00 : 0xFF;
+  int64_t i = start;
+  for (; i < end && i % 8 != 0; ++i) {
+    if (BitUtil::GetBit(bitmap, i) == value) return i;
+  }
+  while (i + 8 <= end && bitmap[i / 8] == skipped_byte) {
+    i += 8;
+  }
+  for (; i < end; ++i) {
+    if (BitUtil::GetBit(bitmap, i) == value) return i;
+  }
+  return end;
+}
+
+// Visit the (offset, length) of each run of set bits in [start, end) of a
+// bitmap, relative to start, until the visitor returns false
+template <typename Visitor>
+void VisitSetBitRuns(const uint8_t* bitmap, int64_t start, int64_t end,
+                     Visitor&& visit) {
+  int64_t position = FindBit(bitmap, start, end, true);
+  while (position < end) {
+    const int64_t run_end = FindBit(bitmap, position, end, false);
+    if (!visit(position - start, run_end - position)) {
+      return;
     }
+    position = FindBit(bitmap, run_end, end, true);
+  }
+}
+
+// The number of values selected by a filter (true or null), and the runs of
+// consecutive selected values if filtering can be done by slicing these runs
+struct FilterRuns {
+  int64_t out_length = 0;
+  bool sliceable = false;
+  // (offset, length) of each run of selected values
+  std::vector<std::pair<int64_t, int64_t>> runs;
+};
+
+// Filter chunks with slices rather than a copy only if the runs are long enough
+// on average to make up for the overhead of more chunks
+constexpr int64_t kMinSliceRunLength = 1024;
+
+// Arrays are only filtered with slices of a single run
+constexpr int64_t kSingleRun = std::numeric_limits<int64_t>::max();
+
+// The runs are only sliceable if the filter has no nulls, and the runs are at
+// least min_run_length long on average or there is a single run
+static FilterRuns GetFilterRuns(const BooleanArray& filter, int64_t min_run_length) {
+  FilterRuns result;
+  if (filter.length() == 0) {
+    result.sliceable = true;
+    return result;
+  }
+  const uint8_t* bits = filter.values()->data();
+  const int64_t start = filter.offset();
+  const int64_t end = filter.offset() + filter.length();
+
+  if (filter.null_count() != 0) {
+    internal::BitmapReader valid_reader(filter.null_bitmap_data(), start,
+                                        filter.length());
+    internal::BitmapReader value_reader(bits, start, filter.length());
+    for (int64_t i = 0; i < filter.length(); ++i) {
+      result.out_length += !valid_reader.IsSet() || value_reader.IsSet();
+      valid_reader.Next();
+      value_reader.Next();
+    }
+    return result;
+  }
+
+  result.out_length = internal::CountSetBits(bits, start, filter.length());
+  const auto max_runs =
+      static_cast<size_t>(std::max<int64_t>(1, result.out_length / min_run_length));
+  result.sliceable = true;
+  VisitSetBitRuns(bits, start, end, [&](int64_t offset, int64_t length) {
+    if (result.runs.size() == max_runs) {
+      result.sliceable = false;
+      result.runs.clear();
+      return false;
+    }
+    result.runs.emplace_back(offset, length);
+    return true;
+  });
+  return result;
+}
+
+// Filter values by slicing if the filter selects a single run of them, or
+// nothing.  Returns false if the values must be copied.
+static bool FilterBySlicing(const Array& values, const FilterRuns& runs,
+                            std::shared_ptr<Array>* out) {
+  if (!runs.sliceable || runs.runs.size() > 1) {
+    return false;
   }
-  return size;
+  *out = runs.runs.empty() ? values.Slice(0, 0)
+                           : values.Slice(runs.runs[0].first, runs.runs[0].second);
+  return true;
 }
 
 static Result<std::shared_ptr<BooleanArray>> GetFilterArray(const Datum& filter) {
@@ -122,9 +216,15 @@ Status FilterKernel::Call(FunctionContext* ctx, const Datum& values, const Datum
   auto values_array = values.make_array();
 
   ARROW_ASSIGN_OR_RAISE(auto filter_array, GetFilterArray(filter));
+  if (values_array->length() != filter_array->length()) {
+    return Status::Invalid("filter and value array must have identical lengths");
+  }
+  auto runs = GetFilterRuns(*filter_array, kSingleRun);
   std::shared_ptr<Array> out_array;
-  RETURN_NOT_OK(this->Filter(ctx, *values_array, *filter_array, OutputSize(*filter_array),
-                             &out_array));
+  if (!FilterBySlicing(*values_array, runs, &out_array)) {
+    RETURN_NOT_OK(
+        this->Filter(ctx, *values_array, *filter_array, runs.out_length, &out_array));
+  }
   *out = out_array;
   return Status::OK();
 }
@@ -147,6 +247,9 @@ Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter,
 Status Filter(FunctionContext* ctx, const RecordBatch& batch, const Array& filter,
               std::shared_ptr<RecordBatch>* out) {
   ARROW_ASSIGN_OR_RAISE(auto filter_array, GetFilterArray(Datum(filter.data())));
+  if (batch.num_rows() != filter_array->length()) {
+    return Status::Invalid("filter and value array must have identical lengths");
+  }
 
   std::vector<std::unique_ptr<FilterKernel>> kernels(batch.num_columns());
   for (int i = 0; i < batch.num_columns(); ++i) {
@@ -154,100 +257,207 @@ Status Filter(FunctionContext* ctx, const RecordBatch& batch, const Array& filte
   }
 
   std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
-  auto out_length = OutputSize(*filter_array);
-  for (int i = 0; i < batch.num_columns(); ++i) {
-    RETURN_NOT_OK(kernels[i]->Filter(ctx, *batch.column(i), *filter_array, out_length,
-                                     &columns[i]));
+  auto runs = GetFilterRuns(*filter_array, kSingleRun);
+  RETURN_NOT_OK(detail::ParallelForTasks(
+      ctx, batch.num_columns(), [&](FunctionContext* task_ctx, int i) {
+        if (FilterBySlicing(*batch.column(i), runs, &columns[i])) {
+          return Status::OK();
+        }
+        return kernels[i]->Filter(task_ctx, *batch.column(i), *filter_array,
+                                  runs.out_length, &columns[i]);
+      }));
+
+  *out = RecordBatch::Make(batch.schema(), runs.out_length, columns);
+  return Status::OK();
+}
+
+Status GetSelectionVector(FunctionContext* ctx, const Array& filter,
+                          std::shared_ptr<Array>* out) {
+  ARROW_ASSIGN_OR_RAISE(auto filter_array, GetFilterArray(Datum(filter.data())));
+  // Only count the selected values, the runs are visited below
+  auto runs = GetFilterRuns(*filter_array, kSingleRun);
+  const int64_t out_length = runs.out_length;
+
+  std::shared_ptr<Buffer> indices_buffer;
+  RETURN_NOT_OK(ctx->Allocate(out_length * sizeof(int64_t), &indices_buffer));
+  auto indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
+  std::shared_ptr<Buffer> null_bitmap;
+  int64_t null_count = 0;
+
+  if (filter_array->null_count() == 0) {
+    const int64_t start = filter_array->offset();
+    VisitSetBitRuns(filter_array->values()->data(), start,
+                    start + filter_array->length(),
+                    [&](int64_t offset, int64_t length) {
+                      std::iota(indices, indices + length, offset);
+                      indices += length;
+                      return true;
+                    });
+  } else {
+    // Nulls in the filter select null indices
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(out_length), &null_bitmap));
+    internal::FirstTimeBitmapWriter null_writer(null_bitmap->mutable_data(), 0,
+                                                out_length);
+    for (int64_t i = 0; i < filter_array->length(); ++i) {
+      if (filter_array->IsNull(i)) {
+        *indices++ = 0;
+        null_writer.Clear();
+        null_writer.Next();
+        ++null_count;
+      } else if (filter_array->Value(i)) {
+        *indices++ = i;
+        null_writer.Set();
+        null_writer.Next();
+      }
+    }
+    null_writer.Finish();
   }
 
-  *out = RecordBatch::Make(batch.schema(), out_length, columns);
+  *out = MakeArray(ArrayData::Make(int64(), out_length,
+                                   {std::move(null_bitmap), std::move(indices_buffer)},
+                                   null_count));
   return Status::OK();
 }
 
-Status Filter(FunctionContext* ctx, const ChunkedArray& values, const Array& filter,
-              std::shared_ptr<ChunkedArray>* out) {
-  if (values.length() != filter.length()) {
-    return Status::Invalid("filter and value array must have identical lengths");
+namespace {
+
+using FilterSlicer =
+    std::function<Status(int64_t offset, int64_t length, std::shared_ptr<Array>* out)>;
+
+// Filter the chunks of each column with the matching slices of a filter, as one
+// task per chunk so that both tall and wide tables are spread over all threads.
+// A chunk is filtered into slices of its runs of selected values rather than a
+// copy if these runs are long (see kMinSliceRunLength).
+Status FilterColumns(FunctionContext* ctx,
+                     const std::vector<const ChunkedArray*>& columns,
+                     const FilterSlicer& slice_filter,
+                     std::vector<std::shared_ptr<ChunkedArray>>* out) {
+  struct ChunkTask {
+    size_t column;
+    int chunk;
+    int64_t offset;
+  };
+  std::vector<ChunkTask> tasks;
+  std::vector<std::vector<ArrayVector>> new_chunks(columns.size());
+  for (size_t j = 0; j < columns.size(); ++j) {
+    int64_t offset = 0;
+    for (int i = 0; i < columns[j]->num_chunks(); ++i) {
+      tasks.push_back({j, i, offset});
+      offset += columns[j]->chunk(i)->length();
+    }
+    new_chunks[j].resize(columns[j]->num_chunks());
   }
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<Array> current_chunk;
-  int64_t offset = 0;
-  int64_t len;
 
-  for (int i = 0; i < num_chunks; i++) {
-    current_chunk = values.chunk(i);
-    len = current_chunk->length();
-    RETURN_NOT_OK(
-        Filter(ctx, *current_chunk, *filter.Slice(offset, len), &new_chunks[i]));
-    offset += len;
+  RETURN_NOT_OK(detail::ParallelForTasks(
+      ctx, static_cast<int>(tasks.size()), [&](FunctionContext* task_ctx, int t) {
+        const ChunkTask& task = tasks[t];
+        const auto& chunk = columns[task.column]->chunk(task.chunk);
+        auto* out_chunks = &new_chunks[task.column][task.chunk];
+        if (chunk->length() == 0) {
+          // Put a zero length array there, which we know our current chunk to be
+          out_chunks->push_back(chunk);
+          return Status::OK();
+        }
+        std::shared_ptr<Array> filter;
+        RETURN_NOT_OK(slice_filter(task.offset, chunk->length(), &filter));
+        ARROW_ASSIGN_OR_RAISE(auto filter_array, GetFilterArray(Datum(filter->data())));
+
+        auto runs = GetFilterRuns(*filter_array, kMinSliceRunLength);
+        if (runs.sliceable && !runs.runs.empty()) {
+          for (const auto& run : runs.runs) {
+            out_chunks->push_back(chunk->Slice(run.first, run.second));
+          }
+          return Status::OK();
+        }
+        std::unique_ptr<FilterKernel> kernel;
+        RETURN_NOT_OK(FilterKernel::Make(chunk->type(), &kernel));
+        std::shared_ptr<Array> out_chunk;
+        RETURN_NOT_OK(
+            kernel->Filter(task_ctx, *chunk, *filter_array, runs.out_length, &out_chunk));
+        out_chunks->push_back(std::move(out_chunk));
+        return Status::OK();
+      }));
+
+  out->resize(columns.size());
+  for (size_t j = 0; j < columns.size(); ++j) {
+    ArrayVector chunks;
+    for (auto& chunk_slices : new_chunks[j]) {
+      for (auto& slice : chunk_slices) {
+        chunks.push_back(std::move(slice));
+      }
+    }
+    (*out)[j] = std::make_shared<ChunkedArray>(std::move(chunks), columns[j]->type());
   }
-
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
   return Status::OK();
 }
 
-Status Filter(FunctionContext* ctx, const ChunkedArray& values,
-              const ChunkedArray& filter, std::shared_ptr<ChunkedArray>* out) {
+FilterSlicer SliceFilter(const Array& filter) {
+  return [&filter](int64_t offset, int64_t length, std::shared_ptr<Array>* out) {
+    *out = filter.Slice(offset, length);
+    return Status::OK();
+  };
+}
+
+FilterSlicer SliceFilter(const ChunkedArray& filter) {
+  return [&filter](int64_t offset, int64_t length, std::shared_ptr<Array>* out) {
+    auto chunked_filter = filter.Slice(offset, length);
+    if (chunked_filter->num_chunks() == 1) {
+      *out = chunked_filter->chunk(0);
+      return Status::OK();
+    }
+    // Concatenate the chunks of the filter so we have an Array
+    return Concatenate(chunked_filter->chunks(), default_memory_pool(), out);
+  };
+}
+
+template <typename FilterType>
+Status FilterChunkedArray(FunctionContext* ctx, const ChunkedArray& values,
+                          const FilterType& filter, std::shared_ptr<ChunkedArray>* out) {
   if (values.length() != filter.length()) {
     return Status::Invalid("filter and value array must have identical lengths");
   }
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<Array> current_chunk;
-  std::shared_ptr<ChunkedArray> current_chunked_filter;
-  std::shared_ptr<Array> current_filter;
-  int64_t offset = 0;
-  int64_t len;
-
-  for (int i = 0; i < num_chunks; i++) {
-    current_chunk = values.chunk(i);
-    len = current_chunk->length();
-    if (len > 0) {
-      current_chunked_filter = filter.Slice(offset, len);
-      if (current_chunked_filter->num_chunks() == 1) {
-        current_filter = current_chunked_filter->chunk(0);
-      } else {
-        // Concatenate the chunks of the filter so we have an Array
-        RETURN_NOT_OK(Concatenate(current_chunked_filter->chunks(), default_memory_pool(),
-                                  &current_filter));
-      }
-      RETURN_NOT_OK(Filter(ctx, *current_chunk, *current_filter, &new_chunks[i]));
-      offset += len;
-    } else {
-      // Put a zero length array there, which we know our current chunk to be
-      new_chunks[i] = current_chunk;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(FilterColumns(ctx, {&values}, SliceFilter(filter), &columns));
+  *out = std::move(columns[0]);
+  return Status::OK();
+}
+
+template <typename FilterType>
+Status FilterTable(FunctionContext* ctx, const Table& table, const FilterType& filter,
+                   std::shared_ptr<Table>* out) {
+  std::vector<const ChunkedArray*> in_columns;
+  for (const auto& column : table.columns()) {
+    if (column->length() != filter.length()) {
+      return Status::Invalid("filter and value array must have identical lengths");
     }
+    in_columns.push_back(column.get());
   }
-
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(FilterColumns(ctx, in_columns, SliceFilter(filter), &columns));
+  *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
 
-Status Filter(FunctionContext* ctx, const Table& table, const Array& filter,
-              std::shared_ptr<Table>* out) {
-  auto ncols = table.num_columns();
+}  // namespace
 
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
+Status Filter(FunctionContext* ctx, const ChunkedArray& values, const Array& filter,
+              std::shared_ptr<ChunkedArray>* out) {
+  return FilterChunkedArray(ctx, values, filter, out);
+}
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Filter(ctx, *table.column(j), filter, &columns[j]));
-  }
-  *out = Table::Make(table.schema(), columns);
-  return Status::OK();
+Status Filter(FunctionContext* ctx, const ChunkedArray& values,
+              const ChunkedArray& filter, std::shared_ptr<ChunkedArray>* out) {
+  return FilterChunkedArray(ctx, values, filter, out);
 }
 
-Status Filter(FunctionContext* ctx, const Table& table, const ChunkedArray& filter,
+Status Filter(FunctionContext* ctx, const Table& table, const Array& filter,
               std::shared_ptr<Table>* out) {
-  auto ncols = table.num_columns();
-
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
+  return FilterTable(ctx, table, filter, out);
+}
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Filter(ctx, *table.column(j), filter, &columns[j]));
-  }
-  *out = Table::Make(table.schema(), columns);
-  return Status::OK();
+Status Filter(FunctionContext* ctx, const Table& table, const ChunkedArray& filter,
+              std::shared_ptr<Table>* out) {
+  return FilterTable(ctx, table, filter, out);
 }
 
 }  // namespace compute
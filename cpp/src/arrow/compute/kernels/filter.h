@@ -42,6 +42,9 @@ class FunctionContext;
 /// filter = [0, 1, 1, 0, null, 1], the output will be
 /// = ["b", "c", null, "f"]
 ///
+/// If the filter has no nulls and selects a single run of consecutive values,
+/// the output is a zero-copy slice of the values.
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] values array to filter
 /// \param[in] filter indicates which values should be filtered out
@@ -60,6 +63,9 @@ Status Filter(FunctionContext* ctx, const Array& values, const Array& filter,
 /// filter = [0, 1, 1, 0, null, 1], the output will be
 /// = ["b", "c", null, "f"]
 ///
+/// Chunks whose selected values form long runs are filtered into zero-copy
+/// slices of these runs, so the output may have more chunks than the input.
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] values chunked array to filter
 /// \param[in] filter indicates which values should be filtered out
@@ -142,6 +148,28 @@ Status Filter(FunctionContext* ctx, const Table& table, const ChunkedArray& filt
 ARROW_EXPORT
 Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter, Datum* out);
 
+/// \brief Compute the selection vector of a boolean selection filter
+///
+/// The selection vector is an Int64Array of the positions where the filter is
+/// not 0, and null where the filter is null, such that taking it from values
+/// (see Take) is filtering them.  It can be computed once and taken from many
+/// arrays, and selections compose without materializing the intermediate
+/// values: if selection2 is the selection vector of a filter of the values
+/// selected by selection, Take(selection, selection2) selects the same values
+/// from the original array.  Sum and Compare accept a selection vector to
+/// compute over the selected values without taking them.
+///
+/// For example given filter = [0, 1, 1, 0, null, 1], the output will be
+/// = [1, 2, null, 5]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] filter indicates which values should be filtered out
+/// \param[out] out resulting selection vector
+/// NOTE: Experimental API
+ARROW_EXPORT
+Status GetSelectionVector(FunctionContext* ctx, const Array& filter,
+                          std::shared_ptr<Array>* out);
+
 /// \brief BinaryKernel implementing Filter operation
 class ARROW_EXPORT FilterKernel : public BinaryKernel {
  public:
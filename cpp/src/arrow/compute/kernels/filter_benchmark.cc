@@ -19,6 +19,7 @@
 
 #include "arrow/compute/kernels/filter.h"
 
+#include "arrow/builder.h"
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -92,6 +93,45 @@ static void FilterString(benchmark::State& state) {
   }
 }
 
+// A chunked array filtered by runs of 4096 selected values, which are sliced
+static void FilterChunkedInt64LongRuns(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Int64(array_size, -100, 100, args.null_proportion);
+  auto chunked_array = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, array_size / 2), array->Slice(array_size / 2)});
+  BooleanBuilder builder;
+  for (int64_t i = 0; i < array_size; ++i) {
+    ABORT_NOT_OK(builder.Append((i / 4096) % 4 != 0));
+  }
+  std::shared_ptr<Array> filter;
+  ABORT_NOT_OK(builder.Finish(&filter));
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<ChunkedArray> out;
+    ABORT_NOT_OK(Filter(&ctx, *chunked_array, *filter, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void SelectionVector(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto filter = rand.Boolean(array_size, 0.75, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(GetSelectionVector(&ctx, *filter, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
 BENCHMARK(FilterInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -113,5 +153,15 @@ BENCHMARK(FilterString)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(FilterChunkedInt64LongRuns)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 23, 0})
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(SelectionVector)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 23, 1})
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 }  // namespace compute
 }  // namespace arrow
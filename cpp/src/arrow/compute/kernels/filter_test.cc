@@ -24,6 +24,7 @@
 #include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -573,6 +574,19 @@ TEST_F(TestFilterKernelWithChunkedArray, FilterChunkedArray) {
                                                       {"[0, 1, 0]", "[1, 1]"}, &arr));
 }
 
+TEST_F(TestFilterKernelWithChunkedArray, FilterChunkedArrayThreaded) {
+  this->ctx_.set_use_threads(true);
+  this->AssertFilter(int8(), {"[]"}, "[]", {"[]"});
+  this->AssertFilter(int8(), {"[7]", "[]", "[8, 9]", "[10, 11]"}, "[0, 1, 0, 1, 1]",
+                     {"[]", "[]", "[8]", "[10, 11]"});
+  this->AssertChunkedFilter(int8(), {"[7]", "[]", "[8, 9]", "[10, 11]"},
+                            {"[0, 1]", "[0, 1, 1]"}, {"[]", "[]", "[8]", "[10, 11]"});
+
+  std::shared_ptr<ChunkedArray> arr;
+  ASSERT_RAISES(
+      Invalid, this->FilterWithArray(int8(), {"[7]", "[8, 9]"}, "[0, 1, 0, 1, 1]", &arr));
+}
+
 class TestFilterKernelWithTable : public TestFilterKernel<Table> {
  public:
   void AssertFilter(const std::shared_ptr<Schema>& schm,
@@ -629,6 +643,153 @@ TEST_F(TestFilterKernelWithTable, FilterTable) {
   this->AssertChunkedFilter(schm, table_json, {"[0, 1, 1]", "[null]"}, expected2);
   this->AssertFilter(schm, table_json, "[1, 1, 1, 1]", table_json);
   this->AssertChunkedFilter(schm, table_json, {"[1]", "[1, 1, 1]"}, table_json);
+
+  this->ctx_.set_use_threads(true);
+  this->AssertFilter(schm, table_json, "[0, 1, 1, null]", expected2);
+  this->AssertChunkedFilter(schm, table_json, {"[0, 1, 1]", "[null]"}, expected2);
+}
+
+class TestFilterKernelSlicing : public TestFilterKernel<Int32Type> {
+ protected:
+  // A filter of the given length selecting [start, end) of each of the runs
+  std::shared_ptr<Array> RunsFilter(
+      int64_t length, const std::vector<std::pair<int64_t, int64_t>>& runs) {
+    BooleanBuilder builder;
+    ABORT_NOT_OK(builder.AppendValues(length, false));
+    std::shared_ptr<Array> filter;
+    ABORT_NOT_OK(builder.Finish(&filter));
+    auto bits = filter->data()->buffers[1]->mutable_data();
+    for (const auto& run : runs) {
+      for (int64_t i = run.first; i < run.second; ++i) {
+        BitUtil::SetBit(bits, i);
+      }
+    }
+    return filter;
+  }
+
+  void AssertSharesValues(const Array& values, const Array& filtered) {
+    ASSERT_EQ(values.data()->buffers[1], filtered.data()->buffers[1]);
+  }
+};
+
+TEST_F(TestFilterKernelSlicing, SingleRun) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int32(1000, -50, 50, 0.1);
+
+  std::shared_ptr<Array> filtered;
+  for (auto run : std::vector<std::pair<int64_t, int64_t>>{{0, 1000}, {100, 300}}) {
+    auto filter = RunsFilter(1000, {run});
+    ASSERT_OK(arrow::compute::Filter(&this->ctx_, *values, *filter, &filtered));
+    AssertSharesValues(*values, *filtered);
+    AssertArraysEqual(*values->Slice(run.first, run.second - run.first), *filtered);
+    this->ValidateFilter(values, filter);
+  }
+
+  // Sliced filters and values
+  auto filter = RunsFilter(1000, {{50, 400}});
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *values->Slice(10, 500),
+                                   *filter->Slice(10, 500), &filtered));
+  AssertSharesValues(*values, *filtered);
+  AssertArraysEqual(*values->Slice(50, 350), *filtered);
+
+  // Nothing selected
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *values, *RunsFilter(1000, {}),
+                                   &filtered));
+  ASSERT_EQ(filtered->length(), 0);
+
+  // Several runs or nulls in the filter require a copy
+  this->ValidateFilter(values, RunsFilter(1000, {{0, 10}, {20, 30}}));
+  this->ValidateFilter(values, rand.Boolean(1000, 1.0, 0.01));
+}
+
+TEST_F(TestFilterKernelSlicing, RecordBatch) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int32(100, -50, 50, 0.1);
+  auto batch = RecordBatch::Make(schema({field("a", int32())}), 100, {values});
+
+  std::shared_ptr<RecordBatch> filtered;
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *batch, *RunsFilter(100, {{10, 20}}),
+                                   &filtered));
+  ASSERT_EQ(filtered->num_rows(), 10);
+  AssertSharesValues(*values, *filtered->column(0));
+  AssertArraysEqual(*values->Slice(10, 10), *filtered->column(0));
+  ASSERT_RAISES(Invalid, arrow::compute::Filter(&this->ctx_, *batch,
+                                                *RunsFilter(99, {}), &filtered));
+}
+
+TEST_F(TestFilterKernelSlicing, ChunkedArrayLongRuns) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t length = 20000;
+  auto values = rand.Int32(length, -50, 50, 0.1);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{values->Slice(0, 5000), values->Slice(5000, 15000)});
+
+  // Long runs are sliced, including runs spanning chunks
+  auto filter = RunsFilter(length, {{1000, 3000}, {4000, 9000}, {12000, 20000}});
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *values, *filter, &expected));
+
+  for (bool use_threads : {false, true}) {
+    this->ctx_.set_use_threads(use_threads);
+    std::shared_ptr<ChunkedArray> filtered;
+    ASSERT_OK(arrow::compute::Filter(&this->ctx_, *chunked, *filter, &filtered));
+    ASSERT_OK(filtered->ValidateFull());
+    AssertChunkedEqual(ChunkedArray({expected}), *filtered);
+    ASSERT_EQ(filtered->num_chunks(), 4);
+    for (const auto& chunk : filtered->chunks()) {
+      AssertSharesValues(*values, *chunk);
+    }
+  }
+
+  // Short runs are copied into one chunk per chunk
+  filter = rand.Boolean(length, 0.5, 0);
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *values, *filter, &expected));
+  std::shared_ptr<ChunkedArray> filtered;
+  ASSERT_OK(arrow::compute::Filter(&this->ctx_, *chunked, *filter, &filtered));
+  AssertChunkedEqual(ChunkedArray({expected}), *filtered);
+  ASSERT_EQ(filtered->num_chunks(), 2);
+}
+
+TEST(TestSelectionVector, Basics) {
+  FunctionContext ctx;
+  std::shared_ptr<Array> selection;
+  ASSERT_OK(GetSelectionVector(&ctx, *ArrayFromJSON(boolean(), "[0, 1, 1, 0, null, 1]"),
+                               &selection));
+  ASSERT_OK(selection->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, null, 5]"), *selection);
+
+  ASSERT_OK(GetSelectionVector(&ctx, *ArrayFromJSON(boolean(), "[]"), &selection));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[]"), *selection);
+  ASSERT_OK(GetSelectionVector(
+      &ctx, *ArrayFromJSON(boolean(), "[1, 0, 1, 1, 0, 1]")->Slice(1), &selection));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, 4]"), *selection);
+
+  ASSERT_RAISES(TypeError,
+                GetSelectionVector(&ctx, *ArrayFromJSON(int8(), "[1]"), &selection));
+}
+
+TEST(TestSelectionVector, TakeIsFilter) {
+  FunctionContext ctx;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t length = 5000;
+  auto values = rand.String(length, 0, 10, 0.1);
+  for (double filter_null_probability : {0.0, 0.1}) {
+    auto filter = rand.Boolean(length, 0.3, filter_null_probability);
+    std::shared_ptr<Array> selection, taken, filtered;
+    ASSERT_OK(GetSelectionVector(&ctx, *filter, &selection));
+    ASSERT_OK(Take(&ctx, *values, *selection, TakeOptions(), &taken));
+    ASSERT_OK(Filter(&ctx, *values, *filter, &filtered));
+    AssertArraysEqual(*filtered, *taken);
+
+    // Selections compose without materializing the intermediate values
+    auto filter2 = rand.Boolean(filtered->length(), 0.5, filter_null_probability);
+    std::shared_ptr<Array> selection2, composed, filtered2;
+    ASSERT_OK(GetSelectionVector(&ctx, *filter2, &selection2));
+    ASSERT_OK(Take(&ctx, *selection, *selection2, TakeOptions(), &composed));
+    ASSERT_OK(Take(&ctx, *values, *composed, TakeOptions(), &taken));
+    ASSERT_OK(Filter(&ctx, *filtered, *filter2, &filtered2));
+    AssertArraysEqual(*filtered2, *taken);
+  }
 }
 
 }  // namespace compute
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/dict_internal.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
@@ -39,9 +40,11 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
+#include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -554,9 +557,169 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Parallel hashing of chunked arrays
+
+using GetHashKernel = Status (*)(FunctionContext*, const std::shared_ptr<DataType>&,
+                                 std::unique_ptr<HashKernel>*);
+
+// The results of hashing a range of chunks with a kernel of its own
+struct HashTask {
+  // The kernel output for each chunk
+  std::vector<Datum> outputs;
+  // The final kernel output
+  Datum final_output;
+  std::shared_ptr<Array> dictionary;
+  // The index in the merged dictionary of each value of dictionary
+  std::vector<int32_t> transpose;
+};
+
+// Return the number of tasks to hash chunks with, or 0 if they should be hashed
+// serially
+int NumHashTasks(const FunctionContext& ctx, const std::shared_ptr<DataType>& type,
+                 const ArrayVector& chunks) {
+  const int num_tasks = static_cast<int>(std::min<size_t>(
+      chunks.size(), internal::GetCpuThreadPool()->GetCapacity()));
+  if (!ctx.use_threads() || num_tasks < 2 || type->id() == Type::NA) {
+    return 0;
+  }
+  return num_tasks;
+}
+
+// Unify the task dictionaries in order, computing the transposition of each into
+// the merged dictionary.  Values are added to a DictionaryUnifier in order of
+// their first occurrence in each task, so the merged dictionary has them in order
+// of their first occurrence in the input, as when hashing serially.
+//
+// The unifier doesn't accept nulls, which Unique and ValueCounts memoize like
+// values: the values on each side of a null are unified separately, and the
+// first null seen is inserted at its position in the merged dictionary last.
+Status UnifyTaskDictionaries(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                             std::vector<HashTask>* tasks,
+                             std::shared_ptr<Array>* out) {
+  std::unique_ptr<DictionaryUnifier> unifier;
+  RETURN_NOT_OK(DictionaryUnifier::Make(ctx->memory_pool(), type, &unifier));
+
+  int32_t merged_length = 0;
+  int32_t null_index = -1;
+  for (HashTask& task : *tasks) {
+    const Array& dictionary = *task.dictionary;
+    // Null indices of the outputs are zero, keep them in bounds
+    task.transpose.assign(std::max<int64_t>(dictionary.length(), 1), 0);
+
+    auto unify_values = [&](int64_t offset, int64_t length) {
+      if (length == 0) {
+        return Status::OK();
+      }
+      std::shared_ptr<Buffer> transpose;
+      RETURN_NOT_OK(unifier->Unify(*dictionary.Slice(offset, length), &transpose));
+      auto indices = reinterpret_cast<const int32_t*>(transpose->data());
+      for (int64_t i = 0; i < length; ++i) {
+        task.transpose[offset + i] = indices[i];
+        merged_length = std::max(merged_length, indices[i] + 1);
+      }
+      return Status::OK();
+    };
+
+    int64_t null_position = -1;
+    for (int64_t i = 0; i < dictionary.length() && dictionary.null_count() > 0; ++i) {
+      if (dictionary.IsNull(i)) {
+        null_position = i;
+        break;
+      }
+    }
+    if (null_position < 0) {
+      RETURN_NOT_OK(unify_values(0, dictionary.length()));
+    } else {
+      RETURN_NOT_OK(unify_values(0, null_position));
+      if (null_index < 0) {
+        null_index = merged_length;
+      }
+      task.transpose[null_position] = -1;
+      RETURN_NOT_OK(
+          unify_values(null_position + 1, dictionary.length() - null_position - 1));
+    }
+  }
+
+  std::shared_ptr<DataType> unused_type;
+  std::shared_ptr<Array> values;
+  RETURN_NOT_OK(unifier->GetResult(&unused_type, &values));
+  if (null_index < 0) {
+    *out = values;
+    return Status::OK();
+  }
+
+  for (HashTask& task : *tasks) {
+    for (int32_t& index : task.transpose) {
+      index = index < 0 ? null_index : index + (index >= null_index);
+    }
+  }
+  std::shared_ptr<Array> null;
+  RETURN_NOT_OK(MakeArrayOfNull(ctx->memory_pool(), type, 1, &null));
+  return Concatenate({values->Slice(0, null_index), null, values->Slice(null_index)},
+                     ctx->memory_pool(), out);
+}
+
+// Hash contiguous ranges of chunks in parallel, each with a memo table of its
+// own, then merge their dictionaries
+Status ParallelHash(FunctionContext* ctx, GetHashKernel get_kernel,
+                    const std::shared_ptr<DataType>& type, const ArrayVector& chunks,
+                    int num_tasks, std::vector<HashTask>* tasks,
+                    std::shared_ptr<Array>* dictionary) {
+  tasks->resize(num_tasks);
+  RETURN_NOT_OK(detail::ParallelForTasks(
+      ctx, num_tasks, [&](FunctionContext* task_ctx, int t) {
+        std::unique_ptr<HashKernel> kernel;
+        RETURN_NOT_OK(get_kernel(task_ctx, type, &kernel));
+        HashTask& task = (*tasks)[t];
+        const size_t begin = chunks.size() * t / num_tasks;
+        const size_t end = chunks.size() * (t + 1) / num_tasks;
+        for (size_t i = begin; i < end; ++i) {
+          Datum out;
+          out.value = ArrayData::Make(kernel->out_type(), chunks[i]->length());
+          RETURN_NOT_OK(kernel->Call(task_ctx, chunks[i], &out));
+          task.outputs.push_back(std::move(out));
+        }
+        std::shared_ptr<ArrayData> dict_data;
+        RETURN_NOT_OK(kernel->GetDictionary(&dict_data));
+        task.dictionary = MakeArray(dict_data);
+        return kernel->FlushFinal(&task.final_output);
+      }));
+  return UnifyTaskDictionaries(ctx, type, tasks, dictionary);
+}
+
+// Split the values of an array-like datum into morsels to hash in parallel
+ArrayVector HashMorsels(const FunctionContext& ctx, const Datum& value) {
+  if (value.kind() == Datum::ARRAY) {
+    return detail::SplitMorsels(ctx, {value.make_array()});
+  }
+  if (value.kind() == Datum::CHUNKED_ARRAY) {
+    return detail::SplitMorsels(ctx, value.chunked_array()->chunks());
+  }
+  return {};
+}
+
+Status MakeValueCounts(const std::shared_ptr<Array>& uniques,
+                       const std::shared_ptr<Array>& counts,
+                       std::shared_ptr<Array>* out) {
+  auto data_type = std::make_shared<StructType>(std::vector<std::shared_ptr<Field>>{
+      std::make_shared<Field>(kValuesFieldName, uniques->type()),
+      std::make_shared<Field>(kCountsFieldName, int64())});
+  *out = std::make_shared<StructArray>(
+      data_type, uniques->length(), std::vector<std::shared_ptr<Array>>{uniques, counts});
+  return Status::OK();
+}
+
 }  // namespace
 
 Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
+  const ArrayVector morsels = HashMorsels(*ctx, value);
+  if (int num_tasks = NumHashTasks(*ctx, value.type(), morsels)) {
+    std::vector<HashTask> tasks;
+    return ParallelHash(ctx, GetUniqueKernel, value.type(), morsels, num_tasks, &tasks,
+                        out);
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
 
@@ -565,14 +728,48 @@ Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>*
 }
 
 Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
-  std::unique_ptr<HashKernel> func;
-  RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
-
   std::shared_ptr<Array> dict;
   std::vector<Datum> indices_outputs;
-  RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &indices_outputs, &dict));
 
-  auto dict_type = dictionary(func->out_type(), dict->type());
+  // Chunks aren't split into morsels, so that the output has the same chunks
+  const ArrayVector chunks = value.kind() == Datum::CHUNKED_ARRAY
+                                 ? value.chunked_array()->chunks()
+                                 : ArrayVector{};
+  if (int num_tasks = NumHashTasks(*ctx, value.type(), chunks)) {
+    std::vector<HashTask> tasks;
+    RETURN_NOT_OK(ParallelHash(ctx, GetDictionaryEncodeKernel, value.type(), chunks,
+                               num_tasks, &tasks, &dict));
+    // Rewrite the indices of each task as indices into the merged dictionary
+    RETURN_NOT_OK(detail::ParallelForTasks(
+        ctx, num_tasks, [&](FunctionContext* task_ctx, int t) {
+          for (Datum& output : tasks[t].outputs) {
+            const ArrayData& indices = *output.array();
+            DCHECK_EQ(indices.offset, 0);
+            std::shared_ptr<Buffer> transposed;
+            RETURN_NOT_OK(
+                task_ctx->Allocate(indices.length * sizeof(int32_t), &transposed));
+            internal::TransposeInts(
+                indices.GetValues<int32_t>(1),
+                reinterpret_cast<int32_t*>(transposed->mutable_data()), indices.length,
+                tasks[t].transpose.data());
+            output.value =
+                ArrayData::Make(indices.type, indices.length,
+                                {indices.buffers[0], std::move(transposed)},
+                                indices.null_count);
+          }
+          return Status::OK();
+        }));
+    for (HashTask& task : tasks) {
+      indices_outputs.insert(indices_outputs.end(), task.outputs.begin(),
+                             task.outputs.end());
+    }
+  } else {
+    std::unique_ptr<HashKernel> func;
+    RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
+    RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &indices_outputs, &dict));
+  }
+
+  auto dict_type = dictionary(int32(), dict->type());
 
   // Wrap indices in dictionary arrays for result
   std::vector<std::shared_ptr<Array>> dict_chunks;
@@ -592,6 +789,27 @@ const int32_t kCountsFieldIndex = 1;
 
 Status ValueCounts(FunctionContext* ctx, const Datum& value,
                    std::shared_ptr<Array>* counts) {
+  const ArrayVector morsels = HashMorsels(*ctx, value);
+  if (int num_tasks = NumHashTasks(*ctx, value.type(), morsels)) {
+    std::vector<HashTask> tasks;
+    std::shared_ptr<Array> uniques;
+    RETURN_NOT_OK(ParallelHash(ctx, GetValueCountsKernel, value.type(), morsels,
+                               num_tasks, &tasks, &uniques));
+    // Add up the counts of each task into the merged counts
+    std::shared_ptr<Buffer> merged_buffer;
+    RETURN_NOT_OK(ctx->Allocate(uniques->length() * sizeof(int64_t), &merged_buffer));
+    auto merged = reinterpret_cast<int64_t*>(merged_buffer->mutable_data());
+    std::fill(merged, merged + uniques->length(), 0);
+    for (const HashTask& task : tasks) {
+      const int64_t* task_counts = task.final_output.array()->GetValues<int64_t>(1);
+      for (int64_t i = 0; i < task.dictionary->length(); ++i) {
+        merged[task.transpose[i]] += task_counts[i];
+      }
+    }
+    return MakeValueCounts(
+        uniques, std::make_shared<Int64Array>(uniques->length(), merged_buffer), counts);
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetValueCountsKernel(ctx, value.type(), &func));
 
@@ -602,13 +820,91 @@ Status ValueCounts(FunctionContext* ctx, const Datum& value,
 
   Datum value_counts;
   RETURN_NOT_OK(func->FlushFinal(&value_counts));
+  return MakeValueCounts(uniques, MakeArray(value_counts.array()), counts);
+}
 
-  auto data_type = std::make_shared<StructType>(std::vector<std::shared_ptr<Field>>{
-      std::make_shared<Field>(kValuesFieldName, uniques->type()),
-      std::make_shared<Field>(kCountsFieldName, int64())});
-  *counts = std::make_shared<StructArray>(
-      data_type, uniques->length(),
-      std::vector<std::shared_ptr<Array>>{uniques, MakeArray(value_counts.array())});
+// ----------------------------------------------------------------------
+// Incremental hashing
+
+namespace {
+
+class DictionaryEncoderImpl : public DictionaryEncoder {
+ public:
+  DictionaryEncoderImpl(FunctionContext* ctx, std::shared_ptr<DataType> type,
+                        std::unique_ptr<HashKernel> kernel)
+      : ctx_(ctx), type_(std::move(type)), kernel_(std::move(kernel)) {}
+
+  Status Encode(const Datum& values, Datum* out) override {
+    if (!values.type()->Equals(*type_)) {
+      return Status::TypeError("Cannot dictionary-encode ", *values.type(),
+                               " values with an encoder of ", *type_, " values");
+    }
+    std::vector<Datum> indices_outputs;
+    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx_, kernel_.get(), values,
+                                                 &indices_outputs));
+    *out = detail::WrapDatumsLike(values, kernel_->out_type(), indices_outputs);
+    return Status::OK();
+  }
+
+  Status GetDictionary(std::shared_ptr<Array>* out) override {
+    std::shared_ptr<ArrayData> dict_data;
+    RETURN_NOT_OK(kernel_->GetDictionary(&dict_data));
+    *out = MakeArray(dict_data);
+    return Status::OK();
+  }
+
+ private:
+  FunctionContext* ctx_;
+  std::shared_ptr<DataType> type_;
+  std::unique_ptr<HashKernel> kernel_;
+};
+
+class ValueCounterImpl : public ValueCounter {
+ public:
+  ValueCounterImpl(FunctionContext* ctx, std::shared_ptr<DataType> type,
+                   std::unique_ptr<HashKernel> kernel)
+      : ctx_(ctx), type_(std::move(type)), kernel_(std::move(kernel)) {}
+
+  Status Consume(const Datum& values) override {
+    if (!values.type()->Equals(*type_)) {
+      return Status::TypeError("Cannot count ", *values.type(),
+                               " values with a counter of ", *type_, " values");
+    }
+    std::vector<Datum> unused_outputs;
+    return detail::InvokeUnaryArrayKernel(ctx_, kernel_.get(), values, &unused_outputs);
+  }
+
+  Status Finish(std::shared_ptr<Array>* counts) override {
+    std::shared_ptr<ArrayData> dict_data;
+    RETURN_NOT_OK(kernel_->GetDictionary(&dict_data));
+    Datum value_counts;
+    RETURN_NOT_OK(kernel_->FlushFinal(&value_counts));
+    return MakeValueCounts(MakeArray(dict_data), MakeArray(value_counts.array()),
+                           counts);
+  }
+
+ private:
+  FunctionContext* ctx_;
+  std::shared_ptr<DataType> type_;
+  std::unique_ptr<HashKernel> kernel_;
+};
+
+}  // namespace
+
+Status DictionaryEncoder::Make(FunctionContext* ctx,
+                               const std::shared_ptr<DataType>& type,
+                               std::unique_ptr<DictionaryEncoder>* out) {
+  std::unique_ptr<HashKernel> kernel;
+  RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, type, &kernel));
+  out->reset(new DictionaryEncoderImpl(ctx, type, std::move(kernel)));
+  return Status::OK();
+}
+
+Status ValueCounter::Make(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                          std::unique_ptr<ValueCounter>* out) {
+  std::unique_ptr<HashKernel> kernel;
+  RETURN_NOT_OK(GetValueCountsKernel(ctx, type, &kernel));
+  out->reset(new ValueCounterImpl(ctx, type, std::move(kernel)));
   return Status::OK();
 }
 
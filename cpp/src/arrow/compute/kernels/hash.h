@@ -37,6 +37,10 @@ class FunctionContext;
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
 ///
+/// If the FunctionContext allows threads, ranges of chunks (or morsels of large
+/// chunks) are hashed in parallel and their unique values merged afterwards.  The
+/// result is the same, with values in order of first occurrence.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] datum array-like input
 /// \param[out] out result as Array
@@ -59,6 +63,9 @@ ARROW_EXPORT extern const int32_t kCountsFieldIndex;
 /// For floating point arrays there is no attempt to normalize -0.0, 0.0 and NaN values
 /// which can lead to unexpected results if the input Array has these values.
 ///
+/// If the FunctionContext allows threads, the input is hashed in parallel like
+/// in Unique().
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value array-like input
 /// \param[out] counts An array of  <input type "Values", int64_t "Counts"> structs.
@@ -70,6 +77,11 @@ Status ValueCounts(FunctionContext* context, const Datum& value,
                    std::shared_ptr<Array>* counts);
 
 /// \brief Dictionary-encode values in an array-like object
+///
+/// If the FunctionContext allows threads, the chunks of a ChunkedArray are
+/// encoded in parallel against dictionaries of their own, which are then merged
+/// and the indices transposed.  The result is the same.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] data array-like input
 /// \param[out] out result with same shape and type as input
@@ -79,7 +91,57 @@ Status ValueCounts(FunctionContext* context, const Datum& value,
 ARROW_EXPORT
 Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out);
 
-// TODO(wesm): Define API for incremental dictionary encoding
+/// \brief Dictionary-encode arrays received one at a time
+///
+/// All arrays are encoded against the same dictionary, which grows as new
+/// values are seen: the dictionary after a call to Encode() extends the
+/// dictionary after any previous call.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT DictionaryEncoder {
+ public:
+  virtual ~DictionaryEncoder() = default;
+
+  /// \brief Construct a DictionaryEncoder
+  /// \param[in] context the FunctionContext, which must outlive the encoder
+  /// \param[in] type the data type of the values to encode
+  /// \param[out] out the constructed encoder
+  static Status Make(FunctionContext* context, const std::shared_ptr<DataType>& type,
+                     std::unique_ptr<DictionaryEncoder>* out);
+
+  /// \brief Dictionary-encode array-like values
+  /// \param[in] values values of the type given to Make()
+  /// \param[out] out int32 indices into the dictionary, with the shape of values
+  virtual Status Encode(const Datum& values, Datum* out) = 0;
+
+  /// \brief Return the dictionary of all values encoded so far
+  virtual Status GetDictionary(std::shared_ptr<Array>* out) = 0;
+};
+
+/// \brief Count the unique values of arrays received one at a time
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT ValueCounter {
+ public:
+  virtual ~ValueCounter() = default;
+
+  /// \brief Construct a ValueCounter
+  /// \param[in] context the FunctionContext, which must outlive the counter
+  /// \param[in] type the data type of the values to count
+  /// \param[out] out the constructed counter
+  static Status Make(FunctionContext* context, const std::shared_ptr<DataType>& type,
+                     std::unique_ptr<ValueCounter>* out);
+
+  /// \brief Count array-like values of the type given to Make()
+  virtual Status Consume(const Datum& values) = 0;
+
+  /// \brief Return the counts of the unique values of all arrays consumed, like
+  /// ValueCounts(); the unique values are the kValuesFieldIndex field. The counter
+  /// cannot be used after this is called
+  virtual Status Finish(std::shared_ptr<Array>* counts) = 0;
+};
 
 // TODO(wesm): Define API for regularizing DictionaryArray objects with
 // different dictionaries
@@ -34,10 +34,12 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -669,5 +671,115 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+// Run the parallel code paths even on machines with few cores
+class ScopedThreadPoolCapacity {
+ public:
+  explicit ScopedThreadPoolCapacity(int min_capacity)
+      : capacity_(internal::GetCpuThreadPool()->GetCapacity()) {
+    ABORT_NOT_OK(
+        internal::GetCpuThreadPool()->SetCapacity(std::max(capacity_, min_capacity)));
+  }
+  ~ScopedThreadPoolCapacity() {
+    ABORT_NOT_OK(internal::GetCpuThreadPool()->SetCapacity(capacity_));
+  }
+
+ private:
+  int capacity_;
+};
+
+void CheckThreadedLikeSerial(const Datum& values) {
+  FunctionContext serial_ctx, threaded_ctx;
+  threaded_ctx.set_use_threads(true);
+
+  std::shared_ptr<Array> expected, actual;
+  ASSERT_OK(Unique(&serial_ctx, values, &expected));
+  ASSERT_OK(Unique(&threaded_ctx, values, &actual));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*expected, *actual);
+
+  ASSERT_OK(ValueCounts(&serial_ctx, values, &expected));
+  ASSERT_OK(ValueCounts(&threaded_ctx, values, &actual));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*expected, *actual);
+
+  Datum expected_encoded, actual_encoded;
+  ASSERT_OK(DictionaryEncode(&serial_ctx, values, &expected_encoded));
+  ASSERT_OK(DictionaryEncode(&threaded_ctx, values, &actual_encoded));
+  if (values.kind() == Datum::CHUNKED_ARRAY) {
+    ASSERT_OK(actual_encoded.chunked_array()->ValidateFull());
+    AssertChunkedEqual(*expected_encoded.chunked_array(),
+                       *actual_encoded.chunked_array());
+  } else {
+    AssertArraysEqual(*expected_encoded.make_array(), *actual_encoded.make_array());
+  }
+}
+
+TEST_F(TestHashKernel, ChunkedArrayThreaded) {
+  ScopedThreadPoolCapacity capacity(4);
+
+  // Nulls first seen in various tasks, and chunks without values
+  for (const auto& chunks : std::vector<std::vector<std::string>>{
+           {R"(["a", "b"])", R"(["c", null, "a"])", R"([null, "d"])", R"(["b"])"},
+           {R"([null, null])", R"(["a", "b"])", R"(["b", null])", R"(["c"])"},
+           {R"(["a", "b"])", R"([])", R"(["b", "c"])", R"(["d", null])", R"([])"},
+           {R"(["a"])", R"(["a"])", R"(["a"])", R"(["a"])", R"(["a", "b"])"}}) {
+    CheckThreadedLikeSerial(ChunkedArrayFromJSON(utf8(), chunks));
+  }
+  CheckThreadedLikeSerial(
+      ChunkedArrayFromJSON(boolean(), {"[true, null]", "[false]", "[null, true]"}));
+
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  auto strings = rand.String(1000, 0, 3, /*null_probability=*/0.1);
+  CheckThreadedLikeSerial(std::make_shared<ChunkedArray>(
+      ArrayVector{strings->Slice(0, 1), strings->Slice(1, 199), strings->Slice(200, 0),
+                  strings->Slice(200, 450), strings->Slice(650)}));
+
+  // A long array is split into morsels by Unique and ValueCounts
+  auto ints = rand.Int32(1 << 18, 0, 1000, /*null_probability=*/0.01);
+  CheckThreadedLikeSerial(ints);
+  CheckThreadedLikeSerial(std::make_shared<ChunkedArray>(ArrayVector{ints}));
+}
+
+TEST_F(TestHashKernel, DictionaryEncoder) {
+  std::unique_ptr<DictionaryEncoder> encoder;
+  ASSERT_OK(DictionaryEncoder::Make(&this->ctx_, utf8(), &encoder));
+
+  Datum indices;
+  std::shared_ptr<Array> dict;
+  ASSERT_OK(encoder->Encode(ArrayFromJSON(utf8(), R"(["b", null, "a", "b"])"), &indices));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, null, 1, 0]"), *indices.make_array());
+  ASSERT_OK(encoder->GetDictionary(&dict));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["b", "a"])"), *dict);
+
+  ASSERT_OK(encoder->Encode(ChunkedArrayFromJSON(utf8(), {R"(["c", "a"])", R"(["d"])"}),
+                            &indices));
+  ASSERT_EQ(indices.kind(), Datum::CHUNKED_ARRAY);
+  AssertChunkedEqual(*ChunkedArrayFromJSON(int32(), {"[2, 1]", "[3]"}),
+                     *indices.chunked_array());
+  ASSERT_OK(encoder->GetDictionary(&dict));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["b", "a", "c", "d"])"), *dict);
+
+  ASSERT_RAISES(TypeError, encoder->Encode(ArrayFromJSON(binary(), "[]"), &indices));
+  ASSERT_RAISES(NotImplemented, DictionaryEncoder::Make(&this->ctx_, list(utf8()),
+                                                        &encoder));
+}
+
+TEST_F(TestHashKernel, ValueCounter) {
+  std::unique_ptr<ValueCounter> counter;
+  ASSERT_OK(ValueCounter::Make(&this->ctx_, int64(), &counter));
+  ASSERT_OK(counter->Consume(ArrayFromJSON(int64(), "[5, null, 3, 5]")));
+  ASSERT_OK(counter->Consume(ChunkedArrayFromJSON(int64(), {"[3, 7]", "[null, 5]"})));
+  ASSERT_RAISES(TypeError, counter->Consume(ArrayFromJSON(int32(), "[1]")));
+
+  std::shared_ptr<Array> counts;
+  ASSERT_OK(counter->Finish(&counts));
+  ASSERT_OK(counts->ValidateFull());
+  auto counts_struct = std::dynamic_pointer_cast<StructArray>(counts);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[5, null, 3, 7]"),
+                    *counts_struct->field(kValuesFieldIndex));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[3, 2, 2, 1]"),
+                    *counts_struct->field(kCountsFieldIndex));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -21,6 +21,7 @@
 
 #include "arrow/compute/kernels/aggregate.h"
 #include "arrow/compute/kernels/minmax.h"
+#include "arrow/compute/kernels/sum_internal.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 
@@ -87,20 +88,10 @@ class MinMaxAggregateFunction final
     const auto values =
         checked_cast<const typename TypeTraits<ArrowType>::ArrayType&>(array)
             .raw_values();
-    if (array.null_count() != 0) {
-      internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
-                                    array.length());
-      for (int64_t i = 0; i < array.length(); i++) {
-        if (reader.IsSet()) {
-          local.MergeOne(values[i]);
-        }
-        reader.Next();
-      }
-    } else {
-      for (int64_t i = 0; i < array.length(); i++) {
-        local.MergeOne(values[i]);
-      }
-    }
+    VisitValidityBlocks(
+        array, values,
+        [&](const c_type* block, uint64_t bits) { ConsumeBlock(block, bits, &local); },
+        [&](c_type value) { local.MergeOne(value); });
     *state = local;
     return Status::OK();
   }
@@ -120,6 +111,46 @@ class MinMaxAggregateFunction final
   }
 
  private:
+  using c_type = typename ArrowType::c_type;
+
+  // The number of independent min and max accumulators of a block, which the
+  // compiler can map onto SIMD registers
+  static constexpr int64_t kLanes = 8;
+
+  // NaNs never compare less or greater than the current extremes, so they are
+  // ignored like nulls
+  void ConsumeBlock(const c_type* values, uint64_t bits, StateType* state) const {
+    const StateType init;
+    c_type mins[kLanes], maxs[kLanes];
+    std::fill(mins, mins + kLanes, init.min);
+    std::fill(maxs, maxs + kLanes, init.max);
+    if (bits == ~uint64_t(0)) {
+      for (int64_t i = 0; i < kValidityBlockSize; i += kLanes) {
+        for (int64_t j = 0; j < kLanes; j++) {
+          const c_type value = values[i + j];
+          mins[j] = value < mins[j] ? value : mins[j];
+          maxs[j] = value > maxs[j] ? value : maxs[j];
+        }
+      }
+    } else {
+      for (int64_t i = 0; i < kValidityBlockSize; i += kLanes) {
+        for (int64_t j = 0; j < kLanes; j++) {
+          const bool valid = (bits >> (i + j)) & 1;
+          const c_type value = values[i + j];
+          mins[j] = valid && value < mins[j] ? value : mins[j];
+          maxs[j] = valid && value > maxs[j] ? value : maxs[j];
+        }
+      }
+    }
+
+    StateType block;
+    for (int64_t j = 0; j < kLanes; j++) {
+      block.min = mins[j];
+      block.max = maxs[j];
+      *state += block;
+    }
+  }
+
   MinMaxOptions options_;
 };
 
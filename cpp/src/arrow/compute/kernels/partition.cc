@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/partition.h"
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/row_hash.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+
+namespace {
+
+// Compute the row indices of all partitions in a single array, ordered by
+// partition then row (a counting sort of the rows by partition), and the offset
+// of each partition in it
+template <typename IndexType>
+Status GroupByPartition(FunctionContext* ctx, const UInt64Array& hashes_array,
+                        int32_t num_partitions, std::shared_ptr<Array>* out,
+                        std::vector<int64_t>* offsets) {
+  using IndexCType = typename IndexType::c_type;
+  const int64_t num_rows = hashes_array.length();
+  const uint64_t* hashes = hashes_array.raw_values();
+
+  // Map the high bits of the hashes to [0, num_partitions) without a division
+  std::vector<int32_t> partitions(num_rows);
+  offsets->assign(num_partitions + 1, 0);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    partitions[i] = static_cast<int32_t>(
+        ((hashes[i] >> 32) * static_cast<uint64_t>(num_partitions)) >> 32);
+    ++(*offsets)[partitions[i] + 1];
+  }
+  for (int32_t p = 0; p < num_partitions; ++p) {
+    (*offsets)[p + 1] += (*offsets)[p];
+  }
+
+  std::shared_ptr<Buffer> indices_buffer;
+  RETURN_NOT_OK(ctx->Allocate(num_rows * sizeof(IndexCType), &indices_buffer));
+  auto indices = reinterpret_cast<IndexCType*>(indices_buffer->mutable_data());
+  std::vector<int64_t> positions(offsets->begin(), offsets->end() - 1);
+  for (int64_t i = 0; i < num_rows; ++i) {
+    indices[positions[partitions[i]]++] = static_cast<IndexCType>(i);
+  }
+
+  *out = MakeArray(ArrayData::Make(TypeTraits<IndexType>::type_singleton(), num_rows,
+                                   {nullptr, std::move(indices_buffer)},
+                                   /*null_count=*/0));
+  return Status::OK();
+}
+
+Status ComputePartitionIndices(FunctionContext* ctx, const Array& hashes,
+                               int32_t num_partitions, std::shared_ptr<Array>* indices,
+                               std::vector<int64_t>* offsets) {
+  const auto& hashes_array = checked_cast<const UInt64Array&>(hashes);
+  if (hashes.length() <= std::numeric_limits<int32_t>::max()) {
+    return GroupByPartition<Int32Type>(ctx, hashes_array, num_partitions, indices,
+                                       offsets);
+  }
+  return GroupByPartition<Int64Type>(ctx, hashes_array, num_partitions, indices,
+                                     offsets);
+}
+
+Status CheckOptions(const PartitionOptions& options) {
+  if (options.num_partitions < 1) {
+    return Status::Invalid("Number of partitions must be positive, got ",
+                           options.num_partitions);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Partition(FunctionContext* ctx, const Table& table,
+                 const PartitionOptions& options,
+                 std::vector<std::shared_ptr<Table>>* out) {
+  RETURN_NOT_OK(CheckOptions(options));
+  std::shared_ptr<Array> hashes;
+  RETURN_NOT_OK(Hash(ctx, table, options.keys, &hashes));
+  if (table.num_rows() == 0) {
+    out->assign(options.num_partitions, table.Slice(0));
+    return Status::OK();
+  }
+
+  std::shared_ptr<Array> indices;
+  std::vector<int64_t> offsets;
+  RETURN_NOT_OK(ComputePartitionIndices(ctx, *hashes, options.num_partitions, &indices,
+                                        &offsets));
+
+  // Gather each column once, then slice the partitions out of it
+  std::shared_ptr<Table> grouped;
+  RETURN_NOT_OK(Take(ctx, table, *indices, TakeOptions(), &grouped));
+  out->resize(options.num_partitions);
+  for (int32_t p = 0; p < options.num_partitions; ++p) {
+    (*out)[p] = grouped->Slice(offsets[p], offsets[p + 1] - offsets[p]);
+  }
+  return Status::OK();
+}
+
+Status Partition(FunctionContext* ctx, const RecordBatch& batch,
+                 const PartitionOptions& options,
+                 std::vector<std::shared_ptr<RecordBatch>>* out) {
+  RETURN_NOT_OK(CheckOptions(options));
+  std::shared_ptr<Array> hashes;
+  RETURN_NOT_OK(Hash(ctx, batch, options.keys, &hashes));
+
+  std::shared_ptr<Array> indices;
+  std::vector<int64_t> offsets;
+  RETURN_NOT_OK(ComputePartitionIndices(ctx, *hashes, options.num_partitions, &indices,
+                                        &offsets));
+
+  std::shared_ptr<RecordBatch> grouped;
+  RETURN_NOT_OK(Take(ctx, batch, *indices, TakeOptions(), &grouped));
+  out->resize(options.num_partitions);
+  for (int32_t p = 0; p < options.num_partitions; ++p) {
+    (*out)[p] = grouped->Slice(offsets[p], offsets[p + 1] - offsets[p]);
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+struct ARROW_EXPORT PartitionOptions {
+  explicit PartitionOptions(int32_t num_partitions = 1, std::vector<int> keys = {})
+      : num_partitions(num_partitions), keys(std::move(keys)) {}
+
+  /// Number of output partitions, must be positive.
+  int32_t num_partitions;
+  /// Indices of the key columns, at least one.
+  std::vector<int> keys;
+};
+
+/// \brief Split a table into partitions by a hash of its key columns
+///
+/// Rows whose keys are equal are assigned to the same partition, and keep
+/// their relative order within it.  Nulls are equal to each other, as are
+/// 0.0 and -0.0 and all NaNs, and a dictionary encoded key is hashed like
+/// its decoded values.  The assignment only depends on the key values and
+/// the number of partitions, so tables with the same keys may be
+/// partitioned separately and joined partition by partition.
+///
+/// The keys of all rows are hashed first with Hash(), then the row indices
+/// are grouped by partition in a single counting sort and each column is
+/// gathered once with Take() (in parallel if the FunctionContext allows
+/// it).  The partitions are zero-copy slices of the gathered columns.
+///
+/// Key columns may be of any type supported by Hash().
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table the table to partition
+/// \param[in] options the number of partitions and the key columns
+/// \param[out] out options.num_partitions tables with the schema of table,
+/// some possibly empty
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Partition(FunctionContext* ctx, const Table& table,
+                 const PartitionOptions& options,
+                 std::vector<std::shared_ptr<Table>>* out);
+
+/// \brief Split a record batch into partitions by a hash of its key columns
+///
+/// \see Partition(FunctionContext*, const Table&, const PartitionOptions&,
+///                std::vector<std::shared_ptr<Table>>*)
+ARROW_EXPORT
+Status Partition(FunctionContext* ctx, const RecordBatch& batch,
+                 const PartitionOptions& options,
+                 std::vector<std::shared_ptr<RecordBatch>>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/table.h"
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+// A table of an int64 key, a string key and a double payload, partitioned
+// on the int64 key or on both keys
+static void BenchPartition(benchmark::State& state, std::vector<int> keys) {
+  RegressionArgs args(state);
+  const int64_t num_partitions = state.range(2);
+  // An int64, a string of 16 characters on average and a double per row
+  const int64_t array_size = args.size / (8 + 16 + 8);
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto int_keys = rand.Int64(array_size, -1000000, 1000000, args.null_proportion);
+  auto string_keys = rand.String(array_size, 0, 32, args.null_proportion);
+  auto values = rand.Float64(array_size, -100, 100, args.null_proportion);
+  auto table = Table::Make(
+      schema({field("i", int64()), field("s", utf8()), field("v", float64())}),
+      {int_keys, string_keys, values});
+
+  FunctionContext ctx;
+  PartitionOptions options(static_cast<int32_t>(num_partitions), std::move(keys));
+  for (auto _ : state) {
+    std::vector<std::shared_ptr<Table>> out;
+    ABORT_NOT_OK(Partition(&ctx, *table, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void PartitionInt64Key(benchmark::State& state) { BenchPartition(state, {0}); }
+
+static void PartitionInt64StringKeys(benchmark::State& state) {
+  BenchPartition(state, {0, 1});
+}
+
+#define PARTITION_BENCHMARK(Name)              \
+  BENCHMARK(Name)                              \
+      ->Args({1 << 22, 0, 16})                 \
+      ->Args({1 << 22, 10, 16})                \
+      ->Args({1 << 22, 0, 256})                \
+      ->MinTime(1.0)                           \
+      ->Unit(benchmark::TimeUnit::kNanosecond) \
+      ->UseRealTime()
+
+PARTITION_BENCHMARK(PartitionInt64Key);
+PARTITION_BENCHMARK(PartitionInt64StringKeys);
+
+}  // namespace compute
+}  // namespace arrow
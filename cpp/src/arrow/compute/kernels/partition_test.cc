@@ -0,0 +1,280 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+
+class TestPartition : public ComputeFixture, public TestBase {
+ public:
+  // Partition a table made of the given key columns and a column of row ids,
+  // check the partitions, and return the partition of each row
+  std::vector<int> PartitionRows(const std::vector<std::shared_ptr<ChunkedArray>>& keys,
+                                 int32_t num_partitions) {
+    const int64_t num_rows = keys[0]->length();
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<int> key_indices;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      fields.push_back(field("key" + std::to_string(i), keys[i]->type()));
+      key_indices.push_back(static_cast<int>(i));
+    }
+    fields.push_back(field("id", int64()));
+    std::vector<std::shared_ptr<ChunkedArray>> columns = keys;
+    columns.push_back(std::make_shared<ChunkedArray>(MakeIds(0, num_rows)));
+    auto table = Table::Make(schema(fields), columns);
+
+    std::vector<std::shared_ptr<Table>> partitions;
+    ABORT_NOT_OK(Partition(&ctx_, *table, PartitionOptions(num_partitions, key_indices),
+                           &partitions));
+    EXPECT_EQ(partitions.size(), static_cast<size_t>(num_partitions));
+
+    std::vector<int> row_partitions(num_rows, -1);
+    for (int32_t p = 0; p < num_partitions; ++p) {
+      const Table& partition = *partitions[p];
+      ABORT_NOT_OK(partition.ValidateFull());
+      EXPECT_TRUE(partition.schema()->Equals(*table->schema()));
+
+      // Each row appears once, in its original order and with its values
+      std::shared_ptr<Array> ids;
+      ABORT_NOT_OK(Concatenate(partition.column(keys.size())->chunks(), &ids));
+      const auto& id_values = checked_cast<const Int64Array&>(*ids);
+      for (int64_t i = 0; i < id_values.length(); ++i) {
+        const int64_t id = id_values.Value(i);
+        EXPECT_EQ(row_partitions[id], -1);
+        row_partitions[id] = p;
+        if (i > 0) {
+          EXPECT_LT(id_values.Value(i - 1), id);
+        }
+      }
+      std::shared_ptr<Table> expected;
+      ABORT_NOT_OK(Take(&ctx_, *table, *ids, TakeOptions(), &expected));
+      AssertTablesEqual(*expected, partition, /*same_chunk_layout=*/false);
+    }
+    for (int p : row_partitions) {
+      EXPECT_NE(p, -1);
+    }
+    return row_partitions;
+  }
+
+  std::vector<int> PartitionRows(const std::shared_ptr<Array>& key,
+                                 int32_t num_partitions) {
+    return PartitionRows({std::make_shared<ChunkedArray>(ArrayVector{key})},
+                         num_partitions);
+  }
+
+  static std::shared_ptr<Array> MakeIds(int64_t start, int64_t length) {
+    Int64Builder builder;
+    for (int64_t i = 0; i < length; ++i) {
+      ABORT_NOT_OK(builder.Append(start + i));
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+    return out;
+  }
+
+  static Status Concatenate(const ArrayVector& chunks, std::shared_ptr<Array>* out) {
+    return arrow::Concatenate(chunks, default_memory_pool(), out);
+  }
+};
+
+TEST_F(TestPartition, EqualKeysTogether) {
+  auto keys = ArrayFromJSON(int32(), "[1, 2, 3, 1, null, 2, 3, null, 1, 4, 5, 6, 7]");
+  auto partitions = PartitionRows(keys, 4);
+  EXPECT_EQ(partitions[0], partitions[3]);
+  EXPECT_EQ(partitions[0], partitions[8]);
+  EXPECT_EQ(partitions[1], partitions[5]);
+  EXPECT_EQ(partitions[2], partitions[6]);
+  EXPECT_EQ(partitions[4], partitions[7]);
+
+  // A single partition holds everything
+  EXPECT_EQ(PartitionRows(keys, 1), std::vector<int>(keys->length(), 0));
+}
+
+TEST_F(TestPartition, Distribution) {
+  // Distinct keys are spread evenly
+  const int64_t length = 10000;
+  const int32_t num_partitions = 8;
+  for (const auto& keys :
+       {MakeIds(0, length), MakeIds(1 << 20, length),
+        random::RandomArrayGenerator(0).String(length, 10, 20, /*null_probability=*/0)}) {
+    std::vector<int64_t> counts(num_partitions, 0);
+    for (int p : PartitionRows(keys, num_partitions)) {
+      ++counts[p];
+    }
+    for (int64_t count : counts) {
+      EXPECT_GT(count, length / num_partitions * 3 / 4);
+    }
+  }
+}
+
+TEST_F(TestPartition, TypesHashLikeTheirValues) {
+  const int32_t num_partitions = 16;
+  auto int_partitions =
+      PartitionRows(ArrayFromJSON(int64(), "[0, 1, -1, 127, null, 100]"), num_partitions);
+  for (const auto& type : {int8(), int16(), int32()}) {
+    SCOPED_TRACE(type->ToString());
+    EXPECT_EQ(int_partitions,
+              PartitionRows(ArrayFromJSON(type, "[0, 1, -1, 127, null, 100]"),
+                            num_partitions));
+  }
+
+  // 0.0 and -0.0 are equal, as are NaNs, whatever their precision
+  const std::string floats = "[0.0, -0.0, NaN, 1.5, null, -2.5, NaN]";
+  auto float_partitions = PartitionRows(ArrayFromJSON(float64(), floats), num_partitions);
+  EXPECT_EQ(float_partitions[0], float_partitions[1]);
+  EXPECT_EQ(float_partitions[2], float_partitions[6]);
+  EXPECT_EQ(float_partitions,
+            PartitionRows(ArrayFromJSON(float32(), floats), num_partitions));
+
+  // Nulls are equal whatever their type
+  EXPECT_EQ(int_partitions[4], float_partitions[4]);
+
+  // Dictionary encoded keys hash like their values
+  const std::string strings = R"(["b", "a", null, "c", "a", ""])";
+  auto string_partitions = PartitionRows(ArrayFromJSON(utf8(), strings), num_partitions);
+  EXPECT_EQ(string_partitions, PartitionRows(ArrayFromJSON(binary(), strings),
+                                             num_partitions));
+  EXPECT_EQ(string_partitions, PartitionRows(ArrayFromJSON(large_utf8(), strings),
+                                             num_partitions));
+  auto dict_type = dictionary(int8(), utf8());
+  EXPECT_EQ(string_partitions,
+            PartitionRows(DictArrayFromJSON(dict_type, "[1, 0, null, 2, 0, 3]",
+                                            R"(["a", "b", "c", ""])"),
+                          num_partitions));
+  EXPECT_EQ(string_partitions,
+            PartitionRows(DictArrayFromJSON(dict_type, "[1, 0, 3, 2, 0, 4]",
+                                            R"(["a", "b", "c", null, ""])"),
+                          num_partitions));
+
+  auto boolean_partitions = PartitionRows(
+      ArrayFromJSON(boolean(), "[true, false, null, true]"), num_partitions);
+  EXPECT_EQ(boolean_partitions[0], boolean_partitions[3]);
+  auto fixed_partitions = PartitionRows(
+      ArrayFromJSON(fixed_size_binary(3), R"(["abc", "def", null, "abc"])"),
+      num_partitions);
+  EXPECT_EQ(fixed_partitions[0], fixed_partitions[3]);
+  auto decimal_partitions = PartitionRows(
+      ArrayFromJSON(decimal(10, 2), R"(["1.23", "4.56", null, "1.23"])"),
+      num_partitions);
+  EXPECT_EQ(decimal_partitions[0], decimal_partitions[3]);
+  auto null_partitions = PartitionRows(ArrayFromJSON(null(), "[null, null]"),
+                                       num_partitions);
+  EXPECT_EQ(null_partitions[0], int_partitions[4]);
+}
+
+TEST_F(TestPartition, MultipleKeys) {
+  auto partitions = PartitionRows(
+      {ChunkedArrayFromJSON(int32(), {"[1, 1, 2, 1]", "[2, null, 1]"}),
+       ChunkedArrayFromJSON(utf8(), {R"(["a", "b", "a"])", R"(["a", "a", "a", null])"})},
+      32);
+  EXPECT_EQ(partitions[0], partitions[3]);
+  EXPECT_EQ(partitions[2], partitions[4]);
+  EXPECT_NE(partitions[0], partitions[1]);
+
+  // Only the values matter, not the chunk layout
+  auto single_chunk = PartitionRows(
+      {ChunkedArrayFromJSON(int32(), {"[1, 1, 2, 1, 2, null, 1]"}),
+       ChunkedArrayFromJSON(utf8(), {R"(["a", "b", "a", "a", "a", "a", null])"})},
+      32);
+  EXPECT_EQ(partitions, single_chunk);
+}
+
+TEST_F(TestPartition, Threaded) {
+  auto keys = random::RandomArrayGenerator(0).Int32(10000, 0, 100, 0.1);
+  auto serial = PartitionRows(keys, 7);
+  ctx_.set_use_threads(true);
+  EXPECT_EQ(serial, PartitionRows(keys, 7));
+  EXPECT_EQ(serial, PartitionRows({std::make_shared<ChunkedArray>(ArrayVector{
+                                       keys->Slice(0, 1000), keys->Slice(1000, 5000),
+                                       keys->Slice(6000)})},
+                                  7));
+}
+
+TEST_F(TestPartition, RecordBatch) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", utf8())}),
+                                   R"([{"a": 1, "b": "x"}, {"a": 2, "b": "y"},
+                                       {"a": 1, "b": "z"}, {"a": null, "b": null}])");
+  std::vector<std::shared_ptr<RecordBatch>> partitions;
+  ASSERT_OK(Partition(&ctx_, *batch, PartitionOptions(3, {0}), &partitions));
+  ASSERT_EQ(partitions.size(), 3U);
+
+  // Partitioning a table gives the same result
+  std::vector<std::shared_ptr<Table>> table_partitions;
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &table));
+  ASSERT_OK(Partition(&ctx_, *table, PartitionOptions(3, {0}), &table_partitions));
+  int64_t num_rows = 0;
+  for (int p = 0; p < 3; ++p) {
+    ASSERT_OK(partitions[p]->ValidateFull());
+    std::shared_ptr<Table> expected;
+    ASSERT_OK(Table::FromRecordBatches({partitions[p]}, &expected));
+    AssertTablesEqual(*expected, *table_partitions[p], /*same_chunk_layout=*/false);
+    num_rows += partitions[p]->num_rows();
+  }
+  ASSERT_EQ(num_rows, 4);
+}
+
+TEST_F(TestPartition, Empty) {
+  auto table = TableFromJSON(schema({field("a", int32())}), {});
+  std::vector<std::shared_ptr<Table>> partitions;
+  ASSERT_OK(Partition(&ctx_, *table, PartitionOptions(2, {0}), &partitions));
+  ASSERT_EQ(partitions.size(), 2U);
+  for (const auto& partition : partitions) {
+    ASSERT_EQ(partition->num_rows(), 0);
+    ASSERT_TRUE(partition->schema()->Equals(*table->schema()));
+  }
+
+  table = TableFromJSON(schema({field("a", int32())}), {"[]", "[]"});
+  ASSERT_OK(Partition(&ctx_, *table, PartitionOptions(2, {0}), &partitions));
+  ASSERT_EQ(partitions.size(), 2U);
+}
+
+TEST_F(TestPartition, Errors) {
+  auto table = TableFromJSON(schema({field("a", int32()), field("b", list(int32()))}),
+                             {R"([{"a": 1, "b": [1]}])"});
+  std::vector<std::shared_ptr<Table>> partitions;
+  ASSERT_RAISES(Invalid, Partition(&ctx_, *table, PartitionOptions(0, {0}), &partitions));
+  ASSERT_RAISES(Invalid, Partition(&ctx_, *table, PartitionOptions(2, {}), &partitions));
+  ASSERT_RAISES(IndexError,
+                Partition(&ctx_, *table, PartitionOptions(2, {2}), &partitions));
+  ASSERT_RAISES(IndexError,
+                Partition(&ctx_, *table, PartitionOptions(2, {-1}), &partitions));
+  ASSERT_RAISES(NotImplemented,
+                Partition(&ctx_, *table, PartitionOptions(2, {0, 1}), &partitions));
+}
+
+}  // namespace compute
+}  // namespace arrow
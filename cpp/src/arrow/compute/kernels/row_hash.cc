@@ -0,0 +1,275 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/row_hash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::BitmapReader;
+using internal::ComputeStringHash;
+using internal::hash_t;
+using internal::ScalarHelper;
+
+namespace compute {
+
+namespace {
+
+// The hash of null values, whatever their type
+constexpr hash_t kNullHash = 0x2545f4914f6cdd1dULL;
+
+// Combine the hashes of the columns of a row, as boost::hash_combine()
+inline hash_t CombineHashes(hash_t seed, hash_t value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+// Mix all bits of a row hash into all bits of the result, so that any bit
+// range of it may be used as a hash table or partition index (the finalizer
+// of MurmurHash3)
+inline hash_t FinalizeHash(hash_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+// Compute the hash of each value of an array into out, the type-specific
+// loops being free of branches on validity.  Equal values of different integer
+// (or floating point) types hash the same.
+class ValueHasher {
+ public:
+  ValueHasher(const ArrayData& data, hash_t* out) : data_(data), out_(out) {}
+
+  Status Visit(const NullType&) {
+    std::fill(out_, out_ + data_.length, kNullHash);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    BitmapReader reader(data_.buffers[1]->data(), data_.offset, data_.length);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = ScalarHelper<uint64_t>::ComputeHash(reader.IsSet());
+      reader.Next();
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_t<is_physical_signed_integer_type<Type>::value ||
+                  is_physical_unsigned_integer_type<Type>::value,
+              Status>
+  Visit(const Type&) {
+    using CType = typename Type::c_type;
+    const CType* values = data_.GetValues<CType>(1);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = ScalarHelper<CType>::ComputeHash(values[i]);
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_physical_floating_point<Type, Status> Visit(const Type&) {
+    using CType = typename Type::c_type;
+    const CType* values = data_.GetValues<CType>(1);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      // Hash equal values identically: 0.0 and -0.0, and all NaNs
+      double value = values[i];
+      value = value == 0 ? 0 : value;
+      value = std::isnan(value) ? std::numeric_limits<double>::quiet_NaN() : value;
+      uint64_t bits;
+      std::memcpy(&bits, &value, sizeof(bits));
+      out_[i] = ScalarHelper<uint64_t>::ComputeHash(bits);
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_base_binary<Type, Status> Visit(const Type&) {
+    using offset_type = typename Type::offset_type;
+    const offset_type* offsets = data_.GetValues<offset_type>(1);
+    const uint8_t* chars = data_.buffers[2] ? data_.buffers[2]->data() : nullptr;
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = ComputeStringHash<0>(chars + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return Status::OK();
+  }
+
+  // Also handles decimals
+  Status Visit(const FixedSizeBinaryType& type) {
+    const int32_t width = type.byte_width();
+    const uint8_t* values = data_.GetValues<uint8_t>(1, data_.offset * width);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      out_[i] = ComputeStringHash<0>(values + i * width, width);
+    }
+    return Status::OK();
+  }
+
+  // Hash the dictionary once, then look up the hash of each index
+  Status Visit(const DictionaryType& type) {
+    const ArrayData& dictionary = *data_.dictionary->data();
+    std::vector<hash_t> dictionary_hashes(dictionary.length);
+    RETURN_NOT_OK(ValueHasher(dictionary, dictionary_hashes.data()).Execute());
+
+    switch (type.index_type()->id()) {
+      case Type::INT8:
+        return LookupIndices<int8_t>(dictionary_hashes);
+      case Type::UINT8:
+        return LookupIndices<uint8_t>(dictionary_hashes);
+      case Type::INT16:
+        return LookupIndices<int16_t>(dictionary_hashes);
+      case Type::UINT16:
+        return LookupIndices<uint16_t>(dictionary_hashes);
+      case Type::INT32:
+        return LookupIndices<int32_t>(dictionary_hashes);
+      case Type::UINT32:
+        return LookupIndices<uint32_t>(dictionary_hashes);
+      case Type::INT64:
+        return LookupIndices<int64_t>(dictionary_hashes);
+      case Type::UINT64:
+        return LookupIndices<uint64_t>(dictionary_hashes);
+      default:
+        return Status::TypeError("Invalid dictionary index type ", *type.index_type());
+    }
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Hashing ", type, " values is not implemented");
+  }
+
+  // Hash values, then overwrite the hashes of nulls (whose values may be
+  // anything) with kNullHash
+  Status Execute() {
+    RETURN_NOT_OK(VisitTypeInline(*data_.type, this));
+    if (data_.type->id() != Type::NA && data_.GetNullCount() > 0) {
+      BitmapReader reader(data_.buffers[0]->data(), data_.offset, data_.length);
+      for (int64_t i = 0; i < data_.length; ++i) {
+        out_[i] = reader.IsSet() ? out_[i] : kNullHash;
+        reader.Next();
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  template <typename IndexCType>
+  Status LookupIndices(const std::vector<hash_t>& dictionary_hashes) {
+    const IndexCType* indices = data_.GetValues<IndexCType>(1);
+    for (int64_t i = 0; i < data_.length; ++i) {
+      // Indices of null slots may be out of bounds
+      const auto index = static_cast<uint64_t>(indices[i]);
+      out_[i] = index < dictionary_hashes.size() ? dictionary_hashes[index] : kNullHash;
+    }
+    return Status::OK();
+  }
+
+  const ArrayData& data_;
+  hash_t* out_;
+};
+
+// Hash the rows of the given columns, each column being given by its chunks.
+// The columns are hashed separately (in parallel if ctx allows it), then
+// their hashes are combined.
+Status HashColumns(FunctionContext* ctx, const std::vector<ArrayVector>& columns,
+                   int64_t num_rows, std::shared_ptr<Array>* out) {
+  std::vector<std::vector<hash_t>> column_hashes(columns.size());
+  RETURN_NOT_OK(detail::ParallelForTasks(
+      ctx, static_cast<int>(columns.size()), [&](FunctionContext*, int j) {
+        column_hashes[j].resize(num_rows);
+        hash_t* column_out = column_hashes[j].data();
+        for (const auto& chunk : columns[j]) {
+          RETURN_NOT_OK(ValueHasher(*chunk->data(), column_out).Execute());
+          column_out += chunk->length();
+        }
+        return Status::OK();
+      }));
+
+  std::shared_ptr<Buffer> hashes_buffer;
+  RETURN_NOT_OK(ctx->Allocate(num_rows * sizeof(hash_t), &hashes_buffer));
+  auto hashes = reinterpret_cast<hash_t*>(hashes_buffer->mutable_data());
+  std::copy(column_hashes[0].begin(), column_hashes[0].end(), hashes);
+  for (size_t j = 1; j < column_hashes.size(); ++j) {
+    const hash_t* column = column_hashes[j].data();
+    for (int64_t i = 0; i < num_rows; ++i) {
+      hashes[i] = CombineHashes(hashes[i], column[i]);
+    }
+  }
+  for (int64_t i = 0; i < num_rows; ++i) {
+    hashes[i] = FinalizeHash(hashes[i]);
+  }
+
+  *out = MakeArray(ArrayData::Make(uint64(), num_rows,
+                                   {nullptr, std::move(hashes_buffer)},
+                                   /*null_count=*/0));
+  return Status::OK();
+}
+
+Status CheckColumns(const Schema& schema, const std::vector<int>& columns) {
+  if (columns.empty()) {
+    return Status::Invalid("Hash requires at least one column");
+  }
+  for (int column : columns) {
+    if (column < 0 || column >= schema.num_fields()) {
+      return Status::IndexError("Column index ", column, " out of bounds for ",
+                                schema.num_fields(), " columns");
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Hash(FunctionContext* ctx, const RecordBatch& batch,
+            const std::vector<int>& columns, std::shared_ptr<Array>* out) {
+  RETURN_NOT_OK(CheckColumns(*batch.schema(), columns));
+  std::vector<ArrayVector> chunks;
+  for (int column : columns) {
+    chunks.push_back({batch.column(column)});
+  }
+  return HashColumns(ctx, chunks, batch.num_rows(), out);
+}
+
+Status Hash(FunctionContext* ctx, const Table& table, const std::vector<int>& columns,
+            std::shared_ptr<Array>* out) {
+  RETURN_NOT_OK(CheckColumns(*table.schema(), columns));
+  std::vector<ArrayVector> chunks;
+  for (int column : columns) {
+    chunks.push_back(table.column(column)->chunks());
+  }
+  return HashColumns(ctx, chunks, table.num_rows(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Compute a 64-bit hash of each row of a record batch over some of
+/// its columns
+///
+/// Rows whose values are equal in all the given columns have equal hashes.
+/// Nulls are equal to each other, as are 0.0 and -0.0 and all NaNs, equal
+/// integer (or floating point) values hash the same whatever their width, and
+/// a dictionary encoded column is hashed like its decoded values.  The order
+/// of the columns matters.
+///
+/// The columns are hashed one at a time with a loop specialized for their
+/// type (xxh3 for binary values), in parallel if the FunctionContext allows
+/// it, and the column hashes of each row are then combined and mixed.  The
+/// hashes are stable within a build of Arrow but should not be persisted.
+///
+/// Columns may be of any primitive, binary, string, fixed size binary,
+/// decimal or dictionary type.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] batch the record batch whose rows to hash
+/// \param[in] columns the indices of the columns to hash, at least one
+/// \param[out] out a UInt64Array of batch.num_rows() hashes, without nulls
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Hash(FunctionContext* ctx, const RecordBatch& batch,
+            const std::vector<int>& columns, std::shared_ptr<Array>* out);
+
+/// \brief Compute a 64-bit hash of each row of a table over some of its
+/// columns
+///
+/// The columns may be chunked differently, the hashes are output as a single
+/// contiguous array.
+///
+/// \see Hash(FunctionContext*, const RecordBatch&, const std::vector<int>&,
+///           std::shared_ptr<Array>*)
+ARROW_EXPORT
+Status Hash(FunctionContext* ctx, const Table& table, const std::vector<int>& columns,
+            std::shared_ptr<Array>* out);
+
+}  // namespace compute
+}  // namespace arrow
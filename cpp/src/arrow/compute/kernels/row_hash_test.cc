@@ -0,0 +1,182 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/row_hash.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+
+class TestRowHash : public ComputeFixture, public TestBase {
+ public:
+  // Hash the rows of a record batch made of the given columns
+  std::vector<uint64_t> HashRows(const ArrayVector& columns) {
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<int> indices;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      fields.push_back(field("f" + std::to_string(i), columns[i]->type()));
+      indices.push_back(static_cast<int>(i));
+    }
+    auto batch = RecordBatch::Make(schema(fields), columns[0]->length(), columns);
+
+    std::shared_ptr<Array> hashes;
+    ABORT_NOT_OK(Hash(&ctx_, *batch, indices, &hashes));
+    ABORT_NOT_OK(hashes->ValidateFull());
+    EXPECT_TRUE(hashes->type()->Equals(uint64()));
+    EXPECT_EQ(hashes->length(), batch->num_rows());
+    EXPECT_EQ(hashes->null_count(), 0);
+
+    const auto& values = checked_cast<const UInt64Array&>(*hashes);
+    return std::vector<uint64_t>(values.raw_values(),
+                                 values.raw_values() + values.length());
+  }
+
+  std::vector<uint64_t> HashRows(const std::shared_ptr<Array>& column) {
+    return HashRows(ArrayVector{column});
+  }
+};
+
+TEST_F(TestRowHash, EqualRowsHashEqual) {
+  auto ints = ArrayFromJSON(int32(), "[1, 2, 1, 1, null, null, 2]");
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "b", "a", "b", null, null, "b"])");
+  auto hashes = HashRows({ints, strings});
+  EXPECT_EQ(hashes[0], hashes[2]);
+  EXPECT_EQ(hashes[1], hashes[6]);
+  EXPECT_EQ(hashes[4], hashes[5]);
+  EXPECT_EQ(std::set<uint64_t>(hashes.begin(), hashes.end()).size(), 4U);
+}
+
+TEST_F(TestRowHash, DistinctRowsHashDistinct) {
+  const int64_t length = 10000;
+  auto rand = random::RandomArrayGenerator(0);
+  for (const auto& column :
+       {ArrayFromJSON(int64(), "[]"), rand.String(length, 20, 40, /*null_probability=*/0),
+        rand.Int64(length, 0, std::numeric_limits<int64_t>::max(), 0)}) {
+    auto hashes = HashRows(column);
+    EXPECT_EQ(std::set<uint64_t>(hashes.begin(), hashes.end()).size(), hashes.size());
+  }
+}
+
+TEST_F(TestRowHash, TypesHashLikeTheirValues) {
+  const char* ints = "[0, 1, -1, 127, null, 100]";
+  auto int_hashes = HashRows(ArrayFromJSON(int64(), ints));
+  for (const auto& type : {int8(), int16(), int32()}) {
+    SCOPED_TRACE(type->ToString());
+    EXPECT_EQ(int_hashes, HashRows(ArrayFromJSON(type, ints)));
+  }
+
+  // 0.0 and -0.0 are equal, as are NaNs, whatever their precision
+  const char* floats = "[0.0, -0.0, NaN, 1.5, null, -2.5, NaN]";
+  auto float_hashes = HashRows(ArrayFromJSON(float64(), floats));
+  EXPECT_EQ(float_hashes[0], float_hashes[1]);
+  EXPECT_EQ(float_hashes[2], float_hashes[6]);
+  EXPECT_EQ(float_hashes, HashRows(ArrayFromJSON(float32(), floats)));
+
+  const char* strings = R"(["a", "", null, "a longer string, beyond 16 bytes"])";
+  auto string_hashes = HashRows(ArrayFromJSON(utf8(), strings));
+  EXPECT_EQ(string_hashes, HashRows(ArrayFromJSON(binary(), strings)));
+  EXPECT_EQ(string_hashes, HashRows(ArrayFromJSON(large_utf8(), strings)));
+
+  // Dictionary encoded values hash like their decoded values
+  auto dict_type = dictionary(int16(), utf8());
+  auto encoded = DictArrayFromJSON(dict_type, "[1, 0, null, 2, 1]",
+                                   R"(["a", "b", "a long string"])");
+  auto decoded = ArrayFromJSON(utf8(), R"(["b", "a", null, "a long string", "b"])");
+  EXPECT_EQ(HashRows(encoded), HashRows(decoded));
+
+  // Nulls hash the same whatever their type
+  EXPECT_EQ(HashRows(ArrayFromJSON(null(), "[null, null]")),
+            HashRows(ArrayFromJSON(boolean(), "[null, null]")));
+}
+
+TEST_F(TestRowHash, ColumnOrderMatters) {
+  auto a = ArrayFromJSON(int32(), "[1, null]");
+  auto b = ArrayFromJSON(int32(), "[2, 3]");
+  auto ab = HashRows({a, b});
+  auto ba = HashRows({b, a});
+  EXPECT_NE(ab[0], ba[0]);
+  EXPECT_NE(ab[1], ba[1]);
+  // A null doesn't make its row hash like the other columns alone
+  EXPECT_NE(ab[1], HashRows(ArrayFromJSON(int32(), "[3]"))[0]);
+}
+
+TEST_F(TestRowHash, Sliced) {
+  auto column = ArrayFromJSON(utf8(), R"(["x", "a", null, "b", "c"])");
+  auto hashes = HashRows(column);
+  EXPECT_EQ(std::vector<uint64_t>(hashes.begin() + 1, hashes.begin() + 4),
+            HashRows(column->Slice(1, 3)));
+  auto bools = ArrayFromJSON(boolean(), "[true, false, null, true, false]");
+  auto bool_hashes = HashRows(bools);
+  EXPECT_EQ(std::vector<uint64_t>(bool_hashes.begin() + 2, bool_hashes.end()),
+            HashRows(bools->Slice(2)));
+}
+
+TEST_F(TestRowHash, Table) {
+  auto table_schema = schema({field("a", int32()), field("b", utf8())});
+  auto table = TableFromJSON(table_schema, {R"([{"a": 1, "b": "x"},
+                                                {"a": null, "b": "y"}])",
+                                            R"([{"a": 3, "b": null}])"});
+  // Chunk the columns differently
+  auto rechunked = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(utf8(), R"(["x"])"), ArrayFromJSON(utf8(), R"(["y", null])")});
+  ASSERT_OK(table->SetColumn(1, table_schema->field(1), rechunked, &table));
+  auto batch = RecordBatchFromJSON(table_schema, R"([{"a": 1, "b": "x"},
+                                                    {"a": null, "b": "y"},
+                                                    {"a": 3, "b": null}])");
+
+  std::shared_ptr<Array> expected, actual;
+  ASSERT_OK(Hash(&ctx_, *batch, {1, 0}, &expected));
+  ASSERT_OK(Hash(&ctx_, *table, {1, 0}, &actual));
+  AssertArraysEqual(*expected, *actual);
+
+  ctx_.set_use_threads(true);
+  ASSERT_OK(Hash(&ctx_, *table, {1, 0}, &actual));
+  AssertArraysEqual(*expected, *actual);
+
+  ASSERT_OK(Hash(&ctx_, *table->Slice(0, 0), {0}, &actual));
+  ASSERT_EQ(actual->length(), 0);
+}
+
+TEST_F(TestRowHash, Errors) {
+  auto batch_schema = schema({field("a", int32()), field("b", list(int32()))});
+  auto batch = RecordBatchFromJSON(batch_schema, R"([{"a": 1, "b": [1]}])");
+  std::shared_ptr<Array> hashes;
+  ASSERT_RAISES(Invalid, Hash(&ctx_, *batch, {}, &hashes));
+  ASSERT_RAISES(IndexError, Hash(&ctx_, *batch, {2}, &hashes));
+  ASSERT_RAISES(IndexError, Hash(&ctx_, *batch, {-1}, &hashes));
+  ASSERT_RAISES(NotImplemented, Hash(&ctx_, *batch, {0, 1}, &hashes));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,750 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/string.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/utf8.h"
+
+#ifdef ARROW_WITH_RE2
+#include <re2/re2.h>
+#include <re2/set.h>
+#endif
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// UTF8 helpers, which assume validated input
+
+inline bool IsContinuationByte(uint8_t byte) { return (byte & 0xC0) == 0x80; }
+
+// Number of bytes of the character starting with the given lead byte
+inline int EncodedLength(uint8_t lead_byte) {
+  return lead_byte < 0x80 ? 1 : lead_byte < 0xE0 ? 2 : lead_byte < 0xF0 ? 3 : 4;
+}
+
+inline int EncodedLength(uint32_t codepoint) {
+  return codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4;
+}
+
+inline uint32_t DecodeCodepoint(const uint8_t* data, int length) {
+  switch (length) {
+    case 2:
+      return ((data[0] & 0x1FU) << 6) | (data[1] & 0x3FU);
+    case 3:
+      return ((data[0] & 0x0FU) << 12) | ((data[1] & 0x3FU) << 6) | (data[2] & 0x3FU);
+    default:
+      return ((data[0] & 0x07U) << 18) | ((data[1] & 0x3FU) << 12) |
+             ((data[2] & 0x3FU) << 6) | (data[3] & 0x3FU);
+  }
+}
+
+inline void EncodeCodepoint(uint32_t codepoint, int length, uint8_t* out) {
+  switch (length) {
+    case 2:
+      out[0] = static_cast<uint8_t>(0xC0 | (codepoint >> 6));
+      out[1] = static_cast<uint8_t>(0x80 | (codepoint & 0x3F));
+      break;
+    case 3:
+      out[0] = static_cast<uint8_t>(0xE0 | (codepoint >> 12));
+      out[1] = static_cast<uint8_t>(0x80 | ((codepoint >> 6) & 0x3F));
+      out[2] = static_cast<uint8_t>(0x80 | (codepoint & 0x3F));
+      break;
+    default:
+      out[0] = static_cast<uint8_t>(0xF0 | (codepoint >> 18));
+      out[1] = static_cast<uint8_t>(0x80 | ((codepoint >> 12) & 0x3F));
+      out[2] = static_cast<uint8_t>(0x80 | ((codepoint >> 6) & 0x3F));
+      out[3] = static_cast<uint8_t>(0x80 | (codepoint & 0x3F));
+      break;
+  }
+}
+
+// Advance over at most `count` characters, without going past `end`
+inline const uint8_t* AdvanceCharacters(const uint8_t* data, const uint8_t* end,
+                                        int64_t count) {
+  while (count > 0 && data < end) {
+    ++data;
+    while (data < end && IsContinuationByte(*data)) {
+      ++data;
+    }
+    --count;
+  }
+  return data;
+}
+
+// Move back over at most `count` characters, without going before `begin`
+inline const uint8_t* RetreatCharacters(const uint8_t* begin, const uint8_t* data,
+                                        int64_t count) {
+  while (count > 0 && data > begin) {
+    --data;
+    while (data > begin && IsContinuationByte(*data)) {
+      --data;
+    }
+    --count;
+  }
+  return data;
+}
+
+Status ValidateUtf8Input(const uint8_t* data, int64_t size, bool* is_ascii) {
+  *is_ascii = util::ValidateAscii(data, size);
+  if (!*is_ascii) {
+    util::InitializeUTF8();
+    if (ARROW_PREDICT_FALSE(!util::ValidateUTF8(data, size))) {
+      return Status::Invalid("Invalid UTF8 sequence in input");
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Case mapping
+
+// Simple case mappings of non-ASCII characters.  Callers must ignore a
+// mapping that changes the encoded length of the character.
+
+uint32_t UpperCodepoint(uint32_t c) {
+  if (c < 0x100) {
+    // Latin-1 Supplement
+    if (c >= 0xE0 && c <= 0xFE && c != 0xF7) return c - 0x20;
+    if (c == 0xB5) return 0x39C;
+    if (c == 0xFF) return 0x178;
+    return c;
+  }
+  if (c < 0x180) {
+    // Latin Extended-A mostly pairs an upper case letter at an even code
+    // point with the following lower case letter
+    if ((c >= 0x139 && c <= 0x148) || (c >= 0x179 && c <= 0x17E)) {
+      return (c & 1) ? c : c - 1;
+    }
+    if (c == 0x131 || c == 0x149 || c == 0x17F) return c;
+    return (c & 1) ? c - 1 : c;
+  }
+  if (c >= 0x370 && c < 0x400) {
+    // Greek
+    if (c == 0x3C2) return 0x3A3;
+    if (c >= 0x3B1 && c <= 0x3CB) return c - 0x20;
+    if (c == 0x3AC) return 0x386;
+    if (c >= 0x3AD && c <= 0x3AF) return c - 0x25;
+    if (c == 0x3CC) return 0x38C;
+    if (c == 0x3CD || c == 0x3CE) return c - 0x3F;
+    return c;
+  }
+  if (c >= 0x400 && c < 0x530) {
+    // Cyrillic and Cyrillic Supplement
+    if (c >= 0x430 && c <= 0x44F) return c - 0x20;
+    if (c >= 0x450 && c <= 0x45F) return c - 0x50;
+    if ((c >= 0x460 && c <= 0x481) || (c >= 0x48A && c <= 0x4BF) || c >= 0x4D0) {
+      return c & ~1U;
+    }
+    if (c >= 0x4C1 && c <= 0x4CE) return (c & 1) ? c : c - 1;
+    if (c == 0x4CF) return 0x4C0;
+    return c;
+  }
+  if (c >= 0x561 && c <= 0x586) return c - 0x30;  // Armenian
+  if ((c >= 0x1E00 && c <= 0x1E95) || (c >= 0x1EA0 && c <= 0x1EFF)) {
+    return c & ~1U;  // Latin Extended Additional
+  }
+  if (c >= 0xFF41 && c <= 0xFF5A) return c - 0x20;  // Fullwidth Latin
+  return c;
+}
+
+uint32_t LowerCodepoint(uint32_t c) {
+  if (c < 0x100) {
+    if (c >= 0xC0 && c <= 0xDE && c != 0xD7) return c + 0x20;
+    return c;
+  }
+  if (c < 0x180) {
+    if ((c >= 0x139 && c <= 0x148) || (c >= 0x179 && c <= 0x17E)) {
+      return (c & 1) ? c + 1 : c;
+    }
+    if (c == 0x178) return 0xFF;
+    if (c == 0x130 || c == 0x138 || c == 0x149 || c == 0x17F) return c;
+    return (c & 1) ? c : c + 1;
+  }
+  if (c >= 0x370 && c < 0x400) {
+    if (c >= 0x391 && c <= 0x3AB && c != 0x3A2) return c + 0x20;
+    if (c == 0x386) return 0x3AC;
+    if (c >= 0x388 && c <= 0x38A) return c + 0x25;
+    if (c == 0x38C) return 0x3CC;
+    if (c == 0x38E || c == 0x38F) return c + 0x3F;
+    return c;
+  }
+  if (c >= 0x400 && c < 0x530) {
+    if (c >= 0x410 && c <= 0x42F) return c + 0x20;
+    if (c <= 0x40F) return c + 0x50;
+    if ((c >= 0x460 && c <= 0x481) || (c >= 0x48A && c <= 0x4BF) || c >= 0x4D0) {
+      return c | 1U;
+    }
+    if (c >= 0x4C1 && c <= 0x4CE) return (c & 1) ? c + 1 : c;
+    if (c == 0x4C0) return 0x4CF;
+    return c;
+  }
+  if (c >= 0x531 && c <= 0x556) return c + 0x30;
+  if ((c >= 0x1E00 && c <= 0x1E95) || (c >= 0x1EA0 && c <= 0x1EFF)) return c | 1U;
+  if (c >= 0xFF21 && c <= 0xFF3A) return c + 0x20;
+  return c;
+}
+
+struct UpperOp {
+  // Branch-free so that the ASCII loop is vectorized
+  static uint8_t MapAscii(uint8_t c) {
+    return static_cast<uint8_t>(c - ((static_cast<uint8_t>(c - 'a') < 26) << 5));
+  }
+  static uint32_t MapCodepoint(uint32_t c) { return UpperCodepoint(c); }
+};
+
+struct LowerOp {
+  static uint8_t MapAscii(uint8_t c) {
+    return static_cast<uint8_t>(c + ((static_cast<uint8_t>(c - 'A') < 26) << 5));
+  }
+  static uint32_t MapCodepoint(uint32_t c) { return LowerCodepoint(c); }
+};
+
+// ----------------------------------------------------------------------
+// Kernels
+
+template <typename Type>
+class StringKernel : public UnaryKernel {
+ protected:
+  using offset_type = typename Type::offset_type;
+
+  // The values of the input as a contiguous range of bytes
+  struct Input {
+    explicit Input(const ArrayData& data)
+        : length(data.length), offsets(data.GetValues<offset_type>(1)) {
+      // Zero-length arrays may not have any buffer
+      const uint8_t* data_start =
+          data.buffers[2] != nullptr ? data.buffers[2]->data() : nullptr;
+      begin = length > 0 ? data_start + offsets[0] : data_start;
+      size = length > 0 ? offsets[length] - offsets[0] : 0;
+    }
+
+    util::string_view value(int64_t i) const {
+      return util::string_view(reinterpret_cast<const char*>(begin) + offsets[i] -
+                                   offsets[0],
+                               offsets[i + 1] - offsets[i]);
+    }
+
+    int64_t length;
+    const offset_type* offsets;
+    const uint8_t* begin;
+    int64_t size;
+  };
+
+  // Share the input offsets if they can be used as is, otherwise rebase them
+  // to start at zero
+  static Status OutputOffsets(FunctionContext* ctx, const ArrayData& input,
+                              ArrayData* out) {
+    const Input in(input);
+    if (input.offset == 0 && in.length > 0 && in.offsets[0] == 0) {
+      out->buffers[1] = input.buffers[1];
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> offsets;
+    RETURN_NOT_OK(ctx->Allocate((in.length + 1) * sizeof(offset_type), &offsets));
+    auto out_offsets = reinterpret_cast<offset_type*>(offsets->mutable_data());
+    const offset_type base = in.length > 0 ? in.offsets[0] : 0;
+    for (int64_t i = 0; i <= in.length; ++i) {
+      out_offsets[i] = in.length > 0 ? in.offsets[i] - base : 0;
+    }
+    out->buffers[1] = std::move(offsets);
+    return Status::OK();
+  }
+};
+
+template <typename Type, typename Op>
+class CaseMappingKernel final : public StringKernel<Type> {
+ public:
+  using typename StringKernel<Type>::Input;
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<Type>::type_singleton();
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    result->buffers.resize(3);
+
+    const Input in(in_data);
+    bool is_ascii;
+    RETURN_NOT_OK(ValidateUtf8Input(in.begin, in.size, &is_ascii));
+
+    // Case mapping preserves the size of each string
+    RETURN_NOT_OK(this->OutputOffsets(ctx, in_data, result));
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(ctx->Allocate(in.size, &values));
+    uint8_t* out_values = values->mutable_data();
+    if (is_ascii) {
+      for (int64_t i = 0; i < in.size; ++i) {
+        out_values[i] = Op::MapAscii(in.begin[i]);
+      }
+    } else {
+      MapUtf8(in.begin, in.size, out_values);
+    }
+    result->buffers[2] = std::move(values);
+    return Status::OK();
+  }
+
+ private:
+  static void MapUtf8(const uint8_t* data, int64_t size, uint8_t* out) {
+    const uint8_t* end = data + size;
+    while (data < end) {
+      if (*data < 0x80) {
+        *out++ = Op::MapAscii(*data++);
+        continue;
+      }
+      const int length = EncodedLength(*data);
+      const uint32_t codepoint = DecodeCodepoint(data, length);
+      uint32_t mapped = Op::MapCodepoint(codepoint);
+      if (EncodedLength(mapped) != length) {
+        mapped = codepoint;
+      }
+      EncodeCodepoint(mapped, length, out);
+      data += length;
+      out += length;
+    }
+  }
+};
+
+template <typename Type>
+class LengthKernel final : public StringKernel<Type> {
+ public:
+  using typename StringKernel<Type>::Input;
+  using typename StringKernel<Type>::offset_type;
+  using OutType = typename std::conditional<std::is_same<offset_type, int32_t>::value,
+                                            Int32Type, Int64Type>::type;
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<OutType>::type_singleton();
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+
+    const Input in(in_data);
+    auto out_values = result->GetMutableValues<offset_type>(1);
+    if (util::ValidateAscii(in.begin, in.size)) {
+      for (int64_t i = 0; i < in.length; ++i) {
+        out_values[i] = in.offsets[i + 1] - in.offsets[i];
+      }
+      return Status::OK();
+    }
+    // Count the bytes which start a character
+    for (int64_t i = 0; i < in.length; ++i) {
+      const util::string_view value = in.value(i);
+      offset_type count = 0;
+      for (char c : value) {
+        count += !IsContinuationByte(static_cast<uint8_t>(c));
+      }
+      out_values[i] = count;
+    }
+    return Status::OK();
+  }
+};
+
+template <typename Type>
+class SubstringKernel final : public StringKernel<Type> {
+ public:
+  using typename StringKernel<Type>::Input;
+  using typename StringKernel<Type>::offset_type;
+
+  explicit SubstringKernel(const SubstringOptions& options) : options_(options) {
+    // No string is longer than the maximum int64, and a start of the minimum
+    // int64 couldn't be negated
+    options_.start = std::max(options_.start, -std::numeric_limits<int64_t>::max());
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<Type>::type_singleton();
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    result->buffers.resize(3);
+
+    const Input in(in_data);
+    const bool is_ascii = util::ValidateAscii(in.begin, in.size);
+
+    // The substrings can't be larger than the input strings
+    std::shared_ptr<Buffer> offsets;
+    RETURN_NOT_OK(ctx->Allocate((in.length + 1) * sizeof(offset_type), &offsets));
+    std::shared_ptr<ResizableBuffer> values;
+    RETURN_NOT_OK(AllocateResizableBuffer(ctx->memory_pool(), in.size, &values));
+
+    auto out_offsets = reinterpret_cast<offset_type*>(offsets->mutable_data());
+    uint8_t* out_values = values->mutable_data();
+    offset_type out_size = 0;
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < in.length; ++i) {
+      const util::string_view value = in.value(i);
+      const auto begin = reinterpret_cast<const uint8_t*>(value.data());
+      const uint8_t* end = begin + value.size();
+      const uint8_t* sub_begin;
+      const uint8_t* sub_end;
+      if (is_ascii) {
+        const int64_t size = static_cast<int64_t>(value.size());
+        const int64_t start = options_.start >= 0
+                                  ? std::min(options_.start, size)
+                                  : std::max<int64_t>(size + options_.start, 0);
+        sub_begin = begin + start;
+        sub_end = sub_begin + std::min(options_.length, size - start);
+      } else {
+        sub_begin = options_.start >= 0
+                        ? AdvanceCharacters(begin, end, options_.start)
+                        : RetreatCharacters(begin, end, -options_.start);
+        sub_end = AdvanceCharacters(sub_begin, end, options_.length);
+      }
+      const auto sub_size = static_cast<offset_type>(sub_end - sub_begin);
+      if (sub_size > 0) {
+        std::memcpy(out_values + out_size, sub_begin, sub_size);
+      }
+      out_size += sub_size;
+      out_offsets[i + 1] = out_size;
+    }
+    RETURN_NOT_OK(values->Resize(out_size, /*shrink_to_fit=*/true));
+    result->buffers[1] = std::move(offsets);
+    result->buffers[2] = std::move(values);
+    return Status::OK();
+  }
+
+ private:
+  SubstringOptions options_;
+};
+
+// Find the first occurrence of a non-empty pattern in [data, end).  The C
+// library's memchr() is vectorized, so candidates are found quickly unless
+// the first byte of the pattern is very common.
+inline const uint8_t* FindLiteral(const uint8_t* data, const uint8_t* end,
+                                  util::string_view pattern) {
+  const auto first = static_cast<uint8_t>(pattern[0]);
+  const auto pattern_size = static_cast<int64_t>(pattern.size());
+  while (end - data >= pattern_size) {
+    data = static_cast<const uint8_t*>(
+        std::memchr(data, first, static_cast<size_t>(end - data - pattern_size + 1)));
+    if (data == nullptr) {
+      return nullptr;
+    }
+    if (std::memcmp(data + 1, pattern.data() + 1, pattern_size - 1) == 0) {
+      return data;
+    }
+    ++data;
+  }
+  return nullptr;
+}
+
+template <typename Type>
+class ContainsKernel final : public StringKernel<Type> {
+ public:
+  using typename StringKernel<Type>::Input;
+  using typename StringKernel<Type>::offset_type;
+
+  explicit ContainsKernel(std::string pattern) : pattern_(std::move(pattern)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+
+    const Input in(in_data);
+    uint8_t* bitmap = result->buffers[1]->mutable_data();
+    BitUtil::SetBitsTo(bitmap, 0, in.length, pattern_.empty());
+    if (pattern_.empty() || in.length == 0) {
+      return Status::OK();
+    }
+
+    // Search the data of all strings at once.  After a match, skip to the
+    // next string; a match straddling two strings doesn't count.
+    const offset_type* offsets = in.offsets;
+    const offset_type* offsets_end = offsets + in.length + 1;
+    const uint8_t* base = in.begin - offsets[0];
+    const uint8_t* data = in.begin;
+    const uint8_t* end = in.begin + in.size;
+    const auto pattern_size = static_cast<int64_t>(pattern_.size());
+    int64_t i = 0;
+    const uint8_t* match;
+    while ((match = FindLiteral(data, end, pattern_)) != nullptr) {
+      // Index of the string which the match starts in
+      const auto match_offset = static_cast<offset_type>(match - base);
+      i = std::upper_bound(offsets + i + 1, offsets_end, match_offset) - offsets - 1;
+      if (match_offset + pattern_size <= offsets[i + 1]) {
+        BitUtil::SetBit(bitmap, i);
+        data = base + offsets[i + 1];
+      } else {
+        data = match + 1;
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::string pattern_;
+};
+
+// A kernel evaluating a predicate on each string separately
+template <typename Type, typename Predicate>
+class PredicateKernel final : public StringKernel<Type> {
+ public:
+  using typename StringKernel<Type>::Input;
+
+  explicit PredicateKernel(Predicate predicate) : predicate_(std::move(predicate)) {}
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+
+    const Input in(in_data);
+    int64_t i = 0;
+    internal::GenerateBitsUnrolled(result->buffers[1]->mutable_data(), 0, in.length,
+                                   [&]() { return predicate_(in.value(i++)); });
+    return Status::OK();
+  }
+
+ private:
+  Predicate predicate_;
+};
+
+struct StartsWithPredicate {
+  bool operator()(util::string_view value) const {
+    return value.size() >= prefix.size() &&
+           std::memcmp(value.data(), prefix.data(), prefix.size()) == 0;
+  }
+
+  std::string prefix;
+};
+
+struct EndsWithPredicate {
+  bool operator()(util::string_view value) const {
+    return value.size() >= suffix.size() &&
+           std::memcmp(value.data() + value.size() - suffix.size(), suffix.data(),
+                       suffix.size()) == 0;
+  }
+
+  std::string suffix;
+};
+
+#ifdef ARROW_WITH_RE2
+
+// RE2 objects are thread-safe once compiled, so kernels processing chunks in
+// parallel share them
+
+RE2::Options MakeRegexOptions() {
+  RE2::Options options;
+  options.set_log_errors(false);
+  return options;
+}
+
+struct RegexPredicate {
+  bool operator()(util::string_view value) const {
+    return RE2::PartialMatch(re2::StringPiece(value.data(), value.size()), *regex);
+  }
+
+  std::shared_ptr<RE2> regex;
+};
+
+struct RegexSetPredicate {
+  bool operator()(util::string_view value) const {
+    return regex_set->Match(re2::StringPiece(value.data(), value.size()), nullptr);
+  }
+
+  std::shared_ptr<RE2::Set> regex_set;
+};
+
+#endif
+
+// ----------------------------------------------------------------------
+// Dispatch
+
+// Binary arrays have the same layout as String arrays, so binary-safe
+// kernels handle them by reinterpreting them as strings
+template <template <typename...> class Kernel, typename... Extra, typename... Args>
+Status MakeStringKernel(const DataType& type, bool allow_binary,
+                        std::unique_ptr<UnaryKernel>* out, Args&&... args) {
+  switch (type.id()) {
+    case Type::BINARY:
+      if (!allow_binary) break;
+    // fall through
+    case Type::STRING:
+      out->reset(new Kernel<StringType, Extra...>(std::forward<Args>(args)...));
+      return Status::OK();
+    case Type::LARGE_BINARY:
+      if (!allow_binary) break;
+    // fall through
+    case Type::LARGE_STRING:
+      out->reset(new Kernel<LargeStringType, Extra...>(std::forward<Args>(args)...));
+      return Status::OK();
+    default:
+      break;
+  }
+  return Status::NotImplemented("String operations on ", type, " arrays");
+}
+
+// The string kernels are stateless once constructed and accept sliced input, so
+// the chunks of a ChunkedArray may be processed in parallel
+Status ExecStringKernel(FunctionContext* ctx, UnaryKernel* kernel, const Datum& value,
+                        Datum* out) {
+  std::vector<Datum> result;
+  RETURN_NOT_OK(detail::ParallelInvokeUnaryArrayKernel(ctx, kernel, value,
+                                                       /*split_morsels=*/true, &result));
+  *out = detail::WrapDatumsLike(value, kernel->out_type(), result);
+  return Status::OK();
+}
+
+// Kernels with a fixed-width output are given preallocated values
+Status ExecFixedWidthStringKernel(FunctionContext* ctx, UnaryKernel* kernel,
+                                  const Datum& value, Datum* out) {
+  detail::PrimitiveAllocatingUnaryKernel allocating_kernel(kernel);
+  return ExecStringKernel(ctx, &allocating_kernel, value, out);
+}
+
+#ifndef ARROW_WITH_RE2
+Status RegexNotImplemented() {
+  return Status::NotImplemented(
+      "Regular expression matching requires Arrow to be built with ARROW_WITH_RE2");
+}
+#endif
+
+}  // namespace
+
+Status Utf8Upper(FunctionContext* ctx, const Datum& value, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK((MakeStringKernel<CaseMappingKernel, UpperOp>(
+      *value.type(), /*allow_binary=*/false, &kernel)));
+  return ExecStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status Utf8Lower(FunctionContext* ctx, const Datum& value, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK((MakeStringKernel<CaseMappingKernel, LowerOp>(
+      *value.type(), /*allow_binary=*/false, &kernel)));
+  return ExecStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status Utf8Length(FunctionContext* ctx, const Datum& value, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(
+      MakeStringKernel<LengthKernel>(*value.type(), /*allow_binary=*/false, &kernel));
+  return ExecFixedWidthStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status Utf8Substring(FunctionContext* ctx, const Datum& value,
+                     const SubstringOptions& options, Datum* out) {
+  if (options.length < 0) {
+    return Status::Invalid("Substring length must be non-negative, got ",
+                           options.length);
+  }
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeStringKernel<SubstringKernel>(*value.type(), /*allow_binary=*/false,
+                                                  &kernel, options));
+  return ExecStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status Contains(FunctionContext* ctx, const Datum& value, const std::string& pattern,
+                Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeStringKernel<ContainsKernel>(*value.type(), /*allow_binary=*/true,
+                                                 &kernel, pattern));
+  return ExecFixedWidthStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status StartsWith(FunctionContext* ctx, const Datum& value, const std::string& prefix,
+                  Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK((MakeStringKernel<PredicateKernel, StartsWithPredicate>(
+      *value.type(), /*allow_binary=*/true, &kernel, StartsWithPredicate{prefix})));
+  return ExecFixedWidthStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status EndsWith(FunctionContext* ctx, const Datum& value, const std::string& suffix,
+                Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK((MakeStringKernel<PredicateKernel, EndsWithPredicate>(
+      *value.type(), /*allow_binary=*/true, &kernel, EndsWithPredicate{suffix})));
+  return ExecFixedWidthStringKernel(ctx, kernel.get(), value, out);
+}
+
+Status MatchRegex(FunctionContext* ctx, const Datum& value, const std::string& pattern,
+                  Datum* out) {
+#ifdef ARROW_WITH_RE2
+  auto regex = std::make_shared<RE2>(pattern, MakeRegexOptions());
+  if (!regex->ok()) {
+    return Status::Invalid("Invalid regular expression '", pattern,
+                           "': ", regex->error());
+  }
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK((MakeStringKernel<PredicateKernel, RegexPredicate>(
+      *value.type(), /*allow_binary=*/false, &kernel, RegexPredicate{regex})));
+  return ExecFixedWidthStringKernel(ctx, kernel.get(), value, out);
+#else
+  return RegexNotImplemented();
+#endif
+}
+
+Status MatchAnyRegex(FunctionContext* ctx, const Datum& value,
+                     const std::vector<std::string>& patterns, Datum* out) {
+#ifdef ARROW_WITH_RE2
+  auto regex_set = std::make_shared<RE2::Set>(MakeRegexOptions(), RE2::UNANCHORED);
+  for (const auto& pattern : patterns) {
+    std::string error;
+    if (regex_set->Add(pattern, &error) < 0) {
+      return Status::Invalid("Invalid regular expression '", pattern, "': ", error);
+    }
+  }
+  if (!regex_set->Compile()) {
+    return Status::OutOfMemory("Regular expression set too large to compile");
+  }
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK((MakeStringKernel<PredicateKernel, RegexSetPredicate>(
+      *value.type(), /*allow_binary=*/false, &kernel, RegexSetPredicate{regex_set})));
+  return ExecFixedWidthStringKernel(ctx, kernel.get(), value, out);
+#else
+  return RegexNotImplemented();
+#endif
+}
+
+}  // namespace compute
+}  // namespace arrow
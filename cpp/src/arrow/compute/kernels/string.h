@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Convert each string to upper case
+///
+/// The input must be a String or LargeString Array or ChunkedArray, and the
+/// output has the same type and shape.  Simple case mappings are applied to
+/// ASCII, Latin-1, Latin Extended-A, Latin Extended Additional, Greek,
+/// Cyrillic, Armenian and fullwidth Latin characters.  Other characters, and
+/// mappings which would change the UTF8 encoded length of a character
+/// (e.g. U+0131 LATIN SMALL LETTER DOTLESS I), are left unchanged, so that
+/// the output has the same size as the input and its offsets may be shared.
+///
+/// Input which isn't entirely ASCII is validated as UTF8 first.  As with
+/// the other functions below, the chunks of a ChunkedArray are processed in
+/// parallel if FunctionContext::use_threads() is enabled.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value the strings to convert
+/// \param[out] out the resulting strings
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Upper(FunctionContext* ctx, const Datum& value, Datum* out);
+
+/// \brief Convert each string to lower case, see Utf8Upper()
+ARROW_EXPORT
+Status Utf8Lower(FunctionContext* ctx, const Datum& value, Datum* out);
+
+/// \brief Compute the number of characters (code points) in each string
+///
+/// The output is Int32 for String input and Int64 for LargeString input.
+/// Null strings give null lengths.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value the strings to measure
+/// \param[out] out the resulting lengths
+ARROW_EXPORT
+Status Utf8Length(FunctionContext* ctx, const Datum& value, Datum* out);
+
+struct ARROW_EXPORT SubstringOptions {
+  explicit SubstringOptions(int64_t start = 0,
+                            int64_t length = std::numeric_limits<int64_t>::max())
+      : start(start), length(length) {}
+
+  /// Index of the first character of the substrings.  A negative start counts
+  /// from the end of each string, e.g. -1 is the last character.
+  int64_t start;
+  /// Maximum number of characters in the substrings, must be non-negative.
+  int64_t length;
+};
+
+/// \brief Extract a substring from each string
+///
+/// Indices are in characters (code points), not bytes.  Substrings extending
+/// past either end of a string are truncated, possibly to an empty string.
+///
+/// For example given value = ["hello", "héhé", null, "a"] and
+/// options = SubstringOptions(1, 3), the output will be
+/// ["ell", "éhé", null, ""].
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value the strings to slice
+/// \param[in] options the substring position
+/// \param[out] out the resulting strings
+ARROW_EXPORT
+Status Utf8Substring(FunctionContext* ctx, const Datum& value,
+                     const SubstringOptions& options, Datum* out);
+
+/// \brief Test whether each string contains a literal pattern
+///
+/// The output is a Boolean Array or ChunkedArray, null where the input is
+/// null.  The match is exact and byte-wise; an empty pattern matches every
+/// string.  Binary input is accepted as well.
+///
+/// Rather than searching each string separately, the whole data buffer is
+/// scanned at once with the C library's vectorized memchr(), so that short
+/// strings without a match cost next to nothing.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value the strings to search
+/// \param[in] pattern the literal to look for
+/// \param[out] out the resulting booleans
+ARROW_EXPORT
+Status Contains(FunctionContext* ctx, const Datum& value, const std::string& pattern,
+                Datum* out);
+
+/// \brief Test whether each string starts with a literal prefix, see Contains()
+ARROW_EXPORT
+Status StartsWith(FunctionContext* ctx, const Datum& value, const std::string& prefix,
+                  Datum* out);
+
+/// \brief Test whether each string ends with a literal suffix, see Contains()
+ARROW_EXPORT
+Status EndsWith(FunctionContext* ctx, const Datum& value, const std::string& suffix,
+                Datum* out);
+
+/// \brief Test whether each string contains a match of a regular expression
+///
+/// The pattern uses RE2 syntax and isn't anchored; use ^ and $ to match whole
+/// strings.  An invalid pattern is an Invalid error.  Returns NotImplemented
+/// if Arrow was built without RE2 (ARROW_WITH_RE2).
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] value the strings to search
+/// \param[in] pattern the regular expression
+/// \param[out] out the resulting booleans, see Contains()
+ARROW_EXPORT
+Status MatchRegex(FunctionContext* ctx, const Datum& value, const std::string& pattern,
+                  Datum* out);
+
+/// \brief Test whether each string matches any of several regular expressions
+///
+/// The patterns are compiled into a single automaton (an RE2::Set), so each
+/// string is scanned once whatever the number of patterns.  See MatchRegex().
+ARROW_EXPORT
+Status MatchAnyRegex(FunctionContext* ctx, const Datum& value,
+                     const std::vector<std::string>& patterns, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,178 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "arrow/builder.h"
+#include "arrow/compute/kernels/string.h"
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+using StringFunction = std::function<Status(FunctionContext*, const Datum&, Datum*)>;
+
+// Random strings averaging 32 characters, with a non-ASCII character in
+// every string if requested (the slow path of most kernels)
+static std::shared_ptr<Array> MakeStrings(const RegressionArgs& args, bool ascii) {
+  const int32_t min_length = 0, max_length = 64;
+  const auto array_size = static_cast<int64_t>(
+      args.size / ((min_length + max_length) / 2) / (1 - args.null_proportion));
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = std::static_pointer_cast<StringArray>(
+      rand.String(array_size, min_length, max_length, args.null_proportion));
+  if (ascii) {
+    return array;
+  }
+  StringBuilder builder;
+  for (int64_t i = 0; i < array->length(); ++i) {
+    if (array->IsNull(i)) {
+      ABORT_NOT_OK(builder.AppendNull());
+    } else {
+      ABORT_NOT_OK(builder.Append(array->GetString(i) + "\xc3\xa9"));
+    }
+  }
+  std::shared_ptr<Array> result;
+  ABORT_NOT_OK(builder.Finish(&result));
+  return result;
+}
+
+static void BenchStringKernel(benchmark::State& state, StringFunction function,
+                              bool ascii) {
+  RegressionArgs args(state);
+  auto array = MakeStrings(args, ascii);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(function(&ctx, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void Utf8UpperAscii(benchmark::State& state) {
+  BenchStringKernel(state, Utf8Upper, /*ascii=*/true);
+}
+
+static void Utf8UpperNonAscii(benchmark::State& state) {
+  BenchStringKernel(state, Utf8Upper, /*ascii=*/false);
+}
+
+static void Utf8LowerNonAscii(benchmark::State& state) {
+  BenchStringKernel(state, Utf8Lower, /*ascii=*/false);
+}
+
+static void Utf8LengthAscii(benchmark::State& state) {
+  BenchStringKernel(state, Utf8Length, /*ascii=*/true);
+}
+
+static void Utf8LengthNonAscii(benchmark::State& state) {
+  BenchStringKernel(state, Utf8Length, /*ascii=*/false);
+}
+
+static void Utf8SubstringAscii(benchmark::State& state) {
+  BenchStringKernel(
+      state,
+      [](FunctionContext* ctx, const Datum& value, Datum* out) {
+        return Utf8Substring(ctx, value, SubstringOptions(2, 10), out);
+      },
+      /*ascii=*/true);
+}
+
+static void Utf8SubstringNonAscii(benchmark::State& state) {
+  BenchStringKernel(
+      state,
+      [](FunctionContext* ctx, const Datum& value, Datum* out) {
+        return Utf8Substring(ctx, value, SubstringOptions(-10, 5), out);
+      },
+      /*ascii=*/false);
+}
+
+static void ContainsLiteral(benchmark::State& state) {
+  BenchStringKernel(
+      state,
+      [](FunctionContext* ctx, const Datum& value, Datum* out) {
+        return Contains(ctx, value, "abc", out);
+      },
+      /*ascii=*/true);
+}
+
+static void StartsWithLiteral(benchmark::State& state) {
+  BenchStringKernel(
+      state,
+      [](FunctionContext* ctx, const Datum& value, Datum* out) {
+        return StartsWith(ctx, value, "ab", out);
+      },
+      /*ascii=*/true);
+}
+
+#ifdef ARROW_WITH_RE2
+
+static void MatchRegexPattern(benchmark::State& state) {
+  BenchStringKernel(
+      state,
+      [](FunctionContext* ctx, const Datum& value, Datum* out) {
+        return MatchRegex(ctx, value, "ab[c-e]+f", out);
+      },
+      /*ascii=*/true);
+}
+
+static void MatchAnyRegexPatterns(benchmark::State& state) {
+  BenchStringKernel(
+      state,
+      [](FunctionContext* ctx, const Datum& value, Datum* out) {
+        return MatchAnyRegex(ctx, value, {"ab[c-e]+f", "^Zz", "xyz$", "q.q"}, out);
+      },
+      /*ascii=*/true);
+}
+
+#endif
+
+#define STRING_BENCHMARK(Name)                 \
+  BENCHMARK(Name)                              \
+      ->Apply(RegressionSetArgs)               \
+      ->Args({1 << 20, 0})                     \
+      ->Args({1 << 20, 10})                    \
+      ->MinTime(1.0)                           \
+      ->Unit(benchmark::TimeUnit::kNanosecond)
+
+STRING_BENCHMARK(Utf8UpperAscii);
+STRING_BENCHMARK(Utf8UpperNonAscii);
+STRING_BENCHMARK(Utf8LowerNonAscii);
+STRING_BENCHMARK(Utf8LengthAscii);
+STRING_BENCHMARK(Utf8LengthNonAscii);
+STRING_BENCHMARK(Utf8SubstringAscii);
+STRING_BENCHMARK(Utf8SubstringNonAscii);
+STRING_BENCHMARK(ContainsLiteral);
+STRING_BENCHMARK(StartsWithLiteral);
+#ifdef ARROW_WITH_RE2
+STRING_BENCHMARK(MatchRegexPattern);
+STRING_BENCHMARK(MatchAnyRegexPatterns);
+#endif
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,319 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernels/string.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+using StringFunction = std::function<Status(FunctionContext*, const Datum&, Datum*)>;
+
+template <typename ArrowType>
+class TestStringKernels : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<DataType> offset_type() {
+    return type()->id() == Type::STRING ? int32() : int64();
+  }
+
+  void CheckUnary(StringFunction function, const std::string& values,
+                  const std::shared_ptr<DataType>& out_type,
+                  const std::string& expected) {
+    auto input = ArrayFromJSON(type(), values);
+    auto expected_array = ArrayFromJSON(out_type, expected);
+    Datum actual;
+    ASSERT_OK(function(&ctx_, input, &actual));
+    ASSERT_EQ(actual.kind(), Datum::ARRAY);
+    ASSERT_OK(actual.make_array()->ValidateFull());
+    AssertArraysEqual(*expected_array, *actual.make_array(), /*verbose=*/true);
+
+    // Sliced input, which has non-zero offsets
+    if (input->length() > 2) {
+      ASSERT_OK(function(&ctx_, input->Slice(1, input->length() - 2), &actual));
+      ASSERT_OK(actual.make_array()->ValidateFull());
+      AssertArraysEqual(*expected_array->Slice(1, input->length() - 2),
+                        *actual.make_array(), /*verbose=*/true);
+    }
+  }
+};
+
+typedef ::testing::Types<StringType, LargeStringType> StringArrowTypes;
+TYPED_TEST_SUITE(TestStringKernels, StringArrowTypes);
+
+TYPED_TEST(TestStringKernels, Utf8Upper) {
+  this->CheckUnary(Utf8Upper, "[]", this->type(), "[]");
+  this->CheckUnary(Utf8Upper, R"(["aAzZ{@09", null, "", "hello world"])", this->type(),
+                   R"(["AAZZ{@09", null, "", "HELLO WORLD"])");
+  this->CheckUnary(Utf8Upper, R"(["ünïcödé", "àÿß", null, "αβγδ ς", "ёпривет"])",
+                   this->type(), R"(["ÜNÏCÖDÉ", "ÀŸß", null, "ΑΒΓΔ Σ", "ЁПРИВЕТ"])");
+  // Mappings changing the encoded length are not applied
+  this->CheckUnary(Utf8Upper, R"(["ıſ", "ａｂ", "日本"])", this->type(),
+                   R"(["ıſ", "ＡＢ", "日本"])");
+}
+
+TYPED_TEST(TestStringKernels, Utf8Lower) {
+  this->CheckUnary(Utf8Lower, R"(["aAzZ{@09", null, "", "HELLO WORLD"])", this->type(),
+                   R"(["aazz{@09", null, "", "hello world"])");
+  this->CheckUnary(Utf8Lower, R"(["ÜNÏCÖDÉ", "ÀŸ", null, "ΑΒΓΔ Σ", "ЁПРИВЕТ"])",
+                   this->type(), R"(["ünïcödé", "àÿ", null, "αβγδ σ", "ёпривет"])");
+  this->CheckUnary(Utf8Lower, R"(["İ", "ＡＢ"])", this->type(), R"(["İ", "ａｂ"])");
+}
+
+TYPED_TEST(TestStringKernels, InvalidUtf8) {
+  auto values = ArrayFromJSON(this->type(), R"(["ok", "?"])");
+  // Corrupt the last string
+  std::shared_ptr<Buffer> data;
+  ASSERT_OK(values->data()->buffers[2]->Copy(0, values->data()->buffers[2]->size(),
+                                             &data));
+  data->mutable_data()[2] = 0xFF;
+  auto invalid = values->data()->Copy();
+  invalid->buffers[2] = data;
+  Datum actual;
+  ASSERT_RAISES(Invalid, Utf8Upper(&this->ctx_, invalid, &actual));
+  ASSERT_RAISES(Invalid, Utf8Lower(&this->ctx_, invalid, &actual));
+}
+
+TYPED_TEST(TestStringKernels, Utf8Length) {
+  this->CheckUnary(Utf8Length, "[]", this->offset_type(), "[]");
+  this->CheckUnary(Utf8Length, R"(["abc", null, "", "hello world"])",
+                   this->offset_type(), "[3, null, 0, 11]");
+  this->CheckUnary(Utf8Length, R"(["ünïcödé", "a", null, "日本", "💩"])",
+                   this->offset_type(), "[7, 1, null, 2, 1]");
+}
+
+TYPED_TEST(TestStringKernels, Utf8Substring) {
+  auto substring = [](SubstringOptions options) {
+    return [options](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return Utf8Substring(ctx, value, options, out);
+    };
+  };
+  const std::string ascii = R"(["hello", null, "", "a", "abcdefgh"])";
+  this->CheckUnary(substring(SubstringOptions(1, 3)), ascii, this->type(),
+                   R"(["ell", null, "", "", "bcd"])");
+  this->CheckUnary(substring(SubstringOptions(-2)), ascii, this->type(),
+                   R"(["lo", null, "", "a", "gh"])");
+  this->CheckUnary(substring(SubstringOptions(-10, 2)), ascii, this->type(),
+                   R"(["he", null, "", "a", "ab"])");
+  this->CheckUnary(substring(SubstringOptions(10)), ascii, this->type(),
+                   R"(["", null, "", "", ""])");
+  this->CheckUnary(substring(SubstringOptions(0, 0)), ascii, this->type(),
+                   R"(["", null, "", "", ""])");
+
+  const std::string utf8 = R"(["héhé", null, "", "日本語", "ÀÿŸ💩"])";
+  this->CheckUnary(substring(SubstringOptions(1, 3)), utf8, this->type(),
+                   R"(["éhé", null, "", "本語", "ÿŸ💩"])");
+  this->CheckUnary(substring(SubstringOptions(-2, 1)), utf8, this->type(),
+                   R"(["h", null, "", "本", "Ÿ"])");
+  this->CheckUnary(substring(SubstringOptions(3)), utf8, this->type(),
+                   R"(["é", null, "", "", "💩"])");
+  for (const auto& strings : {ascii, utf8}) {
+    this->CheckUnary(
+        substring(SubstringOptions(std::numeric_limits<int64_t>::min(), 1)), strings,
+        this->type(), strings == ascii ? R"(["h", null, "", "a", "a"])"
+                                       : R"(["h", null, "", "日", "À"])");
+  }
+
+  Datum actual;
+  ASSERT_RAISES(Invalid, Utf8Substring(&this->ctx_, ArrayFromJSON(this->type(), ascii),
+                                       SubstringOptions(0, -1), &actual));
+}
+
+TYPED_TEST(TestStringKernels, Contains) {
+  auto contains = [](std::string pattern) {
+    return [pattern](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return Contains(ctx, value, pattern, out);
+    };
+  };
+  const std::string values = R"(["hello", null, "", "oh", "hello world", "日本語"])";
+  this->CheckUnary(contains("lo"), values, boolean(),
+                   "[true, null, false, false, true, false]");
+  this->CheckUnary(contains(""), values, boolean(),
+                   "[true, null, true, true, true, true]");
+  this->CheckUnary(contains("本語"), values, boolean(),
+                   "[false, null, false, false, false, true]");
+  this->CheckUnary(contains("o"), values, boolean(),
+                   "[true, null, false, true, true, false]");
+  // Matches straddling two strings don't count
+  this->CheckUnary(contains("ab"), R"(["xa", "bx", "a", "b", "aab", "xxa"])", boolean(),
+                   "[false, false, false, false, true, false]");
+  this->CheckUnary(contains("aaa"), R"(["aa", "aaaa", "a", "aa", "xaa"])", boolean(),
+                   "[false, true, false, false, false]");
+}
+
+TYPED_TEST(TestStringKernels, ContainsRandom) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+  // Compare with a naive search, on a sliced array of many short strings
+  auto rand = random::RandomArrayGenerator(42);
+  auto strings = this->type()->id() == Type::STRING
+                     ? rand.String(5000, 0, 10, /*null_probability=*/0.1)
+                     : rand.LargeString(5000, 0, 10, /*null_probability=*/0.1);
+  auto array = checked_pointer_cast<ArrayType>(strings->Slice(3));
+  for (const std::string pattern : {"A", "Ab", "zz", "ABC"}) {
+    Datum actual;
+    ASSERT_OK(Contains(&this->ctx_, array, pattern, &actual));
+    const auto& matches = checked_cast<const BooleanArray&>(*actual.make_array());
+    ASSERT_OK(matches.ValidateFull());
+    for (int64_t i = 0; i < array->length(); ++i) {
+      ASSERT_EQ(matches.IsNull(i), array->IsNull(i));
+      if (array->IsValid(i)) {
+        ASSERT_EQ(matches.Value(i),
+                  array->GetString(i).find(pattern) != std::string::npos)
+            << "pattern '" << pattern << "' in '" << array->GetString(i) << "'";
+      }
+    }
+  }
+}
+
+TYPED_TEST(TestStringKernels, StartsWithEndsWith) {
+  auto starts_with = [](std::string prefix) {
+    return [prefix](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return StartsWith(ctx, value, prefix, out);
+    };
+  };
+  auto ends_with = [](std::string suffix) {
+    return [suffix](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return EndsWith(ctx, value, suffix, out);
+    };
+  };
+  const std::string values = R"(["hello", null, "", "he", "hello world", "oh he"])";
+  this->CheckUnary(starts_with("he"), values, boolean(),
+                   "[true, null, false, true, true, false]");
+  this->CheckUnary(starts_with(""), values, boolean(),
+                   "[true, null, true, true, true, true]");
+  this->CheckUnary(ends_with("he"), values, boolean(),
+                   "[false, null, false, true, false, true]");
+  this->CheckUnary(ends_with("world"), values, boolean(),
+                   "[false, null, false, false, true, false]");
+}
+
+#ifdef ARROW_WITH_RE2
+
+TYPED_TEST(TestStringKernels, MatchRegex) {
+  auto match_regex = [](std::string pattern) {
+    return [pattern](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return MatchRegex(ctx, value, pattern, out);
+    };
+  };
+  const std::string values = R"(["ERROR 42", null, "", "warn", "error: x9", "日本語"])";
+  this->CheckUnary(match_regex("[0-9]+"), values, boolean(),
+                   "[true, null, false, false, true, false]");
+  this->CheckUnary(match_regex("(?i)^error"), values, boolean(),
+                   "[true, null, false, false, true, false]");
+  this->CheckUnary(match_regex("^$"), values, boolean(),
+                   "[false, null, true, false, false, false]");
+  this->CheckUnary(match_regex("^.本.$"), values, boolean(),
+                   "[false, null, false, false, false, true]");
+
+  Datum actual;
+  ASSERT_RAISES(Invalid, MatchRegex(&this->ctx_, ArrayFromJSON(this->type(), values),
+                                    "(unbalanced", &actual));
+}
+
+TYPED_TEST(TestStringKernels, MatchAnyRegex) {
+  auto match_any = [](std::vector<std::string> patterns) {
+    return [patterns](FunctionContext* ctx, const Datum& value, Datum* out) {
+      return MatchAnyRegex(ctx, value, patterns, out);
+    };
+  };
+  const std::string values = R"(["ERROR 42", null, "", "warn", "error: x9", "info"])";
+  this->CheckUnary(match_any({"^ERROR", "warn"}), values, boolean(),
+                   "[true, null, false, true, false, false]");
+  this->CheckUnary(match_any({}), values, boolean(),
+                   "[false, null, false, false, false, false]");
+
+  Datum actual;
+  ASSERT_RAISES(Invalid, MatchAnyRegex(&this->ctx_, ArrayFromJSON(this->type(), values),
+                                       {"a", "(unbalanced"}, &actual));
+}
+
+#else
+
+TYPED_TEST(TestStringKernels, MatchRegexNotImplemented) {
+  Datum actual;
+  ASSERT_RAISES(NotImplemented, MatchRegex(&this->ctx_, ArrayFromJSON(this->type(), "[]"),
+                                           "a", &actual));
+}
+
+#endif
+
+TYPED_TEST(TestStringKernels, ChunkedArray) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(this->type(), R"(["ab", null])"),
+                  ArrayFromJSON(this->type(), "[]"),
+                  ArrayFromJSON(this->type(), R"(["cé"])")});
+  Datum actual;
+  ASSERT_OK(Utf8Upper(&this->ctx_, chunked, &actual));
+  ASSERT_EQ(actual.kind(), Datum::CHUNKED_ARRAY);
+  AssertChunkedEqual(
+      *actual.chunked_array(),
+      ChunkedArray(ArrayVector{ArrayFromJSON(this->type(), R"(["AB", null])"),
+                               ArrayFromJSON(this->type(), "[]"),
+                               ArrayFromJSON(this->type(), R"(["CÉ"])")}));
+
+  // Chunks are processed in parallel
+  this->ctx_.set_use_threads(true);
+  ArrayVector chunks;
+  ArrayVector expected;
+  for (int i = 0; i < 20; ++i) {
+    chunks.push_back(ArrayFromJSON(this->type(), R"(["xab", null, "ba", "ab"])"));
+    expected.push_back(ArrayFromJSON(boolean(), "[true, null, false, true]"));
+  }
+  ASSERT_OK(Contains(&this->ctx_, std::make_shared<ChunkedArray>(chunks), "ab", &actual));
+  ASSERT_EQ(actual.kind(), Datum::CHUNKED_ARRAY);
+  AssertChunkedEqual(*actual.chunked_array(), ChunkedArray(expected));
+}
+
+TEST(TestBinaryStringKernels, Contains) {
+  FunctionContext ctx;
+  auto values = ArrayFromJSON(binary(), R"(["abc", null, "bcd"])");
+  Datum actual;
+  ASSERT_OK(Contains(&ctx, values, "ab", &actual));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, null, false]"),
+                    *actual.make_array(), /*verbose=*/true);
+  ASSERT_OK(EndsWith(&ctx, values, "cd", &actual));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, null, true]"),
+                    *actual.make_array(), /*verbose=*/true);
+  // Other kernels require UTF8 data
+  ASSERT_RAISES(NotImplemented, Utf8Upper(&ctx, values, &actual));
+  ASSERT_RAISES(NotImplemented,
+                Utf8Length(&ctx, ArrayFromJSON(int32(), "[1]"), &actual));
+}
+
+}  // namespace compute
+}  // namespace arrow
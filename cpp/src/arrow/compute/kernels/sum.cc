@@ -19,8 +19,13 @@
 
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace compute {
 
 template <typename ArrowType,
@@ -110,5 +115,42 @@ Status Sum(FunctionContext* ctx, const Array& array, Datum* out) {
   return Sum(ctx, array.data(), out);
 }
 
+template <typename ArrowType>
+static Status SumSelected(const Array& array, const Int64Array& selection,
+                          Datum* out) {
+  using StateType = SumState<ArrowType>;
+  SumAggregateFunction<ArrowType, StateType> aggregate;
+  StateType state;
+  RETURN_NOT_OK(aggregate.ConsumeSelected(array, selection, &state));
+  return aggregate.Finalize(state, out);
+}
+
+#define SUM_SELECTED_CASE(T) \
+  case T::type_id:           \
+    return SumSelected<T>(array, indices, out);
+
+Status Sum(FunctionContext* ctx, const Array& array, const Array& selection,
+           Datum* out) {
+  RETURN_NOT_OK(detail::ValidateSelectionVector(selection, array.length()));
+  const auto& indices = checked_cast<const Int64Array&>(selection);
+
+  switch (array.type_id()) {
+    SUM_SELECTED_CASE(UInt8Type);
+    SUM_SELECTED_CASE(Int8Type);
+    SUM_SELECTED_CASE(UInt16Type);
+    SUM_SELECTED_CASE(Int16Type);
+    SUM_SELECTED_CASE(UInt32Type);
+    SUM_SELECTED_CASE(Int32Type);
+    SUM_SELECTED_CASE(UInt64Type);
+    SUM_SELECTED_CASE(Int64Type);
+    SUM_SELECTED_CASE(FloatType);
+    SUM_SELECTED_CASE(DoubleType);
+    default:
+      return Status::Invalid("No sum for type ", *array.type());
+  }
+
+#undef SUM_SELECTED_CASE
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -67,5 +67,22 @@ Status Sum(FunctionContext* context, const Datum& value, Datum* out);
 ARROW_EXPORT
 Status Sum(FunctionContext* context, const Array& array, Datum* out);
 
+/// \brief Sum the values of a numeric array at the positions of a selection
+/// vector, without taking them first.
+///
+/// Null positions of the selection are skipped like null values, so that
+/// summing the selection vector of a filter is summing the filtered values.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] array to sum
+/// \param[in] selection Int64Array of positions in array (see
+///            GetSelectionVector)
+/// \param[out] out resulting datum
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Sum(FunctionContext* context, const Array& array, const Array& selection,
+           Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
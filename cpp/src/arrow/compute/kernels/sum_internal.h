@@ -17,9 +17,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 
+#include "arrow/array.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate.h"
 #include "arrow/status.h"
@@ -54,32 +57,180 @@ struct FindAccumulatorType<I, enable_if_floating_point<I>> {
   using Type = DoubleType;
 };
 
+// Values are consumed in blocks covering one 64-bit word of the validity bitmap
+constexpr int64_t kValidityBlockSize = 64;
+
+// Load the 64 validity bits starting at the given bit offset, which may not be
+// byte-aligned.  The bitmap must cover all 64 bits.
+static inline uint64_t LoadValidityWord(const uint8_t* bitmap, int64_t bit_offset) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  uint64_t word;
+  std::memcpy(&word, bytes, sizeof(word));
+  word = BitUtil::FromLittleEndian(word);
+  if (shift != 0) {
+    word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+  }
+  return word;
+}
+
+// Visit the values of a primitive array block by block, then the valid values
+// of the remaining tail one by one.  visit_block(values, bits) is called for
+// each block of kValidityBlockSize values with at least one valid value, with
+// the validity bits of the block (all set if the block has no nulls), so that
+// dense blocks can be processed without looking at the bitmap.
+template <typename CType, typename BlockVisitor, typename ValueVisitor>
+void VisitValidityBlocks(const Array& array, const CType* values,
+                         BlockVisitor&& visit_block, ValueVisitor&& visit_value) {
+  const int64_t length = array.length();
+  const int64_t num_blocks = length / kValidityBlockSize;
+  const uint8_t* bitmap = array.null_count() != 0 ? array.null_bitmap_data() : nullptr;
+
+  for (int64_t block = 0; block < num_blocks; block++) {
+    const int64_t position = block * kValidityBlockSize;
+    const uint64_t bits =
+        bitmap ? LoadValidityWord(bitmap, array.offset() + position) : ~uint64_t(0);
+    if (bits != 0) {
+      visit_block(values + position, bits);
+    }
+  }
+
+  const int64_t tail = num_blocks * kValidityBlockSize;
+  if (bitmap) {
+    internal::BitmapReader reader(bitmap, array.offset() + tail, length - tail);
+    for (int64_t i = tail; i < length; i++) {
+      if (reader.IsSet()) {
+        visit_value(values[i]);
+      }
+      reader.Next();
+    }
+  } else {
+    for (int64_t i = tail; i < length; i++) {
+      visit_value(values[i]);
+    }
+  }
+}
+
+// Visit the values of a primitive array at the positions of a selection vector
+// (see GetSelectionVector) like VisitValidityBlocks.  The selected values are
+// gathered into blocks, whose validity bits are cleared for null positions of
+// the selection and null values.  The selection must have been validated (see
+// ValidateSelectionVector).
+template <typename CType, typename BlockVisitor, typename ValueVisitor>
+void VisitSelectedValidityBlocks(const Array& array, const CType* values,
+                                 const Int64Array& selection, BlockVisitor&& visit_block,
+                                 ValueVisitor&& visit_value) {
+  const int64_t length = selection.length();
+  const int64_t num_blocks = length / kValidityBlockSize;
+  const int64_t* indices = selection.raw_values();
+  const uint8_t* selection_bitmap =
+      selection.null_count() != 0 ? selection.null_bitmap_data() : nullptr;
+  const uint8_t* bitmap = array.null_count() != 0 ? array.null_bitmap_data() : nullptr;
+
+  CType block_values[kValidityBlockSize];
+  for (int64_t block = 0; block < num_blocks; block++) {
+    const int64_t position = block * kValidityBlockSize;
+    uint64_t bits = ~uint64_t(0);
+    if (selection_bitmap) {
+      bits = LoadValidityWord(selection_bitmap, selection.offset() + position);
+    }
+    for (int64_t j = 0; j < kValidityBlockSize; j++) {
+      // The index at a null position of the selection may be out of bounds
+      if (((bits >> j) & 1) == 0) {
+        block_values[j] = 0;
+        continue;
+      }
+      const int64_t index = indices[position + j];
+      if (bitmap && !BitUtil::GetBit(bitmap, array.offset() + index)) {
+        bits &= ~(uint64_t(1) << j);
+      }
+      block_values[j] = values[index];
+    }
+    if (bits != 0) {
+      visit_block(block_values, bits);
+    }
+  }
+
+  for (int64_t i = num_blocks * kValidityBlockSize; i < length; i++) {
+    if (selection.IsValid(i)) {
+      const int64_t index = indices[i];
+      if (!bitmap || BitUtil::GetBit(bitmap, array.offset() + index)) {
+        visit_value(values[index]);
+      }
+    }
+  }
+}
+
+// Pairwise summation of a sequence of partial sums, e.g. of blocks of values.
+// Partial sums are combined like the carries of a binary counter, so that only
+// sums of a similar number of values are added together, and the rounding
+// error grows with O(log n) rather than O(n) as with a running sum.
+template <typename SumType>
+class PairwiseSum {
+ public:
+  void Add(SumType partial_sum) {
+    int level = 0;
+    for (uint64_t count = count_; count & 1; count >>= 1, level++) {
+      partial_sum += levels_[level];
+    }
+    levels_[level] = partial_sum;
+    count_++;
+  }
+
+  SumType Total() const {
+    SumType total = 0;
+    int level = 0;
+    for (uint64_t count = count_; count != 0; count >>= 1, level++) {
+      if (count & 1) {
+        total += levels_[level];
+      }
+    }
+    return total;
+  }
+
+ private:
+  uint64_t count_ = 0;
+  SumType levels_[64] = {};
+};
+
 template <typename ArrowType, typename StateType>
 class SumAggregateFunction final : public AggregateFunctionStaticState<StateType> {
   using CType = typename TypeTraits<ArrowType>::CType;
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using SumType = decltype(StateType::sum);
 
-  // A small number of elements rounded to the next cacheline. This should
-  // amount to a maximum of 4 cachelines when dealing with 8 bytes elements.
-  static constexpr int64_t kTinyThreshold = 32;
-  static_assert(kTinyThreshold >= (2 * CHAR_BIT) + 1,
-                "ConsumeSparse requires 3 bytes of null bitmap, and 17 is the"
-                "required minimum number of bits/elements to cover 3 bytes.");
+  // The number of independent accumulators of a block, which the compiler can
+  // map onto SIMD registers.  They are reduced pairwise too.
+  static constexpr int64_t kLanes = 8;
+  static_assert(kValidityBlockSize % kLanes == 0, "lanes must divide blocks");
 
  public:
   Status Consume(const Array& input, StateType* state) const override {
     const ArrayType& array = static_cast<const ArrayType&>(input);
 
-    if (input.null_count() == 0) {
-      *state = ConsumeDense(array);
-    } else if (input.length() <= kTinyThreshold) {
-      // In order to simplify ConsumeSparse implementation (requires at least 3
-      // bytes of bitmap data), small arrays are handled differently.
-      *state = ConsumeTiny(array);
-    } else {
-      *state = ConsumeSparse(array);
-    }
+    BlockAccumulator accumulator;
+    VisitValidityBlocks(
+        array, array.raw_values(),
+        [&](const CType* values, uint64_t bits) { accumulator.AddBlock(values, bits); },
+        [&](CType value) { accumulator.AddValue(value); });
+
+    *state = accumulator.Finish();
+    return Status::OK();
+  }
+
+  // Like Consume, but only for the values at the positions of a validated
+  // selection vector
+  Status ConsumeSelected(const Array& input, const Int64Array& selection,
+                         StateType* state) const {
+    const ArrayType& array = static_cast<const ArrayType&>(input);
+
+    BlockAccumulator accumulator;
+    VisitSelectedValidityBlocks(
+        array, array.raw_values(), selection,
+        [&](const CType* values, uint64_t bits) { accumulator.AddBlock(values, bits); },
+        [&](CType value) { accumulator.AddValue(value); });
 
+    *state = accumulator.Finish();
     return Status::OK();
   }
 
@@ -96,110 +247,69 @@ class SumAggregateFunction final : public AggregateFunctionStaticState<StateType
   std::shared_ptr<DataType> out_type() const override { return StateType::out_type(); }
 
  private:
-  StateType ConsumeDense(const ArrayType& array) const {
-    StateType local;
-
-    const auto values = array.raw_values();
-    const int64_t length = array.length();
-    for (int64_t i = 0; i < length; i++) {
-      local.sum += values[i];
+  // Sums the blocks and tail values of a validity block visit
+  class BlockAccumulator {
+   public:
+    void AddBlock(const CType* values, uint64_t bits) {
+      if (bits == ~uint64_t(0)) {
+        sum_.Add(SumDenseBlock(values));
+        state_.count += kValidityBlockSize;
+      } else {
+        sum_.Add(SumMaskedBlock(values, bits));
+        state_.count += BitUtil::PopCount(bits);
+      }
     }
 
-    local.count = length;
+    void AddValue(CType value) {
+      tail_sum_ += value;
+      state_.count++;
+    }
 
-    return local;
-  }
+    StateType Finish() {
+      sum_.Add(tail_sum_);
+      state_.sum = sum_.Total();
+      return state_;
+    }
 
-  StateType ConsumeTiny(const ArrayType& array) const {
-    StateType local;
+   private:
+    StateType state_;
+    PairwiseSum<SumType> sum_;
+    SumType tail_sum_ = 0;
+  };
 
-    internal::BitmapReader reader(array.null_bitmap_data(), array.offset(),
-                                  array.length());
-    const auto values = array.raw_values();
-    for (int64_t i = 0; i < array.length(); i++) {
-      if (reader.IsSet()) {
-        local.sum += values[i];
-        local.count++;
+  static SumType ReduceLanes(SumType* lanes) {
+    for (int64_t width = kLanes / 2; width > 0; width /= 2) {
+      for (int64_t j = 0; j < width; j++) {
+        lanes[j] += lanes[j + width];
       }
-      reader.Next();
     }
+    return lanes[0];
+  }
 
-    return local;
+  static SumType SumDenseBlock(const CType* values) {
+    SumType lanes[kLanes] = {};
+    for (int64_t i = 0; i < kValidityBlockSize; i += kLanes) {
+      for (int64_t j = 0; j < kLanes; j++) {
+        lanes[j] += values[i + j];
+      }
+    }
+    return ReduceLanes(lanes);
   }
 
   // While this is not branchless, gcc needs this to be in a different function
   // for it to generate cmov which ends to be slightly faster than
   // multiplication but safe for handling NaN with doubles.
-  inline CType MaskedValue(bool valid, CType value) const { return valid ? value : 0; }
-
-  inline StateType UnrolledSum(uint8_t bits, const CType* values) const {
-    StateType local;
-
-    if (bits < 0xFF) {
-      // Some nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += MaskedValue(bits & (1U << i), values[i]);
+  static inline CType MaskedValue(bool valid, CType value) { return valid ? value : 0; }
+
+  static SumType SumMaskedBlock(const CType* values, uint64_t bits) {
+    SumType lanes[kLanes] = {};
+    for (int64_t i = 0; i < kValidityBlockSize; i += kLanes) {
+      const auto byte = static_cast<uint8_t>(bits >> i);
+      for (int64_t j = 0; j < kLanes; j++) {
+        lanes[j] += MaskedValue((byte >> j) & 1, values[i + j]);
       }
-      local.count += BitUtil::kBytePopcount[bits];
-    } else {
-      // No nulls
-      for (size_t i = 0; i < 8; i++) {
-        local.sum += values[i];
-      }
-      local.count += 8;
     }
-
-    return local;
-  }
-
-  StateType ConsumeSparse(const ArrayType& array) const {
-    StateType local;
-
-    // Sliced bitmaps on non-byte positions induce problem with the branchless
-    // unrolled technique. Thus extra padding is added on both left and right
-    // side of the slice such that both ends are byte-aligned. The first and
-    // last bitmap are properly masked to ignore extra values induced by
-    // padding.
-    //
-    // The execution is divided in 3 sections.
-    //
-    // 1. Compute the sum of the first masked byte.
-    // 2. Compute the sum of the middle bytes
-    // 3. Compute the sum of the last masked byte.
-
-    const int64_t length = array.length();
-    const int64_t offset = array.offset();
-
-    // The number of bytes covering the range, this includes partial bytes.
-    // This number bounded by `<= (length / 8) + 2`, e.g. a possible extra byte
-    // on the left, and on the right.
-    const int64_t covering_bytes = BitUtil::CoveringBytes(offset, length);
-    DCHECK_GE(covering_bytes, 3);
-
-    // Align values to the first batch of 8 elements. Note that raw_values() is
-    // already adjusted with the offset, thus we rewind a little to align to
-    // the closest 8-batch offset.
-    const auto values = array.raw_values() - (offset % 8);
-
-    // Align bitmap at the first consumable byte.
-    const auto bitmap = array.null_bitmap_data() + BitUtil::RoundDown(offset, 8) / 8;
-
-    // Consume the first (potentially partial) byte.
-    const uint8_t first_mask = BitUtil::kTrailingBitmask[offset % 8];
-    local += UnrolledSum(bitmap[0] & first_mask, values);
-
-    // Consume the (full) middle bytes. The loop iterates in unit of
-    // batches of 8 values and 1 byte of bitmap.
-    for (int64_t i = 1; i < covering_bytes - 1; i++) {
-      local += UnrolledSum(bitmap[i], &values[i * 8]);
-    }
-
-    // Consume the last (potentially partial) byte.
-    const int64_t last_idx = covering_bytes - 1;
-    const uint8_t last_mask = BitUtil::kPrecedingWrappingBitmask[(offset + length) % 8];
-    local += UnrolledSum(bitmap[last_idx] & last_mask, &values[last_idx * 8]);
-
-    return local;
+    return ReduceLanes(lanes);
   }
 };  // namespace compute
 
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -23,6 +24,7 @@
 #include "arrow/array/concatenate.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/visitor_inline.h"
 
@@ -101,59 +103,120 @@ Status Take(FunctionContext* ctx, const Datum& values, const Datum& indices,
   return kernel->Call(ctx, values, indices, out);
 }
 
-Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
-            const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
-  std::shared_ptr<Array> current_chunk;
+namespace {
 
+// Get the values of a ChunkedArray as a single Array
+Status ConcatenateChunks(const ChunkedArray& values, std::shared_ptr<Array>* out) {
   // Case 1: `values` has a single chunk, so just use it
-  if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
+  if (values.num_chunks() == 1) {
+    *out = values.chunk(0);
+    return Status::OK();
+  }
+  // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
+  // See
+  // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
+  // TODO Case 3: If indices are sorted, can slice them and call Array Take
+
+  // Case 4: Else, concatenate chunks and call Array Take
+  return Concatenate(values.chunks(), default_memory_pool(), out);
+}
+
+// Take each chunk of indices from each column, with one task per column to
+// concatenate its chunks and then one task per output chunk.  A concatenated
+// column is released as soon as all its chunks are taken, and serially the
+// columns are concatenated one at a time, so as not to copy the whole table.
+Status TakeColumns(FunctionContext* ctx, const std::vector<const ChunkedArray*>& columns,
+                   const ArrayVector& indices, const TakeOptions& options,
+                   std::vector<std::shared_ptr<ChunkedArray>>* out) {
+  const int num_columns = static_cast<int>(columns.size());
+  const int num_chunks = static_cast<int>(indices.size());
+
+  std::vector<ArrayVector> new_chunks(num_columns, ArrayVector(num_chunks));
+  if (!ctx->use_threads()) {
+    for (int j = 0; j < num_columns && num_chunks > 0; ++j) {
+      std::shared_ptr<Array> values;
+      RETURN_NOT_OK(ConcatenateChunks(*columns[j], &values));
+      for (int i = 0; i < num_chunks; ++i) {
+        RETURN_NOT_OK(Take(ctx, *values, *indices[i], options, &new_chunks[j][i]));
+      }
+    }
   } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
+    ArrayVector values(num_columns);
+    if (num_chunks > 0) {
+      RETURN_NOT_OK(detail::ParallelForTasks(
+          ctx, num_columns, [&](FunctionContext* task_ctx, int j) {
+            return ConcatenateChunks(*columns[j], &values[j]);
+          }));
+    }
+
+    std::unique_ptr<std::atomic<int>[]> chunks_left(new std::atomic<int>[num_columns]);
+    for (int j = 0; j < num_columns; ++j) {
+      chunks_left[j] = num_chunks;
+    }
+    RETURN_NOT_OK(detail::ParallelForTasks(
+        ctx, num_columns * num_chunks, [&](FunctionContext* task_ctx, int t) {
+          const int j = t / num_chunks, i = t % num_chunks;
+          RETURN_NOT_OK(
+              Take(task_ctx, *values[j], *indices[i], options, &new_chunks[j][i]));
+          if (--chunks_left[j] == 0) {
+            values[j].reset();
+          }
+          return Status::OK();
+        }));
+  }
 
-    // Case 4: Else, concatenate chunks and call Array Take
-    RETURN_NOT_OK(Concatenate(values.chunks(), default_memory_pool(), &current_chunk));
+  out->resize(num_columns);
+  for (int j = 0; j < num_columns; ++j) {
+    (*out)[j] =
+        std::make_shared<ChunkedArray>(std::move(new_chunks[j]), columns[j]->type());
   }
-  // Call Array Take on our single chunk
-  RETURN_NOT_OK(Take(ctx, *current_chunk, indices, options, &new_chunks[0]));
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
   return Status::OK();
 }
 
-Status Take(FunctionContext* ctx, const ChunkedArray& values, const ChunkedArray& indices,
-            const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = indices.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
-  std::shared_ptr<ChunkedArray> current_chunk;
-
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
-    RETURN_NOT_OK(Take(ctx, values, *indices.chunk(i), options, &current_chunk));
-    // Concatenate the result to make a single array for this chunk
-    RETURN_NOT_OK(
-        Concatenate(current_chunk->chunks(), default_memory_pool(), &new_chunks[i]));
+Status TakeChunkedArray(FunctionContext* ctx, const ChunkedArray& values,
+                        const ArrayVector& indices, const TakeOptions& options,
+                        std::shared_ptr<ChunkedArray>* out) {
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(TakeColumns(ctx, {&values}, indices, options, &columns));
+  *out = std::move(columns[0]);
+  return Status::OK();
+}
+
+Status TakeTable(FunctionContext* ctx, const Table& table, const ArrayVector& indices,
+                 const TakeOptions& options, std::shared_ptr<Table>* out) {
+  std::vector<const ChunkedArray*> in_columns;
+  for (const auto& column : table.columns()) {
+    in_columns.push_back(column.get());
   }
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  RETURN_NOT_OK(TakeColumns(ctx, in_columns, indices, options, &columns));
+  *out = Table::Make(table.schema(), columns);
   return Status::OK();
 }
 
+}  // namespace
+
+Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
+            const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
+  return TakeChunkedArray(ctx, values, {MakeArray(indices.data())}, options, out);
+}
+
+Status Take(FunctionContext* ctx, const ChunkedArray& values, const ChunkedArray& indices,
+            const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
+  return TakeChunkedArray(ctx, values, indices.chunks(), options, out);
+}
+
 Status Take(FunctionContext* ctx, const Array& values, const ChunkedArray& indices,
             const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
   auto num_chunks = indices.num_chunks();
   std::vector<std::shared_ptr<Array>> new_chunks(num_chunks);
 
-  for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    RETURN_NOT_OK(Take(ctx, values, *indices.chunk(i), options, &new_chunks[i]));
-  }
-  *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
+  RETURN_NOT_OK(detail::ParallelForTasks(
+      ctx, num_chunks, [&](FunctionContext* task_ctx, int i) {
+        // Take with that indices chunk
+        return Take(task_ctx, values, *indices.chunk(i), options, &new_chunks[i]);
+      }));
+  *out = std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
   return Status::OK();
 }
 
@@ -164,35 +227,22 @@ Status Take(FunctionContext* ctx, const RecordBatch& batch, const Array& indices
 
   std::vector<std::shared_ptr<Array>> columns(ncols);
 
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *batch.column(j), indices, options, &columns[j]));
-  }
+  RETURN_NOT_OK(
+      detail::ParallelForTasks(ctx, ncols, [&](FunctionContext* task_ctx, int j) {
+        return Take(task_ctx, *batch.column(j), indices, options, &columns[j]);
+      }));
   *out = RecordBatch::Make(batch.schema(), nrows, columns);
   return Status::OK();
 }
 
 Status Take(FunctionContext* ctx, const Table& table, const Array& indices,
             const TakeOptions& options, std::shared_ptr<Table>* out) {
-  auto ncols = table.num_columns();
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
-
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *table.column(j), indices, options, &columns[j]));
-  }
-  *out = Table::Make(table.schema(), columns);
-  return Status::OK();
+  return TakeTable(ctx, table, {MakeArray(indices.data())}, options, out);
 }
 
 Status Take(FunctionContext* ctx, const Table& table, const ChunkedArray& indices,
             const TakeOptions& options, std::shared_ptr<Table>* out) {
-  auto ncols = table.num_columns();
-  std::vector<std::shared_ptr<ChunkedArray>> columns(ncols);
-
-  for (int j = 0; j < ncols; j++) {
-    RETURN_NOT_OK(Take(ctx, *table.column(j), indices, options, &columns[j]));
-  }
-  *out = Table::Make(table.schema(), columns);
-  return Status::OK();
+  return TakeTable(ctx, table, indices.chunks(), options, out);
 }
 
 }  // namespace compute
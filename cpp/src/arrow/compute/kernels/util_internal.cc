@@ -29,6 +29,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -97,6 +98,59 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
   return Status::OK();
 }
 
+// Morsels shorter than this aren't worth a task of their own
+constexpr int64_t kMinMorselLength = 1 << 16;
+
+std::vector<std::shared_ptr<Array>> SplitMorsels(
+    const FunctionContext& ctx, const std::vector<std::shared_ptr<Array>>& arrays) {
+  const int num_threads = internal::GetCpuThreadPool()->GetCapacity();
+  if (!ctx.use_threads() || static_cast<int>(arrays.size()) >= num_threads) {
+    return arrays;
+  }
+  int64_t total_length = 0;
+  for (const auto& array : arrays) {
+    total_length += array->length();
+  }
+  const int64_t morsel_length =
+      std::max(kMinMorselLength, BitUtil::CeilDiv(total_length, num_threads));
+
+  std::vector<std::shared_ptr<Array>> morsels;
+  for (const auto& array : arrays) {
+    // Leave some slack so that arrays barely longer than a morsel stay whole
+    if (array->length() < 2 * morsel_length) {
+      morsels.push_back(array);
+      continue;
+    }
+    const int64_t num_morsels = BitUtil::CeilDiv(array->length(), morsel_length);
+    const int64_t length = BitUtil::CeilDiv(array->length(), num_morsels);
+    for (int64_t offset = 0; offset < array->length(); offset += length) {
+      morsels.push_back(array->Slice(offset, length));
+    }
+  }
+  return morsels;
+}
+
+Status ParallelInvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
+                                      const Datum& value, bool split_morsels,
+                                      std::vector<Datum>* outputs) {
+  if (value.kind() != Datum::CHUNKED_ARRAY || !ctx->use_threads()) {
+    return InvokeUnaryArrayKernel(ctx, kernel, value, outputs);
+  }
+  std::vector<std::shared_ptr<Array>> chunks = value.chunked_array()->chunks();
+  if (split_morsels) {
+    chunks = SplitMorsels(*ctx, chunks);
+  }
+
+  std::vector<Datum> results(chunks.size());
+  RETURN_NOT_OK(ParallelForTasks(
+      ctx, static_cast<int>(chunks.size()), [&](FunctionContext* task_ctx, int i) {
+        results[i].value = ArrayData::Make(kernel->out_type(), chunks[i]->length());
+        return kernel->Call(task_ctx, chunks[i], &results[i]);
+      }));
+  outputs->insert(outputs->end(), results.begin(), results.end());
+  return Status::OK();
+}
+
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
                                std::vector<Datum>* outputs) {
@@ -271,6 +325,21 @@ Status SetAllNulls(FunctionContext* ctx, const ArrayData& input, ArrayData* outp
   return Status::OK();
 }
 
+Status ValidateSelectionVector(const Array& selection, int64_t length) {
+  if (selection.type_id() != Type::INT64) {
+    return Status::TypeError("Selection vector must be int64, got ",
+                             *selection.type());
+  }
+  const auto& indices = checked_cast<const Int64Array&>(selection);
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    const int64_t index = indices.Value(i);
+    if ((index < 0 || index >= length) && indices.IsValid(i)) {
+      return Status::IndexError("selection index out of bounds");
+    }
+  }
+  return Status::OK();
+}
+
 Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
                               const ArrayData& right, ArrayData* output) {
   if (output->buffers.size() == 0) {
@@ -22,15 +22,15 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace compute {
 
-class FunctionContext;
-
 // \brief Make a copy of the buffers into a destination array without carrying
 // the type.
 static inline void ZeroCopyData(const ArrayData& input, ArrayData* output) {
@@ -53,6 +53,55 @@ ARROW_EXPORT
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs);
 
+/// \brief Call func(task_ctx, i) for each i in [0, num_tasks)
+///
+/// If ctx->use_threads(), the calls are submitted to the CPU thread pool.  Each
+/// gets its own FunctionContext, sharing the memory pool of ctx but with threading
+/// disabled, so that nested invocations run inline rather than wait on the pool
+/// they occupy.  Errors returned by func or set on its context are propagated.
+/// Otherwise func is called serially with ctx itself.
+template <typename Function>
+Status ParallelForTasks(FunctionContext* ctx, int num_tasks, Function&& func) {
+  if (!ctx->use_threads() || num_tasks < 2) {
+    for (int i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(func(ctx, i));
+    }
+    return Status::OK();
+  }
+  return ::arrow::internal::ParallelFor(num_tasks, [&](int i) -> Status {
+    FunctionContext task_ctx(ctx->memory_pool());
+    RETURN_NOT_OK(func(&task_ctx, i));
+    return task_ctx.status();
+  });
+}
+
+/// \brief Split arrays into morsels, for parallel processing
+///
+/// If ctx->use_threads() and there are fewer arrays than threads in the CPU
+/// thread pool, arrays much longer than their total length divided by the number
+/// of threads are sliced into morsels of about that length, so that each thread
+/// gets a share of the work.  Otherwise the arrays are returned unchanged.
+ARROW_EXPORT
+std::vector<std::shared_ptr<Array>> SplitMorsels(
+    const FunctionContext& ctx, const std::vector<std::shared_ptr<Array>>& arrays);
+
+/// \brief Invoke the kernel like InvokeUnaryArrayKernel, but with the chunks of a
+/// ChunkedArray processed as separate tasks (see ParallelForTasks()).
+///
+/// The kernel must keep no state between calls.  If split_morsels is true, large
+/// chunks are further split with SplitMorsels(), so that there may be more outputs
+/// than input chunks; only pass it for kernels which accept sliced arrays.
+///
+/// \param[in,out] ctx The function context to use when invoking the kernel.
+/// \param[in,out] kernel The kernel to execute.
+/// \param[in] value The input value to execute the kernel with.
+/// \param[in] split_morsels Whether large chunks may be split.
+/// \param[out] outputs One ArrayData datum for each chunk or morsel, in order.
+ARROW_EXPORT
+Status ParallelInvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
+                                      const Datum& value, bool split_morsels,
+                                      std::vector<Datum>* outputs);
+
 ARROW_EXPORT
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
@@ -102,6 +151,12 @@ ARROW_EXPORT
 Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
                               const ArrayData& right, ArrayData* output);
 
+/// \brief Check that selection is a selection vector (see GetSelectionVector)
+/// for an array of the given length: an Int64Array whose non-null values are
+/// positions in the array.  The values at null positions are never read.
+ARROW_EXPORT
+Status ValidateSelectionVector(const Array& selection, int64_t length);
+
 ARROW_EXPORT
 Datum WrapArraysLike(const Datum& value, std::shared_ptr<DataType> type,
                      const std::vector<std::shared_ptr<Array>>& arrays);
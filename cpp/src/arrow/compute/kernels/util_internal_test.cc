@@ -27,6 +27,8 @@
 #include "arrow/buffer.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
+#include "arrow/testing/random.h"
 
 namespace arrow {
 namespace compute {
@@ -242,6 +244,110 @@ TEST(PrimitiveAllocatingBinaryKernel, NonBoolean) {
   EXPECT_THAT(value_buffer->capacity(), Ge(64));
 }
 
+// Passes through its input, failing on empty arrays via the FunctionContext
+class PassThroughKernel : public UnaryKernel {
+ public:
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    if (input.length() == 0) {
+      ctx->SetStatus(Status::Invalid("empty input"));
+    }
+    out->value = input.array();
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int32(); }
+};
+
+TEST(ParallelForTasks, Serial) {
+  FunctionContext ctx(default_memory_pool());
+  std::vector<int> calls;
+  ASSERT_OK(ParallelForTasks(&ctx, 3, [&](FunctionContext* task_ctx, int i) {
+    EXPECT_EQ(task_ctx, &ctx);
+    calls.push_back(i);
+    return Status::OK();
+  }));
+  ASSERT_THAT(calls, ElementsAre(0, 1, 2));
+}
+
+TEST(ParallelForTasks, Threaded) {
+  FunctionContext ctx(default_memory_pool());
+  ctx.set_use_threads(true);
+  std::vector<int> calls(20, 0);
+  ASSERT_OK(ParallelForTasks(&ctx, 20, [&](FunctionContext* task_ctx, int i) {
+    // Tasks run with their own, single-threaded context
+    EXPECT_NE(task_ctx, &ctx);
+    EXPECT_FALSE(task_ctx->use_threads());
+    EXPECT_EQ(task_ctx->memory_pool(), ctx.memory_pool());
+    ++calls[i];
+    return Status::OK();
+  }));
+  ASSERT_THAT(calls, Each(Eq(1)));
+
+  // Errors are propagated, whether returned or set on the task's context
+  ASSERT_RAISES(IOError, ParallelForTasks(&ctx, 20, [](FunctionContext*, int i) {
+                  return i == 7 ? Status::IOError("task failed") : Status::OK();
+                }));
+  ASSERT_RAISES(IOError, ParallelForTasks(&ctx, 20, [](FunctionContext* task_ctx, int i) {
+                  if (i == 7) task_ctx->SetStatus(Status::IOError("task failed"));
+                  return Status::OK();
+                }));
+  ASSERT_FALSE(ctx.HasError());
+}
+
+TEST(SplitMorsels, Basic) {
+  const int64_t length = 1 << 20;
+  auto array = random::RandomArrayGenerator(0).Int32(length, 0, 100, 0.1);
+  FunctionContext ctx(default_memory_pool());
+
+  // Arrays are left alone unless threads are used
+  ASSERT_THAT(SplitMorsels(ctx, {array}), ElementsAre(Eq(array)));
+
+  ctx.set_use_threads(true);
+  auto morsels = SplitMorsels(ctx, {array, array->Slice(0, 10)});
+  ASSERT_GE(morsels.size(), 2U);
+  // The morsels are consecutive slices of the input
+  int64_t offset = 0;
+  for (size_t i = 0; i + 1 < morsels.size(); ++i) {
+    AssertArraysEqual(*array->Slice(offset, morsels[i]->length()), *morsels[i]);
+    offset += morsels[i]->length();
+  }
+  ASSERT_EQ(offset, length);
+  AssertArraysEqual(*array->Slice(0, 10), *morsels.back());
+  if (internal::GetCpuThreadPool()->GetCapacity() > 2) {
+    ASSERT_GT(morsels.size(), 2U);
+  }
+}
+
+TEST(ParallelInvokeUnaryArrayKernel, ChunkedArray) {
+  ArrayVector chunks;
+  for (int i = 0; i < 10; ++i) {
+    chunks.push_back(ArrayFromJSON(int32(), "[" + std::to_string(i) + ", null]"));
+  }
+  Datum input(std::make_shared<ChunkedArray>(chunks));
+  PassThroughKernel kernel;
+
+  for (bool use_threads : {false, true}) {
+    FunctionContext ctx(default_memory_pool());
+    ctx.set_use_threads(use_threads);
+    std::vector<Datum> outputs;
+    ASSERT_OK(ParallelInvokeUnaryArrayKernel(&ctx, &kernel, input,
+                                             /*split_morsels=*/true, &outputs));
+    // Outputs are in order
+    ASSERT_EQ(outputs.size(), chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      AssertArraysEqual(*chunks[i], *outputs[i].make_array());
+    }
+  }
+
+  chunks.push_back(ArrayFromJSON(int32(), "[]"));
+  FunctionContext ctx(default_memory_pool());
+  ctx.set_use_threads(true);
+  std::vector<Datum> outputs;
+  ASSERT_RAISES(Invalid, ParallelInvokeUnaryArrayKernel(
+                             &ctx, &kernel, std::make_shared<ChunkedArray>(chunks),
+                             /*split_morsels=*/false, &outputs));
+}
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
@@ -30,6 +30,8 @@
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace dataset {
@@ -129,31 +131,94 @@ Result<fs::PathForest> FileSystemDatasetFactory::Filter(
     const std::shared_ptr<fs::FileSystem>& filesystem,
     const std::shared_ptr<FileFormat>& format, const FileSystemFactoryOptions& options,
     fs::PathForest forest) {
-  std::vector<fs::FileInfo> out;
+  std::vector<int> retained;
+  RETURN_NOT_OK(forest.Visit([&](fs::PathForest::Ref ref) -> fs::PathForest::MaybePrune {
+    if (StartsWithAnyOf(options.ignore_prefixes, ref.info().path())) {
+      return fs::PathForest::Prune;
+    }
+    retained.push_back(ref.i);
+    return fs::PathForest::Continue;
+  }));
 
   auto& infos = forest.infos();
-  RETURN_NOT_OK(forest.Visit([&](fs::PathForest::Ref ref) -> fs::PathForest::MaybePrune {
-    const auto& path = ref.info().path();
+  // std::vector<bool> can't be written concurrently
+  std::vector<uint8_t> supported(retained.size(), true);
+  if (options.exclude_invalid_files) {
+    auto check_supported = [&](int i) -> Status {
+      const auto& info = infos[retained[i]];
+      if (info.IsFile()) {
+        ARROW_ASSIGN_OR_RAISE(
+            supported[i], format->IsSupported(FileSource(info.path(), filesystem.get())));
+      }
+      return Status::OK();
+    };
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        options.use_threads, static_cast<int>(retained.size()), check_supported,
+        io::internal::GetIOThreadPool()));
+  }
 
-    if (StartsWithAnyOf(options.ignore_prefixes, path)) {
-      return fs::PathForest::Prune;
+  std::vector<fs::FileInfo> out;
+  for (size_t i = 0; i < retained.size(); ++i) {
+    if (supported[i]) {
+      out.push_back(std::move(infos[retained[i]]));
     }
+  }
+
+  return fs::PathForest::MakeFromPreSorted(std::move(out));
+}
+
+namespace {
 
-    if (ref.info().IsFile() && options.exclude_invalid_files) {
-      ARROW_ASSIGN_OR_RAISE(auto supported,
-                            format->IsSupported(FileSource(path, filesystem.get())));
-      if (!supported) {
-        return fs::PathForest::Continue;
+// List the files selected by `selector` one directory level at a time, listing
+// the directories of each level concurrently on the IO thread pool.
+// Directories matching one of `ignore_prefixes` are not descended into.
+Result<std::vector<fs::FileInfo>> CrawlConcurrently(
+    fs::FileSystem* filesystem, const fs::FileSelector& selector,
+    const std::vector<std::string>& ignore_prefixes) {
+  std::vector<fs::FileInfo> out;
+  std::vector<std::string> directories{selector.base_dir};
+
+  for (int32_t depth = 0; !directories.empty(); ++depth) {
+    std::vector<std::vector<fs::FileInfo>> listings(directories.size());
+    auto list_directory = [&](int i) -> Status {
+      fs::FileSelector level;
+      level.base_dir = directories[i];
+      // Subdirectories may legitimately vanish between two levels
+      level.allow_not_found = depth > 0 || selector.allow_not_found;
+      ARROW_ASSIGN_OR_RAISE(listings[i], filesystem->GetFileInfo(level));
+      return Status::OK();
+    };
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(static_cast<int>(directories.size()),
+                                                 list_directory,
+                                                 io::internal::GetIOThreadPool()));
+
+    const bool descend = selector.recursive && depth < selector.max_recursion;
+    directories.clear();
+    for (auto& listing : listings) {
+      for (auto& info : listing) {
+        if (descend && info.IsDirectory() &&
+            !StartsWithAnyOf(ignore_prefixes, info.path())) {
+          directories.push_back(info.path());
+        }
+        out.push_back(std::move(info));
       }
     }
+  }
 
-    out.push_back(std::move(infos[ref.i]));
-    return fs::PathForest::Continue;
-  }));
+  return out;
+}
 
-  return fs::PathForest::MakeFromPreSorted(std::move(out));
+Result<std::shared_ptr<FileFormat>> WithMetadataFile(
+    const std::shared_ptr<fs::FileSystem>& filesystem, std::shared_ptr<FileFormat> format,
+    const FileSystemFactoryOptions& options) {
+  if (options.metadata_path.empty()) {
+    return format;
+  }
+  return format->WithMetadataFile(FileSource(options.metadata_path, filesystem.get()));
 }
 
+}  // namespace
+
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, const std::vector<std::string>& paths,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
@@ -181,6 +246,7 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   ARROW_ASSIGN_OR_RAISE(forest, fs::PathForest::Make(std::move(files)));
 
   ARROW_ASSIGN_OR_RAISE(forest, Filter(filesystem, format, options, std::move(forest)));
+  ARROW_ASSIGN_OR_RAISE(format, WithMetadataFile(filesystem, std::move(format), options));
 
   return std::shared_ptr<DatasetFactory>(new FileSystemDatasetFactory(
       std::move(filesystem), std::move(forest), std::move(format), std::move(options)));
@@ -189,11 +255,18 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
+  std::vector<fs::FileInfo> files;
+  if (options.use_threads) {
+    ARROW_ASSIGN_OR_RAISE(
+        files, CrawlConcurrently(filesystem.get(), selector, options.ignore_prefixes));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(files, filesystem->GetFileInfo(selector));
+  }
 
   ARROW_ASSIGN_OR_RAISE(auto forest, fs::PathForest::Make(std::move(files)));
 
   ARROW_ASSIGN_OR_RAISE(forest, Filter(filesystem, format, options, std::move(forest)));
+  ARROW_ASSIGN_OR_RAISE(format, WithMetadataFile(filesystem, std::move(format), options));
 
   // By automatically setting the options base_dir to the selector's base_dir,
   // we provide a better experience for user providing Partitioning that are
@@ -224,18 +297,34 @@ Result<std::shared_ptr<Schema>> FileSystemDatasetFactory::PartitionSchema() {
 
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
     InspectOptions options) {
-  std::vector<std::shared_ptr<Schema>> schemas;
+  std::vector<FileSource> sources;
 
-  const bool has_fragments_limit = options.fragments >= 0;
-  int fragments = options.fragments;
-  for (const auto& f : forest_.infos()) {
-    if (!f.IsFile()) continue;
-    if (has_fragments_limit && fragments-- == 0) break;
-    FileSource src(f.path(), fs_.get());
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect(src));
-    schemas.push_back(schema);
+  if (!options_.metadata_path.empty()) {
+    // The summary file holds the schema of all the files it describes
+    if (options.fragments != 0) {
+      sources.emplace_back(options_.metadata_path, fs_.get());
+    }
+  } else {
+    const bool has_fragments_limit = options.fragments >= 0;
+    int fragments = options.fragments;
+    for (const auto& f : forest_.infos()) {
+      if (!f.IsFile()) continue;
+      if (has_fragments_limit && fragments-- == 0) break;
+      sources.emplace_back(f.path(), fs_.get());
+    }
   }
 
+  std::vector<std::shared_ptr<Schema>> schemas(sources.size());
+  auto inspect = [&](int i) -> Status {
+    ARROW_ASSIGN_OR_RAISE(schemas[i], format_->Inspect(sources[i]));
+    return Status::OK();
+  };
+  // Inspecting a single fragment (the default) doesn't warrant a context switch
+  const bool use_threads = options.use_threads && sources.size() > 1;
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      use_threads, static_cast<int>(sources.size()), inspect,
+      io::internal::GetIOThreadPool()));
+
   ARROW_ASSIGN_OR_RAISE(auto partition_schema, PartitionSchema());
   schemas.push_back(partition_schema);
 
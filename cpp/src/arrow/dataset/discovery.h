@@ -53,6 +53,10 @@ struct InspectOptions {
   /// `kInspectAllFragments`. A value of `0` disables inspection of fragments
   /// altogether so only the partitioning schema will be inspected.
   int fragments = 1;
+
+  /// Inspect the selected fragments concurrently on the IO thread pool. This
+  /// mostly matters when inspecting many fragments on a high latency file system.
+  bool use_threads = true;
 };
 
 struct FinishOptions {
@@ -160,11 +164,27 @@ struct FileSystemFactoryOptions {
 
   // Invalid files (via selector or explicitly) will be excluded by checking
   // with the FileFormat::IsSupported method.  This will incur IO for each files
-  // in a serial and single threaded fashion. Disabling this feature will skip the
+  // (concurrently if use_threads is enabled). Disabling this feature will skip the
   // IO, but unsupported files may be present in the Dataset
   // (resulting in an error at scan time).
   bool exclude_invalid_files = false;
 
+  // Path of a summary file gathering the metadata of the discovered files, e.g. a
+  // Parquet `_metadata` file. If not empty, fragments are made from the metadata
+  // pre-loaded from it (see FileFormat::WithMetadataFile) instead of reading it from
+  // each file, and the schema is inspected from the summary file only. With Parquet
+  // this allows row groups to be pruned with their statistics without touching
+  // the data files.
+  std::string metadata_path;
+
+  // Crawl directories and check files for validity concurrently on the IO
+  // thread pool. When enabled, a recursive selector is listed one directory
+  // level at a time with all directories of a level listed in parallel, and
+  // directories matching ignore_prefixes are not descended into. This can
+  // greatly reduce discovery time of deep (e.g. partitioned) datasets on high
+  // latency file systems such as object stores.
+  bool use_threads = false;
+
   // Files matching one of the following prefix will be ignored by the
   // discovery process. This is matched to the basename of a path.
   //
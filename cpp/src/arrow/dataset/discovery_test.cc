@@ -302,6 +302,81 @@ TEST_F(FileSystemDatasetFactoryTest, InspectFragmentsLimit) {
   }
 }
 
+TEST_F(FileSystemDatasetFactoryTest, InspectFragmentsConcurrently) {
+  MakeFactory({fs::File("a"), fs::File("b"), fs::File("c")});
+
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+  for (bool use_threads : {false, true}) {
+    options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(options));
+    EXPECT_THAT(schemas, SizeIs(4));
+    for (const auto& s : schemas) {
+      ASSERT_NE(s, nullptr);
+    }
+  }
+}
+
+TEST_F(FileSystemDatasetFactoryTest, SelectorCrawledConcurrently) {
+  factory_options_.use_threads = true;
+  selector_.base_dir = "A";
+  selector_.recursive = true;
+
+  std::vector<fs::FileInfo> files = {
+      fs::File("0"),       fs::File("A/a"),     fs::Dir("A/B"),
+      fs::File("A/B/a"),   fs::Dir("A/B/C"),    fs::File("A/B/C/a"),
+      fs::Dir("A/D"),      fs::File("A/D/a"),   fs::Dir("A/_ignored"),
+      fs::File("A/_ignored/a"),
+  };
+  MakeFactory(files);
+  AssertFinishWithPaths({"A/a", "A/B/a", "A/B/C/a", "A/D/a"});
+
+  selector_.max_recursion = 1;
+  MakeFactory(files);
+  AssertFinishWithPaths({"A/a", "A/B/a", "A/D/a"});
+
+  selector_.recursive = false;
+  MakeFactory(files);
+  AssertFinishWithPaths({"A/a"});
+
+  selector_.base_dir = "missing";
+  ASSERT_RAISES(IOError, FileSystemDatasetFactory::Make(fs_, selector_, format_,
+                                                        factory_options_));
+  selector_.allow_not_found = true;
+  MakeFactory(files);
+  AssertFinishWithPaths({});
+}
+
+class RejectingFileFormat : public DummyFileFormat {
+ public:
+  RejectingFileFormat() : DummyFileFormat(schema({})) {}
+
+  // Only files with a ".ok" extension are supported
+  Result<bool> IsSupported(const FileSource& source) const override {
+    return util::string_view(source.path()).ends_with(".ok");
+  }
+};
+
+TEST_F(FileSystemDatasetFactoryTest, ExcludeInvalidFiles) {
+  format_ = std::make_shared<RejectingFileFormat>();
+  factory_options_.exclude_invalid_files = true;
+  selector_.recursive = true;
+
+  for (bool use_threads : {false, true}) {
+    factory_options_.use_threads = use_threads;
+    MakeFactory({fs::File("a.ok"), fs::File("b.bad"), fs::Dir("C"), fs::File("C/c.ok"),
+                 fs::File("C/d.bad")});
+    AssertFinishWithPaths({"a.ok", "C/c.ok"});
+  }
+}
+
+TEST_F(FileSystemDatasetFactoryTest, MetadataFileNotSupported) {
+  factory_options_.metadata_path = "_metadata";
+  MakeFileSystem({fs::File("_metadata"), fs::File("a")});
+  ASSERT_RAISES(NotImplemented, FileSystemDatasetFactory::Make(fs_, selector_, format_,
+                                                               factory_options_));
+}
+
 std::shared_ptr<DatasetFactory> DatasetFactoryFromSchemas(
     std::vector<std::shared_ptr<Schema>> schemas) {
   return std::make_shared<MockDatasetFactory>(schemas);
@@ -18,6 +18,7 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <iterator>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
@@ -67,6 +68,16 @@ Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragment(
                                         std::move(partition_expression));
 }
 
+Result<FragmentVector> FileFormat::SplitFragment(std::shared_ptr<FileFragment> fragment,
+                                                const Expression& predicate) const {
+  return FragmentVector{std::move(fragment)};
+}
+
+Result<std::shared_ptr<FileFormat>> FileFormat::WithMetadataFile(
+    const FileSource& metadata_source) const {
+  return Status::NotImplemented("metadata summary files of format ", type_name());
+}
+
 Result<std::shared_ptr<WriteTask>> FileFormat::WriteFragment(
     FileSource destination, std::shared_ptr<Fragment> fragment,
     std::shared_ptr<ScanContext> scan_context) {
@@ -216,7 +227,9 @@ FragmentIterator FileSystemDataset::GetFragmentsImpl(
       ARROW_ASSIGN_OR_RAISE(auto fragment,
                             format_->MakeFragment(std::move(src), options[ref.i],
                                                   std::move(fragment_partitions[ref.i])));
-      fragments.push_back(std::move(fragment));
+      ARROW_ASSIGN_OR_RAISE(auto split,
+                            format_->SplitFragment(std::move(fragment), *filter));
+      std::move(split.begin(), split.end(), std::back_inserter(fragments));
     }
 
     return fs::PathForest::Continue;
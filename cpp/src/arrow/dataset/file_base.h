@@ -150,6 +150,20 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   Result<std::shared_ptr<FileFragment>> MakeFragment(
       FileSource source, std::shared_ptr<ScanOptions> options);
 
+  /// \brief Split a fragment of this format into finer fragments which can be pruned
+  /// and scanned independently, e.g. one per Parquet row group. Finer fragments which
+  /// can't satisfy `predicate` may be omitted.
+  ///
+  /// FileSystemDataset yields the split fragments. By default, fragments aren't split.
+  virtual Result<FragmentVector> SplitFragment(std::shared_ptr<FileFragment> fragment,
+                                               const Expression& predicate) const;
+
+  /// \brief Return a FileFormat which makes fragments from the metadata gathered in
+  /// a summary file (e.g. a Parquet `_metadata` file) instead of reading it from each
+  /// file. Formats without summary files return NotImplemented.
+  virtual Result<std::shared_ptr<FileFormat>> WithMetadataFile(
+      const FileSource& metadata_source) const;
+
   /// \brief Write a fragment. If the parent directory of destination does not exist, it
   /// will be created.
   virtual Result<std::shared_ptr<WriteTask>> WriteFragment(
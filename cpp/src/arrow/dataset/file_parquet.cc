@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -25,11 +26,16 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/arrow/writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
@@ -45,15 +51,21 @@ using parquet::arrow::StatisticsAsScalars;
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(int row_group, std::vector<int> column_projection,
+                  std::vector<int> filter_columns,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
                   std::shared_ptr<ScanOptions> options,
                   std::shared_ptr<ScanContext> context)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(row_group),
         column_projection_(std::move(column_projection)),
+        filter_columns_(std::move(filter_columns)),
         reader_(std::move(reader)) {}
 
   Result<RecordBatchIterator> Execute() override {
+    if (!filter_columns_.empty()) {
+      return ExecuteFiltered();
+    }
+
     // The construction of parquet's RecordBatchReader is deferred here to
     // control the memory usage of consumers who materialize all ScanTasks
     // before dispatching them, e.g. for scheduling purposes.
@@ -67,8 +79,55 @@ class ParquetScanTask : public ScanTask {
   }
 
  private:
+  // Late materialization: only the rows selected by the filter are read from the
+  // columns it doesn't reference.  The filter is still applied to the yielded
+  // batches by the scanner, which is then a no-op.
+  Result<RecordBatchIterator> ExecuteFiltered() {
+    auto filter = [this](const Table& filter_columns,
+                         std::shared_ptr<ChunkedArray>* selection) {
+      return EvaluateFilter(filter_columns, selection);
+    };
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(reader_->ReadRowGroupsFiltered({row_group_}, column_projection_,
+                                                 filter_columns_, filter, &table));
+    auto reader = std::make_shared<TableBatchReader>(*table);
+    reader->set_chunksize(options_->batch_size);
+    return MakeFunctionIterator([reader, table] { return reader->Next(); });
+  }
+
+  Status EvaluateFilter(const Table& filter_columns,
+                        std::shared_ptr<ChunkedArray>* selection) {
+    TableBatchReader batches(filter_columns);
+    batches.set_chunksize(options_->batch_size);
+    ArrayVector chunks;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(batches.ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          auto mask, options_->evaluator->Evaluate(*options_->filter, *batch, pool()));
+      std::shared_ptr<Array> chunk;
+      if (mask.is_scalar()) {
+        // As with ExpressionEvaluator::Filter, a null selects nothing
+        BooleanScalar selected(BooleanScalar(true).Equals(*mask.scalar()));
+        RETURN_NOT_OK(MakeArrayFromScalar(pool(), selected, batch->num_rows(), &chunk));
+      } else {
+        chunk = mask.make_array();
+      }
+      chunks.push_back(std::move(chunk));
+    }
+    *selection = std::make_shared<ChunkedArray>(std::move(chunks), boolean());
+    return Status::OK();
+  }
+
+  MemoryPool* pool() const { return context_->pool; }
+
   int row_group_;
   std::vector<int> column_projection_;
+  // The columns referenced by the filter if it should be evaluated first
+  std::vector<int> filter_columns_;
   // The ScanTask _must_ hold a reference to reader_ because there's no
   // guarantee the producing ParquetScanTaskIterator is still alive. This is a
   // contract required by record_batch_reader_
@@ -76,10 +135,12 @@ class ParquetScanTask : public ScanTask {
 };
 
 static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
-    const FileSource& source, parquet::ReaderProperties properties) {
+    const FileSource& source, parquet::ReaderProperties properties,
+    std::shared_ptr<parquet::FileMetaData> metadata = NULLPTR) {
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   try {
-    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    return parquet::ParquetFileReader::Open(std::move(input), std::move(properties),
+                                            std::move(metadata));
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
@@ -88,6 +149,18 @@ static Result<std::unique_ptr<parquet::ParquetFileReader>> OpenReader(
   return Status::UnknownError("unknown exception caught");
 }
 
+static Status ValidateRowGroups(const parquet::FileMetaData& metadata,
+                                const std::vector<int>& row_groups) {
+  for (int row_group : row_groups) {
+    if (row_group < 0 || row_group >= metadata.num_row_groups()) {
+      return Status::IndexError("Trying to scan row group ", row_group, " but ",
+                                "the parquet file only has ", metadata.num_row_groups(),
+                                " row groups");
+    }
+  }
+  return Status::OK();
+}
+
 static parquet::ReaderProperties MakeReaderProperties(
     const ParquetFileFormat& format, MemoryPool* pool = default_memory_pool()) {
   parquet::ReaderProperties properties(pool);
@@ -103,10 +176,10 @@ static parquet::ReaderProperties MakeReaderProperties(
 
 static parquet::ArrowReaderProperties MakeArrowReaderProperties(
     const ParquetFileFormat& format, int64_t batch_size,
-    const parquet::ParquetFileReader& reader) {
+    const parquet::FileMetaData& metadata) {
   parquet::ArrowReaderProperties properties(/* use_threads = */ false);
   for (const std::string& name : format.reader_options.dict_columns) {
-    auto column_index = reader.metadata()->schema()->ColumnIndex(name);
+    auto column_index = metadata.schema()->ColumnIndex(name);
     properties.set_read_dictionary(column_index, true);
   }
   properties.set_batch_size(batch_size);
@@ -183,17 +256,20 @@ class RowGroupSkipper {
 
   RowGroupSkipper(std::shared_ptr<parquet::FileMetaData> metadata,
                   parquet::ArrowReaderProperties arrow_properties,
-                  std::shared_ptr<Expression> filter)
+                  std::shared_ptr<Expression> filter, std::vector<int> row_groups)
       : metadata_(std::move(metadata)),
         arrow_properties_(std::move(arrow_properties)),
         filter_(std::move(filter)),
+        row_groups_(std::move(row_groups)),
         row_group_idx_(0) {
-    num_row_groups_ = metadata_->num_row_groups();
+    if (row_groups_.empty()) {
+      row_groups_ = internal::Iota(metadata_->num_row_groups());
+    }
   }
 
   int Next() {
-    while (row_group_idx_ < num_row_groups_) {
-      const auto row_group_idx = row_group_idx_++;
+    while (row_group_idx_ < static_cast<int>(row_groups_.size())) {
+      const auto row_group_idx = row_groups_[row_group_idx_++];
       const auto row_group = metadata_->RowGroup(row_group_idx);
 
       const auto num_rows = row_group->num_rows();
@@ -224,9 +300,9 @@ class RowGroupSkipper {
   std::shared_ptr<parquet::FileMetaData> metadata_;
   parquet::ArrowReaderProperties arrow_properties_;
   std::shared_ptr<Expression> filter_;
+  std::vector<int> row_groups_;
   int row_group_idx_;
-  int num_row_groups_;
-  int64_t rows_skipped_;
+  int64_t rows_skipped_ = 0;
 };
 
 class ParquetScanTaskIterator {
@@ -234,21 +310,27 @@ class ParquetScanTaskIterator {
   static Result<ScanTaskIterator> Make(std::shared_ptr<ScanOptions> options,
                                        std::shared_ptr<ScanContext> context,
                                        std::unique_ptr<parquet::ParquetFileReader> reader,
-                                       parquet::ArrowReaderProperties arrow_properties) {
+                                       parquet::ArrowReaderProperties arrow_properties,
+                                       std::vector<int> row_groups,
+                                       bool late_materialization) {
     auto metadata = reader->metadata();
 
     auto column_projection = InferColumnProjection(*metadata, arrow_properties, options);
+    std::vector<int> filter_columns;
+    if (late_materialization) {
+      filter_columns = InferFilterColumns(*metadata, arrow_properties, options);
+    }
 
     std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
     RETURN_NOT_OK(parquet::arrow::FileReader::Make(context->pool, std::move(reader),
                                                    arrow_properties, &arrow_reader));
 
     RowGroupSkipper skipper(std::move(metadata), std::move(arrow_properties),
-                            options->filter);
+                            options->filter, std::move(row_groups));
 
     return ScanTaskIterator(ParquetScanTaskIterator(
         std::move(options), std::move(context), std::move(column_projection),
-        std::move(skipper), std::move(arrow_reader)));
+        std::move(filter_columns), std::move(skipper), std::move(arrow_reader)));
   }
 
   Result<std::shared_ptr<ScanTask>> Next() {
@@ -259,8 +341,8 @@ class ParquetScanTaskIterator {
       return nullptr;
     }
 
-    return std::shared_ptr<ScanTask>(
-        new ParquetScanTask(row_group, column_projection_, reader_, options_, context_));
+    return std::shared_ptr<ScanTask>(new ParquetScanTask(
+        row_group, column_projection_, filter_columns_, reader_, options_, context_));
   }
 
  private:
@@ -298,6 +380,44 @@ class ParquetScanTaskIterator {
     return columns_selection;
   }
 
+  // Compute the columns to evaluate the filter with, or none if the filter can't
+  // be evaluated before reading the other columns
+  static std::vector<int> InferFilterColumns(
+      const parquet::FileMetaData& metadata,
+      const parquet::ArrowReaderProperties& arrow_properties,
+      const std::shared_ptr<ScanOptions>& options) {
+    // Only an evaluator which actually filters can select rows up front
+    if (options->filter->Equals(true) ||
+        dynamic_cast<const TreeEvaluator*>(options->evaluator.get()) == nullptr) {
+      return {};
+    }
+    auto maybe_manifest = GetSchemaManifest(metadata, arrow_properties);
+    if (!maybe_manifest.ok()) {
+      return {};
+    }
+    auto manifest = std::move(maybe_manifest).ValueOrDie();
+
+    // Fields missing from the file, e.g. partition fields, are only known to the
+    // scanner
+    std::vector<int> filter_columns;
+    FieldVector filter_fields;
+    for (const auto& name : FieldsInExpression(*options->filter)) {
+      auto it = std::find_if(
+          manifest.schema_fields.begin(), manifest.schema_fields.end(),
+          [&name](const SchemaField& field) { return field.field->name() == name; });
+      if (it == manifest.schema_fields.end()) {
+        return {};
+      }
+      AddColumnIndices(*it, &filter_columns);
+      filter_fields.push_back(it->field);
+    }
+    if (filter_columns.empty() ||
+        !options->filter->Validate(Schema(filter_fields)).ok()) {
+      return {};
+    }
+    return filter_columns;
+  }
+
   static void AddColumnIndices(const SchemaField& schema_field,
                                std::vector<int>* column_projection) {
     if (schema_field.is_leaf()) {
@@ -312,17 +432,20 @@ class ParquetScanTaskIterator {
 
   ParquetScanTaskIterator(std::shared_ptr<ScanOptions> options,
                           std::shared_ptr<ScanContext> context,
-                          std::vector<int> column_projection, RowGroupSkipper skipper,
+                          std::vector<int> column_projection,
+                          std::vector<int> filter_columns, RowGroupSkipper skipper,
                           std::unique_ptr<parquet::arrow::FileReader> reader)
       : options_(std::move(options)),
         context_(std::move(context)),
         column_projection_(std::move(column_projection)),
+        filter_columns_(std::move(filter_columns)),
         skipper_(std::move(skipper)),
         reader_(std::move(reader)) {}
 
   std::shared_ptr<ScanOptions> options_;
   std::shared_ptr<ScanContext> context_;
   std::vector<int> column_projection_;
+  std::vector<int> filter_columns_;
   RowGroupSkipper skipper_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
 };
@@ -358,8 +481,8 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
   auto properties = MakeReaderProperties(*this);
   ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties)));
 
-  auto arrow_properties =
-      MakeArrowReaderProperties(*this, parquet::kArrowDefaultBatchSize, *reader);
+  auto arrow_properties = MakeArrowReaderProperties(
+      *this, parquet::kArrowDefaultBatchSize, *reader->metadata());
   std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
   RETURN_NOT_OK(parquet::arrow::FileReader::Make(default_memory_pool(), std::move(reader),
                                                  std::move(arrow_properties),
@@ -373,12 +496,212 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
 Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
     const FileSource& source, std::shared_ptr<ScanOptions> options,
     std::shared_ptr<ScanContext> context) const {
+  return ScanFile(source, nullptr, {}, std::move(options), std::move(context));
+}
+
+Result<ScanTaskIterator> ParquetFileFormat::ScanFile(
+    const FileSource& source, std::shared_ptr<parquet::FileMetaData> metadata,
+    std::vector<int> row_groups, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<ScanContext> context) const {
+  if (metadata != nullptr) {
+    RETURN_NOT_OK(ValidateRowGroups(*metadata, row_groups));
+
+    // Don't bother opening the file if the statistics rule out all its row groups.
+    auto arrow_properties =
+        MakeArrowReaderProperties(*this, options->batch_size, *metadata);
+    RowGroupSkipper skipper(metadata, std::move(arrow_properties), options->filter,
+                            row_groups);
+    if (skipper.Next() == RowGroupSkipper::kIterationDone) {
+      return MakeEmptyIterator<std::shared_ptr<ScanTask>>();
+    }
+  }
+
   auto properties = MakeReaderProperties(*this, context->pool);
-  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source, std::move(properties)));
+  ARROW_ASSIGN_OR_RAISE(auto reader,
+                        OpenReader(source, std::move(properties), std::move(metadata)));
+  RETURN_NOT_OK(ValidateRowGroups(*reader->metadata(), row_groups));
 
-  auto arrow_properties = MakeArrowReaderProperties(*this, options->batch_size, *reader);
+  auto arrow_properties =
+      MakeArrowReaderProperties(*this, options->batch_size, *reader->metadata());
   return ParquetScanTaskIterator::Make(std::move(options), std::move(context),
-                                       std::move(reader), std::move(arrow_properties));
+                                       std::move(reader), std::move(arrow_properties),
+                                       std::move(row_groups),
+                                       reader_options.late_materialization);
+}
+
+Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragment(
+    FileSource source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<Expression> partition_expression) {
+  return MakeFragment(std::move(source), std::move(options),
+                      std::move(partition_expression), {});
+}
+
+Result<std::shared_ptr<FileFragment>> ParquetFileFormat::MakeFragment(
+    FileSource source, std::shared_ptr<ScanOptions> options,
+    std::shared_ptr<Expression> partition_expression, std::vector<int> row_groups) {
+  std::shared_ptr<parquet::FileMetaData> metadata;
+  if (source.type() == FileSource::PATH) {
+    metadata = GetFileMetadata(source.path());
+  }
+
+  return std::shared_ptr<FileFragment>(new ParquetFileFragment(
+      std::move(source), shared_from_this(), std::move(options),
+      std::move(partition_expression), std::move(metadata), std::move(row_groups)));
+}
+
+Result<FragmentVector> ParquetFileFormat::SplitFragment(
+    std::shared_ptr<FileFragment> fragment, const Expression& predicate) const {
+  if (!split_row_groups) {
+    return FragmentVector{std::move(fragment)};
+  }
+
+  auto parquet_fragment = internal::checked_pointer_cast<ParquetFileFragment>(fragment);
+  return parquet_fragment->SplitByRowGroup(predicate.Copy());
+}
+
+std::shared_ptr<parquet::FileMetaData> ParquetFileFormat::GetFileMetadata(
+    const std::string& path) const {
+  if (file_metadata_ == nullptr) {
+    return nullptr;
+  }
+
+  auto it = file_metadata_->find(path);
+  return it != file_metadata_->end() ? it->second : nullptr;
+}
+
+Result<std::shared_ptr<FileFormat>> ParquetFileFormat::WithMetadataFile(
+    const FileSource& metadata_source) const {
+  auto properties = MakeReaderProperties(*this);
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(metadata_source, std::move(properties)));
+  auto metadata = reader->metadata();
+
+  // The paths of the ColumnChunks are relative to the summary file's directory
+  const auto base_dir = fs::internal::GetAbstractPathParent(metadata_source.path()).first;
+
+  // Gather the row groups of each file
+  std::unordered_map<std::string, std::vector<int>> row_groups;
+  std::vector<std::string> paths;
+  auto file_metadata = std::make_shared<FileMetadataMap>();
+  try {
+    for (int i = 0; i < metadata->num_row_groups(); ++i) {
+      auto row_group = metadata->RowGroup(i);
+      if (row_group->num_columns() == 0) {
+        return Status::Invalid("Parquet summary file '", metadata_source.path(),
+                               "' has a row group without any column");
+      }
+
+      const auto& relative_path = row_group->ColumnChunk(0)->file_path();
+      if (relative_path.empty()) {
+        return Status::Invalid("Parquet summary file '", metadata_source.path(),
+                               "' has a row group without file_path");
+      }
+
+      auto path = fs::internal::ConcatAbstractPath(base_dir, relative_path);
+      auto& indices = row_groups[path];
+      if (indices.empty()) {
+        paths.push_back(path);
+      }
+      indices.push_back(i);
+    }
+
+    for (const auto& path : paths) {
+      (*file_metadata)[path] = metadata->Subset(row_groups[path]);
+    }
+  } catch (const ::parquet::ParquetException& e) {
+    return Status::IOError("Could not read parquet summary file '",
+                           metadata_source.path(), "': ", e.what());
+  }
+
+  auto format = std::make_shared<ParquetFileFormat>(*this);
+  format->file_metadata_ = std::move(file_metadata);
+  return format;
+}
+
+Status ParquetFileFormat::WriteMetadataFile(fs::FileSystem* filesystem,
+                                            const std::vector<std::string>& paths,
+                                            const std::string& metadata_path) const {
+  if (paths.empty()) {
+    return Status::Invalid("Can't write a parquet summary file without any file");
+  }
+
+  const auto base_dir = fs::internal::GetAbstractPathParent(metadata_path).first;
+
+  std::shared_ptr<parquet::FileMetaData> summary;
+  for (const auto& path : paths) {
+    auto relative_path = fs::internal::RemoveAncestor(base_dir, path);
+    if (!relative_path.has_value()) {
+      return Status::Invalid("Parquet file '", path,
+                             "' isn't located under the directory of summary file '",
+                             metadata_path, "'");
+    }
+
+    auto properties = MakeReaderProperties(*this);
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader, OpenReader(FileSource(path, filesystem), std::move(properties)));
+    auto metadata = reader->metadata();
+    metadata->set_file_path(relative_path->to_string());
+
+    if (summary == nullptr) {
+      summary = std::move(metadata);
+      continue;
+    }
+
+    if (!summary->schema()->Equals(*metadata->schema())) {
+      return Status::Invalid("Parquet file '", path,
+                             "' has a different schema than the previous files");
+    }
+    summary->AppendRowGroups(*metadata);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto sink, filesystem->OpenOutputStream(metadata_path));
+  RETURN_NOT_OK(parquet::arrow::WriteMetaDataFile(*summary, sink.get()));
+  return sink->Close();
+}
+
+Result<ScanTaskIterator> ParquetFileFragment::Scan(std::shared_ptr<ScanContext> context) {
+  auto format = internal::checked_pointer_cast<ParquetFileFormat>(format_);
+  return format->ScanFile(source_, metadata_, row_groups_, scan_options_,
+                          std::move(context));
+}
+
+Result<FragmentVector> ParquetFileFragment::SplitByRowGroup(
+    const std::shared_ptr<Expression>& predicate) {
+  const auto& format = internal::checked_cast<const ParquetFileFormat&>(*format_);
+
+  auto metadata = metadata_;
+  if (metadata == nullptr) {
+    auto properties = MakeReaderProperties(format);
+    ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source_, std::move(properties)));
+    metadata = reader->metadata();
+  }
+  RETURN_NOT_OK(ValidateRowGroups(*metadata, row_groups_));
+
+  auto row_groups = row_groups_;
+  if (row_groups.empty()) {
+    row_groups = internal::Iota(metadata->num_row_groups());
+  }
+
+  auto arrow_properties =
+      MakeArrowReaderProperties(format, parquet::kArrowDefaultBatchSize, *metadata);
+
+  FragmentVector fragments;
+  for (int row_group : row_groups) {
+    // As when scanning, statistics which can't be converted are ignored.
+    auto statistics =
+        RowGroupStatisticsAsExpression(*metadata->RowGroup(row_group), arrow_properties)
+            .ValueOr(scalar(true));
+
+    auto simplified = predicate->Assume(*statistics);
+    if (simplified->IsNull() || simplified->Equals(false)) {
+      continue;
+    }
+
+    fragments.emplace_back(new ParquetFileFragment(
+        source_, format_, scan_options_, and_(partition_expression_, statistics),
+        metadata, {row_group}));
+  }
+
+  return fragments;
 }
 
 }  // namespace dataset
@@ -19,8 +19,10 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
@@ -75,8 +77,26 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     /// @{
     std::unordered_set<std::string> dict_columns;
     /// @}
+
+    /// \brief Read the columns referenced by the scan's filter first, and only
+    /// the selected rows of the other columns.
+    ///
+    /// Row groups without any selected row are not read further, and data pages
+    /// without any selected row are skipped without being decompressed.  This
+    /// pays off with selective filters on a few columns.  It only applies when
+    /// the filter solely references fields of the file.
+    bool late_materialization = false;
   } reader_options;
 
+  /// \brief Split the fragments of a FileSystemDataset into one fragment per row group.
+  ///
+  /// Row group fragments carry the row group's statistics in their partition
+  /// expression and are omitted when the statistics can't satisfy the scan's filter,
+  /// so that large files can be pruned and scanned in parallel at row group
+  /// granularity. Listing the fragments of a dataset then reads the metadata of its
+  /// files, unless it was pre-loaded from a summary file (see WithMetadataFile).
+  bool split_row_groups = false;
+
   Result<bool> IsSupported(const FileSource& source) const override;
 
   /// \brief Return the schema of the file if possible.
@@ -86,6 +106,102 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
   Result<ScanTaskIterator> ScanFile(const FileSource& source,
                                     std::shared_ptr<ScanOptions> options,
                                     std::shared_ptr<ScanContext> context) const override;
+
+  /// \brief Open a subset of the row groups of a file for scanning (all of them if
+  /// `row_groups` is empty), using pre-loaded metadata if not null.
+  ///
+  /// Row groups are skipped with the statistics of `metadata` before the file is
+  /// opened, so a file without any matching row group is never read.
+  Result<ScanTaskIterator> ScanFile(const FileSource& source,
+                                    std::shared_ptr<parquet::FileMetaData> metadata,
+                                    std::vector<int> row_groups,
+                                    std::shared_ptr<ScanOptions> options,
+                                    std::shared_ptr<ScanContext> context) const;
+
+  using FileFormat::MakeFragment;
+
+  /// \brief Create a ParquetFileFragment, with the file's metadata if it was
+  /// gathered from a summary file.
+  Result<std::shared_ptr<FileFragment>> MakeFragment(
+      FileSource source, std::shared_ptr<ScanOptions> options,
+      std::shared_ptr<Expression> partition_expression) override;
+
+  /// \brief Create a ParquetFileFragment viewing a subset of the row groups of a file
+  /// (all of them if `row_groups` is empty).
+  Result<std::shared_ptr<FileFragment>> MakeFragment(
+      FileSource source, std::shared_ptr<ScanOptions> options,
+      std::shared_ptr<Expression> partition_expression, std::vector<int> row_groups);
+
+  /// \brief Split a ParquetFileFragment by row group if split_row_groups is enabled.
+  Result<FragmentVector> SplitFragment(std::shared_ptr<FileFragment> fragment,
+                                       const Expression& predicate) const override;
+
+  /// \brief Return a ParquetFileFormat which pre-loads the metadata of the files
+  /// described by a `_metadata` summary file (see WriteMetadataFile).
+  ///
+  /// Fragments of the described files then prune row groups with the pre-loaded
+  /// statistics and don't need to read the files' footers. The summary file must
+  /// be kept up to date with the files it describes.
+  Result<std::shared_ptr<FileFormat>> WithMetadataFile(
+      const FileSource& metadata_source) const override;
+
+  /// \brief Return the metadata of the file at `path` pre-loaded from a summary
+  /// file, or null if there isn't any.
+  std::shared_ptr<parquet::FileMetaData> GetFileMetadata(const std::string& path) const;
+
+  /// \brief Write a `_metadata` summary file gathering the footers of Parquet files.
+  ///
+  /// The row groups of each file are appended to the summary with their file_path
+  /// set relative to the directory containing `metadata_path`, so the files must
+  /// be located in that directory or its subdirectories. All files must have the
+  /// same Parquet schema.
+  Status WriteMetadataFile(fs::FileSystem* filesystem,
+                           const std::vector<std::string>& paths,
+                           const std::string& metadata_path) const;
+
+ private:
+  using FileMetadataMap =
+      std::unordered_map<std::string, std::shared_ptr<parquet::FileMetaData>>;
+
+  /// Metadata pre-loaded from a summary file, by file path
+  std::shared_ptr<const FileMetadataMap> file_metadata_;
+};
+
+/// \brief A FileFragment of a Parquet file, viewing a subset of its row groups and
+/// optionally with its metadata pre-loaded.
+class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
+ public:
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanContext> context) override;
+
+  /// \brief The pre-loaded metadata of the file, or null
+  const std::shared_ptr<parquet::FileMetaData>& metadata() const { return metadata_; }
+
+  /// \brief The indices of the row groups viewed by this fragment, or empty if all
+  const std::vector<int>& row_groups() const { return row_groups_; }
+
+  /// \brief Split this fragment into one fragment per row group.
+  ///
+  /// Each fragment's partition expression is conjoined with its row group's
+  /// statistics. Row groups whose statistics can't satisfy `predicate` are omitted.
+  /// The file's metadata is read if it wasn't pre-loaded, and is shared with the
+  /// resulting fragments.
+  Result<FragmentVector> SplitByRowGroup(const std::shared_ptr<Expression>& predicate);
+
+ private:
+  ParquetFileFragment(FileSource source, std::shared_ptr<FileFormat> format,
+                      std::shared_ptr<ScanOptions> scan_options,
+                      std::shared_ptr<Expression> partition_expression,
+                      std::shared_ptr<parquet::FileMetaData> metadata,
+                      std::vector<int> row_groups)
+      : FileFragment(std::move(source), std::move(format), std::move(scan_options),
+                     std::move(partition_expression)),
+        metadata_(std::move(metadata)),
+        row_groups_(std::move(row_groups)) {}
+
+  std::shared_ptr<parquet::FileMetaData> metadata_;
+  std::vector<int> row_groups_;
+
+  friend class ParquetFileFormat;
 };
 
 }  // namespace dataset
@@ -22,14 +22,18 @@
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/discovery.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
 #include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/metadata.h"
 
 namespace arrow {
 namespace dataset {
@@ -398,5 +402,197 @@ TEST_F(TestParquetFileFormat, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormat, SplitByRowGroup) {
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+  auto parquet_fragment = internal::checked_pointer_cast<ParquetFileFragment>(fragment);
+
+  auto split = [&](const Expression& predicate) {
+    EXPECT_OK_AND_ASSIGN(auto fragments,
+                         parquet_fragment->SplitByRowGroup(predicate.Copy()));
+    return fragments;
+  };
+
+  auto fragments = split(*scalar(true));
+  ASSERT_EQ(fragments.size(), kNumRowGroups);
+  int64_t num_rows = 0;
+  for (int i = 0; i < kNumRowGroups; i++) {
+    auto row_group_fragment =
+        internal::checked_pointer_cast<ParquetFileFragment>(fragments[i]);
+    ASSERT_EQ(row_group_fragment->row_groups(), std::vector<int>{i});
+    ASSERT_NE(row_group_fragment->metadata(), nullptr);
+    // The row group's statistics are part of its partition expression
+    auto satisfied = ("i64"_ == int64_t(i + 1))
+                         .Assume(*row_group_fragment->partition_expression());
+    ASSERT_TRUE(satisfied->Equals(true));
+    CountRowsAndBatchesInScan(row_group_fragment.get(), i + 1, 1);
+    num_rows += i + 1;
+  }
+  ASSERT_EQ(num_rows, kTotalNumRows);
+
+  ASSERT_EQ(split("i64"_ == int64_t(3)).size(), 1);
+  ASSERT_EQ(split("i64"_ < int64_t(6)).size(), 5);
+  ASSERT_EQ(split("i64"_ > int64_t(kNumRowGroups)).size(), 0);
+
+  // Splitting a fragment viewing a subset of the row groups
+  ASSERT_OK_AND_ASSIGN(fragment, format_->MakeFragment(*source, opts_, scalar(true),
+                                                       {1, 3, 5, 7}));
+  CountRowsAndBatchesInScan(fragment.get(), 2 + 4 + 6 + 8, 4);
+  parquet_fragment = internal::checked_pointer_cast<ParquetFileFragment>(fragment);
+  ASSERT_EQ(split("i64"_ < int64_t(6)).size(), 2);
+
+  ASSERT_OK_AND_ASSIGN(fragment, format_->MakeFragment(*source, opts_, scalar(true),
+                                                       {kNumRowGroups}));
+  ASSERT_RAISES(IndexError, fragment->Scan(ctx_));
+}
+
+TEST_F(TestParquetFileFormat, SplitRowGroupsInDataset) {
+  constexpr int64_t kNumRowGroups = 16;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  ASSERT_OK(fs->CreateFile("data.parquet", Write(reader.get())->ToString()));
+
+  format_->split_row_groups = true;
+  ASSERT_OK_AND_ASSIGN(
+      auto dataset,
+      FileSystemDataset::Make(reader->schema(), scalar(true), format_, fs,
+                              {fs::File("data.parquet")}));
+
+  opts_ = ScanOptions::Make(reader->schema());
+  opts_->filter = ("i64"_ >= int64_t(10)).Copy();
+  // Row groups ruled out by the filter are pruned before scanning
+  auto fragments = IteratorToVector(dataset->GetFragments(opts_));
+  ASSERT_EQ(fragments.size(), kNumRowGroups - 9);
+  int64_t num_rows = 0;
+  for (const auto& fragment : fragments) {
+    for (auto maybe_batch : Batches(fragment.get())) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      num_rows += batch->num_rows();
+    }
+  }
+  ASSERT_EQ(num_rows, (10 + kNumRowGroups) * (kNumRowGroups - 9) / 2);
+}
+
+TEST_F(TestParquetFileFormat, MetadataFile) {
+  // Each file holds a single row group of the ArithmeticDataset, keyed by i.
+  constexpr int kNumFiles = 4;
+  auto fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  std::vector<std::string> paths;
+  for (int i = 1; i <= kNumFiles; i++) {
+    std::shared_ptr<Table> table;
+    ASSERT_OK(Table::FromRecordBatches({ArithmeticDatasetFixture::GetRecordBatch(i)},
+                                       &table));
+    paths.push_back("ds/i64=" + std::to_string(i) + "/data.parquet");
+    ASSERT_OK(fs->CreateFile(paths.back(), Write(*table)->ToString()));
+  }
+
+  ASSERT_RAISES(Invalid, format_->WriteMetadataFile(fs.get(), paths, "other/_metadata"));
+  ASSERT_RAISES(Invalid, format_->WriteMetadataFile(fs.get(), {}, "ds/_metadata"));
+  ASSERT_OK(format_->WriteMetadataFile(fs.get(), paths, "ds/_metadata"));
+
+  ASSERT_OK_AND_ASSIGN(auto format,
+                       format_->WithMetadataFile(FileSource("ds/_metadata", fs.get())));
+  auto parquet_format = internal::checked_pointer_cast<ParquetFileFormat>(format);
+  for (int i = 1; i <= kNumFiles; i++) {
+    auto metadata = parquet_format->GetFileMetadata(paths[i - 1]);
+    ASSERT_NE(metadata, nullptr);
+    ASSERT_EQ(metadata->num_row_groups(), 1);
+    ASSERT_EQ(metadata->num_rows(), i);
+  }
+  ASSERT_EQ(format_->GetFileMetadata(paths[0]), nullptr);
+  ASSERT_EQ(parquet_format->GetFileMetadata("ds/unknown.parquet"), nullptr);
+
+  // A file whose row groups are all ruled out by the pre-loaded statistics is
+  // never opened, so corrupting it goes unnoticed.
+  ASSERT_OK(fs->CreateFile(paths[0], "corrupted"));
+  opts_ = ScanOptions::Make(ArithmeticDatasetFixture::schema());
+  opts_->filter = ("i64"_ >= int64_t(2)).Copy();
+
+  ASSERT_OK_AND_ASSIGN(auto fragment,
+                       format->MakeFragment(FileSource(paths[0], fs.get()), opts_));
+  CountRowsAndBatchesInScan(fragment.get(), 0, 0);
+  ASSERT_OK_AND_ASSIGN(fragment, format_->MakeFragment({paths[0], fs.get()}, opts_));
+  ASSERT_RAISES(IOError, fragment->Scan(ctx_));
+
+  ASSERT_OK_AND_ASSIGN(fragment, format->MakeFragment({paths[3], fs.get()}, opts_));
+  CountRowsAndBatchesInScan(fragment.get(), 4, 1);
+
+  // The same through a dataset discovered with the summary file
+  fs::FileSelector selector;
+  selector.base_dir = "ds";
+  selector.recursive = true;
+  FileSystemFactoryOptions options;
+  options.metadata_path = "ds/_metadata";
+  ASSERT_OK_AND_ASSIGN(auto factory,
+                       FileSystemDatasetFactory::Make(fs, selector, format_, options));
+  ASSERT_OK_AND_ASSIGN(auto schema, factory->Inspect());
+  AssertSchemaEqual(*schema, *ArithmeticDatasetFixture::schema(),
+                    /*check_metadata=*/false);
+
+  ASSERT_OK_AND_ASSIGN(auto dataset, factory->Finish(schema));
+  int64_t num_rows = 0;
+  for (auto maybe_fragment : dataset->GetFragments(opts_)) {
+    ASSERT_OK_AND_ASSIGN(auto fragment, std::move(maybe_fragment));
+    auto parquet_fragment =
+        internal::checked_pointer_cast<ParquetFileFragment>(std::move(fragment));
+    ASSERT_NE(parquet_fragment->metadata(), nullptr);
+    for (auto maybe_batch : Batches(parquet_fragment.get())) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      num_rows += batch->num_rows();
+    }
+  }
+  ASSERT_EQ(num_rows, 2 + 3 + 4);
+}
+
+TEST_F(TestParquetFileFormat, LateMaterialization) {
+  // A single row group, which the statistics can't rule out
+  constexpr int64_t kNumRows = 1000;
+  std::vector<int64_t> i64(kNumRows);
+  std::vector<double> f64(kNumRows);
+  for (int64_t i = 0; i < kNumRows; i++) {
+    i64[i] = i;
+    f64[i] = 0.5 * static_cast<double>(i);
+  }
+  std::shared_ptr<Array> i64_array, f64_array;
+  ArrayFromVector<Int64Type>(i64, &i64_array);
+  ArrayFromVector<DoubleType>(f64, &f64_array);
+  auto table = Table::Make(schema({field("i64", int64()), field("f64", float64())}),
+                           {i64_array, f64_array});
+  auto source = internal::make_unique<FileSource>(Write(*table));
+
+  opts_ = ScanOptions::Make(table->schema());
+  opts_->filter = ("i64"_ >= int64_t(100) and "i64"_ < int64_t(150)).Copy();
+  opts_->evaluator = std::make_shared<TreeEvaluator>();
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source, opts_));
+
+  // The fragment doesn't filter rows by itself
+  CountRowsAndBatchesInScan(fragment.get(), kNumRows, 1);
+
+  format_->reader_options.late_materialization = true;
+  RecordBatchVector batches;
+  for (auto maybe_batch : Batches(fragment.get())) {
+    ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+    batches.push_back(std::move(batch));
+  }
+  std::shared_ptr<Table> result;
+  ASSERT_OK(Table::FromRecordBatches(batches, &result));
+  auto expected = table->Slice(100, 50);
+  ASSERT_EQ(result->num_columns(), 2);
+  for (int i = 0; i < 2; i++) {
+    AssertChunkedEqual(*expected->column(i), *result->column(i));
+  }
+
+  // Filters on fields missing from the file fall back to a regular scan
+  opts_->filter = ("i64"_ < int64_t(150) and "part"_ == int64_t(1)).Copy();
+  CountRowsAndBatchesInScan(fragment.get(), kNumRows, 1);
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -0,0 +1,552 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/cachingfs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/concurrency.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace fs {
+
+CachingFileSystemOptions CachingFileSystemOptions::Defaults() {
+  return CachingFileSystemOptions();
+}
+
+bool CachingFileSystemOptions::Equals(const CachingFileSystemOptions& other) const {
+  return capacity == other.capacity && block_size == other.block_size;
+}
+
+double CachingFileSystemStats::hit_rate() const {
+  const int64_t total = hits + misses;
+  return total > 0 ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+}
+
+namespace {
+
+using BlockFetcher = std::function<Result<std::shared_ptr<Buffer>>()>;
+
+// Cached blocks are named "<16 hex digits of file key>-<block index>"
+std::string FormatBlockPrefix(uint64_t file_key) {
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << file_key << "-";
+  return ss.str();
+}
+
+bool IsBlockName(const std::string& name) {
+  if (name.size() < 18 || name[16] != '-') {
+    return false;
+  }
+  for (size_t i = 0; i < name.size(); ++i) {
+    const char c = name[i];
+    const bool valid = (i < 16) ? std::isxdigit(static_cast<unsigned char>(c)) != 0
+                                : (i == 16 || (c >= '0' && c <= '9'));
+    if (!valid) {
+      return false;
+    }
+  }
+  return true;
+}
+
+constexpr char kTempSuffix[] = ".tmp";
+
+bool IsTempName(const std::string& name) {
+  return name.find(kTempSuffix) != std::string::npos;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------
+// CachingFileSystem::Impl: the LRU index of cached blocks
+
+class CachingFileSystem::Impl {
+ public:
+  Impl(std::shared_ptr<FileSystem> base_fs, std::shared_ptr<FileSystem> cache_fs,
+       const CachingFileSystemOptions& options)
+      : base_fs_(std::move(base_fs)), cache_fs_(std::move(cache_fs)), options_(options) {}
+
+  // Register blocks already present in the cache filesystem
+  Status LoadEntries() {
+    FileSelector select;
+    select.base_dir = "";
+    ARROW_ASSIGN_OR_RAISE(auto infos, cache_fs_->GetFileInfo(select));
+    // Oldest blocks are evicted first
+    std::stable_sort(infos.begin(), infos.end(),
+                     [](const FileInfo& a, const FileInfo& b) {
+                       return a.mtime() < b.mtime();
+                     });
+
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& info : infos) {
+        if (!info.IsFile()) {
+          continue;
+        }
+        const auto name = info.base_name();
+        if (IsTempName(name)) {
+          // Leftover from an interrupted write
+          evicted.push_back(info.path());
+        } else if (IsBlockName(name)) {
+          InsertUnlocked(name, info.size());
+        }
+      }
+      EvictUnlocked(&evicted);
+    }
+    DeleteBlocks(evicted);
+    return Status::OK();
+  }
+
+  // Read `nbytes` at `offset` in the given block, from the cache if possible,
+  // otherwise using `fetch` to get the whole block from the base filesystem.
+  Result<std::shared_ptr<Buffer>> ReadBlock(const std::string& name, int64_t offset,
+                                            int64_t nbytes, const BlockFetcher& fetch) {
+    if (Touch(name)) {
+      auto maybe_buffer = ReadFromCache(name, offset, nbytes);
+      if (maybe_buffer.ok()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.hits;
+        stats_.bytes_read_from_cache += (*maybe_buffer)->size();
+        return maybe_buffer;
+      }
+      // The block may have been evicted concurrently or removed externally
+      Forget(name);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto block, fetch());
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++stats_.misses;
+      stats_.bytes_fetched += block->size();
+    }
+    // Failing to populate the cache shouldn't fail the read
+    Status st = Store(name, block);
+    if (!st.ok()) {
+      ARROW_LOG(WARNING) << "Failed to store block '" << name << "' in cache: " << st;
+    }
+    offset = std::min(offset, block->size());
+    return SliceBuffer(block, offset, std::min(nbytes, block->size() - offset));
+  }
+
+  CachingFileSystemStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto stats = stats_;
+    stats.cached_bytes = cached_bytes_;
+    return stats;
+  }
+
+  const std::shared_ptr<FileSystem>& base_fs() const { return base_fs_; }
+  const std::shared_ptr<FileSystem>& cache_fs() const { return cache_fs_; }
+  const CachingFileSystemOptions& options() const { return options_; }
+
+ protected:
+  struct Entry {
+    std::string name;
+    int64_t size;
+  };
+  using EntryList = std::list<Entry>;
+
+  // Mark the block as most recently used, return whether it is cached
+  bool Touch(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(name);
+    if (it == index_.end()) {
+      return false;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return true;
+  }
+
+  void Forget(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(name);
+    if (it != index_.end()) {
+      cached_bytes_ -= it->second->size;
+      lru_.erase(it->second);
+      index_.erase(it);
+    }
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadFromCache(const std::string& name, int64_t offset,
+                                                int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto file, cache_fs_->OpenInputFile(name));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, file->ReadAt(offset, nbytes));
+    RETURN_NOT_OK(file->Close());
+    return buffer;
+  }
+
+  Status Store(const std::string& name, const std::shared_ptr<Buffer>& block) {
+    // Write to a temporary file first, so that concurrent readers never
+    // see a partially written block
+    std::stringstream ss;
+    ss << name << kTempSuffix << temp_counter_++;
+    const auto temp_name = ss.str();
+    {
+      ARROW_ASSIGN_OR_RAISE(auto stream, cache_fs_->OpenOutputStream(temp_name));
+      RETURN_NOT_OK(stream->Write(block));
+      RETURN_NOT_OK(stream->Close());
+    }
+    RETURN_NOT_OK(cache_fs_->Move(temp_name, name));
+
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      InsertUnlocked(name, block->size());
+      EvictUnlocked(&evicted);
+    }
+    DeleteBlocks(evicted);
+    return Status::OK();
+  }
+
+  void InsertUnlocked(const std::string& name, int64_t size) {
+    if (index_.find(name) != index_.end()) {
+      // Already inserted by a concurrent reader
+      return;
+    }
+    lru_.push_front({name, size});
+    index_.emplace(name, lru_.begin());
+    cached_bytes_ += size;
+  }
+
+  void EvictUnlocked(std::vector<std::string>* evicted) {
+    while (cached_bytes_ > options_.capacity && !lru_.empty()) {
+      const auto& entry = lru_.back();
+      evicted->push_back(entry.name);
+      cached_bytes_ -= entry.size;
+      ++stats_.evictions;
+      index_.erase(entry.name);
+      lru_.pop_back();
+    }
+  }
+
+  void DeleteBlocks(const std::vector<std::string>& names) {
+    for (const auto& name : names) {
+      // The block may still be open by a concurrent reader, which is
+      // harmless on POSIX but may fail on Windows.
+      Status st = cache_fs_->DeleteFile(name);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed to delete block '" << name
+                           << "' from cache: " << st;
+      }
+    }
+  }
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<FileSystem> cache_fs_;
+  const CachingFileSystemOptions options_;
+  std::atomic<int64_t> temp_counter_{0};
+
+  // Protects the members below
+  mutable std::mutex mutex_;
+  // Most recently used entries first
+  EntryList lru_;
+  std::unordered_map<std::string, EntryList::iterator> index_;
+  int64_t cached_bytes_ = 0;
+  CachingFileSystemStats stats_;
+};
+
+namespace {
+
+// A RandomAccessFile reading blocks through the cache, and falling back on
+// the base filesystem on cache misses.
+class CachedInputFile
+    : public io::internal::RandomAccessFileConcurrencyWrapper<CachedInputFile> {
+ public:
+  CachedInputFile(std::shared_ptr<CachingFileSystem::Impl> impl, const FileInfo& info)
+      : impl_(std::move(impl)), path_(info.path()), size_(info.size()) {
+    // Key blocks on the file's identity, so that a changed file doesn't hit
+    // stale blocks, and on the block size, as block indices depend on it
+    std::stringstream ss;
+    ss << path_ << '\0' << info.mtime().time_since_epoch().count() << '\0' << size_
+       << '\0' << impl_->options().block_size;
+    const auto key = ss.str();
+    block_prefix_ = FormatBlockPrefix(
+        ::arrow::internal::ComputeStringHash<0>(key.data(), key.size()));
+  }
+
+  bool closed() const override { return closed_; }
+
+ protected:
+  friend RandomAccessFileConcurrencyWrapper<CachedInputFile>;
+
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status DoClose() {
+    closed_ = true;
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (base_file_ != nullptr) {
+      RETURN_NOT_OK(base_file_->Close());
+      base_file_.reset();
+    }
+    return Status::OK();
+  }
+
+  Result<int64_t> DoTell() const {
+    RETURN_NOT_OK(CheckClosed());
+    return position_;
+  }
+
+  Status DoSeek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || position > size_) {
+      return Status::IOError("Seek out of bounds");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> DoGetSize() {
+    RETURN_NOT_OK(CheckClosed());
+    return size_;
+  }
+
+  Result<std::shared_ptr<Buffer>> DoReadAt(int64_t position, int64_t nbytes) {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, size_));
+
+    const int64_t block_size = impl_->options().block_size;
+    BufferVector pieces;
+    int64_t total_size = 0;
+    while (nbytes > 0) {
+      const int64_t block_index = position / block_size;
+      const int64_t block_start = block_index * block_size;
+      const int64_t block_length = std::min(block_size, size_ - block_start);
+      const int64_t offset = position - block_start;
+      const int64_t chunk_size = std::min(nbytes, block_length - offset);
+
+      ARROW_ASSIGN_OR_RAISE(
+          auto piece,
+          impl_->ReadBlock(block_prefix_ + std::to_string(block_index), offset,
+                           chunk_size, [&]() -> Result<std::shared_ptr<Buffer>> {
+                             ARROW_ASSIGN_OR_RAISE(auto file, GetBaseFile());
+                             return file->ReadAt(block_start, block_length);
+                           }));
+      total_size += piece->size();
+      position += piece->size();
+      nbytes -= piece->size();
+      const bool truncated = piece->size() < chunk_size;
+      pieces.push_back(std::move(piece));
+      if (truncated) {
+        // The underlying file was truncated since it was opened
+        break;
+      }
+    }
+
+    if (pieces.size() == 1) {
+      return pieces[0];
+    }
+    std::shared_ptr<Buffer> out;
+    RETURN_NOT_OK(AllocateBuffer(total_size, &out));
+    uint8_t* out_data = out->mutable_data();
+    for (const auto& piece : pieces) {
+      std::memcpy(out_data, piece->data(), static_cast<size_t>(piece->size()));
+      out_data += piece->size();
+    }
+    return out;
+  }
+
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position, nbytes));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    return buffer->size();
+  }
+
+  Result<int64_t> DoRead(int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DoReadAt(position_, nbytes, out));
+    position_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, DoReadAt(position_, nbytes));
+    position_ += buffer->size();
+    return buffer;
+  }
+
+  // The base file is only opened on the first cache miss
+  Result<std::shared_ptr<io::RandomAccessFile>> GetBaseFile() {
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (base_file_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(base_file_, impl_->base_fs()->OpenInputFile(path_));
+    }
+    return base_file_;
+  }
+
+  std::shared_ptr<CachingFileSystem::Impl> impl_;
+  const std::string path_;
+  const int64_t size_;
+  std::string block_prefix_;
+  bool closed_ = false;
+  int64_t position_ = 0;
+
+  std::mutex base_file_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+};
+
+}  // namespace
+
+// -----------------------------------------------------------------------
+// CachingFileSystem implementation
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+CachingFileSystem::~CachingFileSystem() {}
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, std::shared_ptr<FileSystem> cache_fs,
+    const CachingFileSystemOptions& options) {
+  if (options.block_size <= 0) {
+    return Status::Invalid("CachingFileSystem block size must be strictly positive");
+  }
+  if (options.capacity <= 0) {
+    return Status::Invalid("CachingFileSystem capacity must be strictly positive");
+  }
+  auto impl = std::make_shared<Impl>(std::move(base_fs), std::move(cache_fs), options);
+  RETURN_NOT_OK(impl->LoadEntries());
+  return std::shared_ptr<CachingFileSystem>(new CachingFileSystem(std::move(impl)));
+}
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, const std::string& local_cache_dir,
+    const CachingFileSystemOptions& options) {
+  auto local_fs = std::make_shared<LocalFileSystem>();
+  RETURN_NOT_OK(local_fs->CreateDir(local_cache_dir));
+  auto cache_fs = std::make_shared<SubTreeFileSystem>(local_cache_dir, local_fs);
+  return Make(std::move(base_fs), std::move(cache_fs), options);
+}
+
+std::shared_ptr<FileSystem> CachingFileSystem::base_fs() const {
+  return impl_->base_fs();
+}
+
+std::shared_ptr<FileSystem> CachingFileSystem::cache_fs() const {
+  return impl_->cache_fs();
+}
+
+CachingFileSystemOptions CachingFileSystem::options() const { return impl_->options(); }
+
+CachingFileSystemStats CachingFileSystem::stats() const { return impl_->stats(); }
+
+Result<std::string> CachingFileSystem::NormalizePath(std::string path) {
+  return impl_->base_fs()->NormalizePath(std::move(path));
+}
+
+bool CachingFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& caching = checked_cast<const CachingFileSystem&>(other);
+  return impl_->base_fs()->Equals(caching.base_fs()) &&
+         impl_->cache_fs()->Equals(caching.cache_fs()) &&
+         impl_->options().Equals(caching.options());
+}
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  return impl_->base_fs()->GetFileInfo(path);
+}
+
+Result<std::vector<FileInfo>> CachingFileSystem::GetFileInfo(
+    const FileSelector& selector) {
+  return impl_->base_fs()->GetFileInfo(selector);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return impl_->base_fs()->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  return impl_->base_fs()->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path) {
+  return impl_->base_fs()->DeleteDirContents(path);
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  return impl_->base_fs()->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  return impl_->base_fs()->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  return impl_->base_fs()->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, OpenInputFile(path));
+  ARROW_ASSIGN_OR_RAISE(auto size, file->GetSize());
+  return io::RandomAccessFile::GetStream(std::move(file), 0, size);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, impl_->base_fs()->GetFileInfo(path));
+  if (!info.IsFile()) {
+    // Let the base filesystem produce the appropriate error
+    return impl_->base_fs()->OpenInputFile(path);
+  }
+  return std::make_shared<CachedInputFile>(impl_, info);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path) {
+  return impl_->base_fs()->OpenOutputStream(path);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path) {
+  return impl_->base_fs()->OpenAppendStream(path);
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for the CachingFileSystem implementation.
+struct ARROW_EXPORT CachingFileSystemOptions {
+  /// Maximum number of bytes stored in the cache, beyond which the least
+  /// recently used blocks are evicted
+  int64_t capacity = 1LL << 30;
+
+  /// Size in bytes of the blocks files are split into for caching.
+  ///
+  /// Each cache miss fetches a whole block from the underlying filesystem.
+  int64_t block_size = 1LL << 20;
+
+  /// \brief Initialize with defaults
+  static CachingFileSystemOptions Defaults();
+
+  bool Equals(const CachingFileSystemOptions& other) const;
+};
+
+/// Statistics about the use of a CachingFileSystem.
+struct ARROW_EXPORT CachingFileSystemStats {
+  /// Number of block reads served from the cache
+  int64_t hits = 0;
+  /// Number of block reads that had to be fetched from the underlying filesystem
+  int64_t misses = 0;
+  /// Number of blocks evicted from the cache
+  int64_t evictions = 0;
+  /// Number of bytes read from the cache
+  int64_t bytes_read_from_cache = 0;
+  /// Number of bytes fetched from the underlying filesystem
+  int64_t bytes_fetched = 0;
+  /// Number of bytes currently stored in the cache
+  int64_t cached_bytes = 0;
+
+  /// The ratio of block reads served from the cache, or 0 if there weren't any reads.
+  double hit_rate() const;
+};
+
+/// \brief A FileSystem implementation that delegates to another
+/// implementation and caches the data read from it in another filesystem.
+///
+/// This is useful to avoid repeatedly downloading the same data from a
+/// remote store, for example by caching S3 data in a local directory.
+///
+/// Files are read and cached by fixed-size blocks.  Cached blocks are keyed
+/// by file path, modification time and size, so that changes to the underlying
+/// file are picked up (as long as they change its modification time or size).
+/// Only input files are cached; all other operations are delegated to the
+/// underlying filesystem.
+///
+/// The cache filesystem should be dedicated to this purpose; any files
+/// already present at the root of it are considered part of the cache.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  /// \brief Create a CachingFileSystem storing cached data in `cache_fs`
+  ///
+  /// Cached blocks already present in `cache_fs` (for example from a
+  /// previous process) are reused.
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, std::shared_ptr<FileSystem> cache_fs,
+      const CachingFileSystemOptions& options = CachingFileSystemOptions::Defaults());
+
+  /// \brief Create a CachingFileSystem storing cached data in a local directory
+  ///
+  /// The directory is created if it doesn't exist.
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, const std::string& local_cache_dir,
+      const CachingFileSystemOptions& options = CachingFileSystemOptions::Defaults());
+
+  std::string type_name() const override { return "caching"; }
+  std::shared_ptr<FileSystem> base_fs() const;
+  std::shared_ptr<FileSystem> cache_fs() const;
+  CachingFileSystemOptions options() const;
+
+  /// Return statistics about cache usage
+  CachingFileSystemStats stats() const;
+
+  Result<std::string> NormalizePath(std::string path) override;
+
+  bool Equals(const FileSystem& other) const override;
+
+  /// \cond FALSE
+  using FileSystem::GetFileInfo;
+  /// \endcond
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path) override;
+
+  class Impl;
+
+ protected:
+  explicit CachingFileSystem(std::shared_ptr<Impl> impl);
+
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,231 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/cachingfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+
+using ::arrow::internal::TemporaryDir;
+using internal::MockFileSystem;
+
+class TestCachingFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    base_fs_ = std::make_shared<MockFileSystem>(time_);
+    cache_fs_ = std::make_shared<MockFileSystem>(time_);
+    options_.block_size = 4;
+    options_.capacity = 1000;
+    MakeFileSystem();
+  }
+
+  void MakeFileSystem() {
+    ASSERT_OK_AND_ASSIGN(fs_, CachingFileSystem::Make(base_fs_, cache_fs_, options_));
+  }
+
+  void AssertReadAt(const std::string& path, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(path));
+    ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(position, nbytes));
+    AssertBufferEqual(*buf, expected);
+  }
+
+  void AssertStats(int64_t hits, int64_t misses, int64_t evictions) {
+    auto stats = fs_->stats();
+    ASSERT_EQ(stats.hits, hits);
+    ASSERT_EQ(stats.misses, misses);
+    ASSERT_EQ(stats.evictions, evictions);
+  }
+
+  int64_t NumCachedBlocks() {
+    FileSelector select;
+    select.base_dir = "";
+    auto infos = cache_fs_->GetFileInfo(select).ValueOrDie();
+    return static_cast<int64_t>(infos.size());
+  }
+
+ protected:
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> base_fs_;
+  std::shared_ptr<MockFileSystem> cache_fs_;
+  CachingFileSystemOptions options_;
+  std::shared_ptr<CachingFileSystem> fs_;
+};
+
+TEST_F(TestCachingFileSystem, Basics) {
+  ASSERT_OK(fs_->CreateDir("AB"));
+  CreateFile(fs_.get(), "AB/abc", "some data");
+  AssertFileInfo(base_fs_.get(), "AB/abc", FileType::File, 9);
+  AssertFileInfo(fs_.get(), "AB/abc", FileType::File, 9);
+  AssertFileContents(fs_.get(), "AB/abc", "some data");
+
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("AB/def"));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("AB"));
+
+  ASSERT_TRUE(fs_->Equals(*fs_));
+  ASSERT_FALSE(fs_->Equals(*base_fs_));
+}
+
+TEST_F(TestCachingFileSystem, ReadAt) {
+  CreateFile(base_fs_.get(), "abc", "0123456789");
+  AssertStats(0, 0, 0);
+
+  // Within a block
+  AssertReadAt("abc", 1, 2, "12");
+  AssertStats(0, 1, 0);
+  AssertReadAt("abc", 0, 4, "0123");
+  AssertStats(1, 1, 0);
+  // Across blocks
+  AssertReadAt("abc", 2, 5, "23456");
+  AssertStats(2, 2, 0);
+  AssertReadAt("abc", 3, 20, "3456789");
+  AssertStats(4, 3, 0);
+  AssertReadAt("abc", 10, 1, "");
+
+  auto stats = fs_->stats();
+  ASSERT_EQ(stats.cached_bytes, 10);
+  ASSERT_EQ(stats.bytes_fetched, 10);
+  ASSERT_DOUBLE_EQ(stats.hit_rate(), 4.0 / 7.0);
+  ASSERT_EQ(NumCachedBlocks(), 3);
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("abc"));
+  ASSERT_RAISES(IOError, file->ReadAt(11, 1));
+  ASSERT_RAISES(Invalid, file->ReadAt(-1, 1));
+  ASSERT_OK(file->Seek(5));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->Read(3));
+  AssertBufferEqual(*buf, "567");
+  ASSERT_OK_AND_EQ(8, file->Tell());
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 1));
+}
+
+TEST_F(TestCachingFileSystem, FileChanged) {
+  CreateFile(base_fs_.get(), "abc", "some data");
+  AssertReadAt("abc", 0, 4, "some");
+  AssertStats(0, 1, 0);
+
+  // Different size => different cache key
+  CreateFile(base_fs_.get(), "abc", "other data");
+  AssertReadAt("abc", 0, 4, "othe");
+  AssertStats(0, 2, 0);
+  AssertReadAt("abc", 0, 4, "othe");
+  AssertStats(1, 2, 0);
+}
+
+TEST_F(TestCachingFileSystem, Eviction) {
+  options_.capacity = 8;
+  MakeFileSystem();
+  CreateFile(base_fs_.get(), "abc", "0123456789");
+
+  AssertReadAt("abc", 0, 8, "01234567");
+  AssertStats(0, 2, 0);
+  ASSERT_EQ(NumCachedBlocks(), 2);
+  // Evicts the least recently used block ("0123")
+  AssertReadAt("abc", 8, 2, "89");
+  AssertStats(0, 3, 1);
+  ASSERT_EQ(NumCachedBlocks(), 2);
+  AssertReadAt("abc", 4, 2, "45");
+  AssertStats(1, 3, 1);
+  // Evicts "89", as "4567" was used more recently
+  AssertReadAt("abc", 0, 2, "01");
+  AssertStats(1, 4, 2);
+  ASSERT_EQ(NumCachedBlocks(), 2);
+  ASSERT_LE(fs_->stats().cached_bytes, 8);
+  AssertReadAt("abc", 4, 2, "45");
+  AssertStats(2, 4, 2);
+  AssertReadAt("abc", 8, 2, "89");
+  AssertStats(2, 5, 3);
+}
+
+TEST_F(TestCachingFileSystem, ReuseCacheContents) {
+  CreateFile(base_fs_.get(), "abc", "0123456789");
+  AssertReadAt("abc", 0, 10, "0123456789");
+  AssertStats(0, 3, 0);
+
+  // A new instance picks up the existing cache contents
+  MakeFileSystem();
+  ASSERT_EQ(fs_->stats().cached_bytes, 10);
+  AssertReadAt("abc", 0, 10, "0123456789");
+  AssertStats(3, 0, 0);
+
+  // Unless the capacity is smaller
+  options_.capacity = 5;
+  MakeFileSystem();
+  ASSERT_EQ(fs_->stats().evictions, 2);
+  ASSERT_EQ(NumCachedBlocks(), 1);
+}
+
+TEST_F(TestCachingFileSystem, BlockSizeChanged) {
+  CreateFile(base_fs_.get(), "abc", "0123456789");
+  AssertReadAt("abc", 0, 10, "0123456789");
+  AssertStats(0, 3, 0);
+
+  // Blocks cached with another block size are not reused
+  options_.block_size = 3;
+  MakeFileSystem();
+  AssertReadAt("abc", 0, 10, "0123456789");
+  AssertStats(0, 4, 0);
+  AssertReadAt("abc", 4, 4, "4567");
+  AssertStats(2, 4, 0);
+}
+
+TEST_F(TestCachingFileSystem, OpenInputStream) {
+  CreateFile(base_fs_.get(), "abc", "0123456789");
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("abc"));
+  ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(3));
+  AssertBufferEqual(*buf, "012");
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(20));
+  AssertBufferEqual(*buf, "3456789");
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(20));
+  AssertBufferEqual(*buf, "");
+}
+
+TEST_F(TestCachingFileSystem, InvalidOptions) {
+  options_.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, cache_fs_, options_));
+  options_.block_size = 4;
+  options_.capacity = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, cache_fs_, options_));
+}
+
+TEST_F(TestCachingFileSystem, LocalCacheDir) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir, TemporaryDir::Make("test-cachingfs-"));
+  const auto cache_dir = temp_dir->path().ToString() + "cache";
+  ASSERT_OK_AND_ASSIGN(fs_, CachingFileSystem::Make(base_fs_, cache_dir, options_));
+
+  CreateFile(base_fs_.get(), "abc", "0123456789");
+  AssertReadAt("abc", 2, 6, "234567");
+  AssertStats(0, 2, 0);
+  AssertReadAt("abc", 2, 6, "234567");
+  AssertStats(2, 2, 0);
+}
+
+}  // namespace fs
+}  // namespace arrow
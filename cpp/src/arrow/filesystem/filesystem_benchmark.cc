@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/logging.h"
+
+#include "benchmark/benchmark.h"
+
+namespace arrow {
+namespace fs {
+
+using internal::MockFileSystem;
+
+static constexpr int64_t kFileSize = 1 << 20;
+// Average latency of each file operation, in seconds
+static constexpr double kAverageLatency = 1e-3;
+
+// A read pattern resembling a columnar file footer and metadata read:
+// many small ranges separated by small holes.
+static std::vector<io::ReadRange> SmallReadRanges() {
+  std::vector<io::ReadRange> ranges;
+  for (int64_t offset = kFileSize - 64 * 1024; offset < kFileSize; offset += 4096) {
+    ranges.push_back({offset, 1000});
+  }
+  return ranges;
+}
+
+static std::shared_ptr<FileSystem> MakeSlowFileSystem() {
+  auto base_fs = std::make_shared<MockFileSystem>(TimePoint(TimePoint::duration(42)));
+  ABORT_NOT_OK(base_fs->CreateFile("somefile", std::string(kFileSize, 'x')));
+  return std::make_shared<SlowFileSystem>(base_fs, kAverageLatency, /*seed=*/42);
+}
+
+static void SlowFileReadAt(benchmark::State& state) {  // NOLINT non-const reference
+  auto fs = MakeSlowFileSystem();
+  const auto ranges = SmallReadRanges();
+
+  int64_t total_bytes = 0;
+  for (auto _ : state) {
+    ASSIGN_OR_ABORT(auto file, fs->OpenInputFile("somefile"));
+    for (const auto& range : ranges) {
+      ABORT_NOT_OK(file->ReadAt(range.offset, range.length));
+      total_bytes += range.length;
+    }
+  }
+  state.SetBytesProcessed(total_bytes);
+}
+
+static void SlowFileReadManyAt(benchmark::State& state) {  // NOLINT non-const reference
+  auto fs = MakeSlowFileSystem();
+  const auto ranges = SmallReadRanges();
+
+  int64_t total_bytes = 0;
+  for (auto _ : state) {
+    ASSIGN_OR_ABORT(auto file, fs->OpenInputFile("somefile"));
+    ABORT_NOT_OK(file->ReadManyAt(ranges));
+    for (const auto& range : ranges) {
+      total_bytes += range.length;
+    }
+  }
+  state.SetBytesProcessed(total_bytes);
+}
+
+BENCHMARK(SlowFileReadAt)->UseRealTime();
+BENCHMARK(SlowFileReadManyAt)->UseRealTime();
+
+}  // namespace fs
+}  // namespace arrow
@@ -70,7 +70,9 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/windows_fixup.h"
 
 namespace arrow {
@@ -254,6 +256,8 @@ Result<S3Options> S3Options::FromUri(const std::string& uri_string,
 bool S3Options::Equals(const S3Options& other) const {
   return (region == other.region && endpoint_override == other.endpoint_override &&
           scheme == other.scheme && background_writes == other.background_writes &&
+          read_ahead_size == other.read_ahead_size &&
+          background_prefetch == other.background_prefetch &&
           GetAccessKey() == other.GetAccessKey() &&
           GetSecretKey() == other.GetSecretKey());
 }
@@ -361,10 +365,19 @@ Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t sta
 }
 
 // A RandomAccessFile that reads from a S3 object
+//
+// Depending on S3Options, small reads are expanded to `read_ahead_size` bytes
+// and the fetched range is kept around to serve subsequent reads.  When
+// `background_prefetch` is enabled, a sequential access pattern additionally
+// triggers the background fetch of the following range.
 class ObjectInputFile : public io::RandomAccessFile {
  public:
-  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path)
-      : client_(client), path_(path) {}
+  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path,
+                  const S3Options& options)
+      : client_(client),
+        path_(path),
+        read_ahead_size_(options.read_ahead_size),
+        background_prefetch_(options.background_prefetch) {}
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -410,6 +423,9 @@ class ObjectInputFile : public io::RandomAccessFile {
 
   Status Close() override {
     closed_ = true;
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    cached_.reset();
+    prefetch_.reset();
     return Status::OK();
   }
 
@@ -442,15 +458,12 @@ class ObjectInputFile : public io::RandomAccessFile {
       return 0;
     }
 
-    // Read the desired range of bytes
-    S3Model::GetObjectResult result;
-    RETURN_NOT_OK(GetObjectRange(client_, path_, position, nbytes, &result));
-
-    auto& stream = result.GetBody();
-    stream.read(reinterpret_cast<char*>(out), nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    return stream.gcount();
+    if (nbytes < read_ahead_size_ || background_prefetch_) {
+      ARROW_ASSIGN_OR_RAISE(auto buf, CachedReadAt(position, nbytes));
+      memcpy(out, buf->data(), buf->size());
+      return buf->size();
+    }
+    return FetchRange(position, nbytes, out);
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -460,15 +473,10 @@ class ObjectInputFile : public io::RandomAccessFile {
     // No need to allocate more than the remaining number of bytes
     nbytes = std::min(nbytes, content_length_ - position);
 
-    std::shared_ptr<ResizableBuffer> buf;
-    RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buf));
-    if (nbytes > 0) {
-      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
-                            ReadAt(position, nbytes, buf->mutable_data()));
-      DCHECK_LE(bytes_read, nbytes);
-      RETURN_NOT_OK(buf->Resize(bytes_read));
+    if (nbytes > 0 && (read_ahead_size_ > 0 || background_prefetch_)) {
+      return CachedReadAt(position, nbytes);
     }
-    return buf;
+    return FetchRange(position, nbytes);
   }
 
   Result<int64_t> Read(int64_t nbytes, void* out) override {
@@ -484,11 +492,143 @@ class ObjectInputFile : public io::RandomAccessFile {
   }
 
  protected:
+  // A (possibly pending) fetched range of the object
+  struct CachedRange {
+    int64_t position;
+    int64_t nbytes;
+    Future<std::shared_ptr<Buffer>> future;
+  };
+
+  // Issue a GetObject request for the given range, writing into `out`
+  Result<int64_t> FetchRange(int64_t position, int64_t nbytes, void* out) {
+    S3Model::GetObjectResult result;
+    RETURN_NOT_OK(GetObjectRange(client_, path_, position, nbytes, &result));
+
+    auto& stream = result.GetBody();
+    stream.read(reinterpret_cast<char*>(out), nbytes);
+    // NOTE: the stream is a stringstream by default, there is no actual error
+    // to check for.  However, stream.fail() may return true if EOF is reached.
+    return stream.gcount();
+  }
+
+  // Issue a GetObject request for the given range, into a new buffer
+  Result<std::shared_ptr<Buffer>> FetchRange(int64_t position, int64_t nbytes) {
+    std::shared_ptr<ResizableBuffer> buf;
+    RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buf));
+    if (nbytes > 0) {
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                            FetchRange(position, nbytes, buf->mutable_data()));
+      DCHECK_LE(bytes_read, nbytes);
+      RETURN_NOT_OK(buf->Resize(bytes_read));
+    }
+    return buf;
+  }
+
+  // Return the given range of bytes from `range` if it covers them, otherwise null
+  static Result<std::shared_ptr<Buffer>> SliceCachedRange(const CachedRange& range,
+                                                          int64_t position,
+                                                          int64_t nbytes) {
+    // Check the requested extent first so as not to wait on a pending range
+    // that could not serve the read anyway
+    if (range.position > position || range.position + range.nbytes < position + nbytes) {
+      return nullptr;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buf, range.future.result());
+    // The object may have been shorter than requested
+    if (range.position + buf->size() < position + nbytes) {
+      return nullptr;
+    }
+    return SliceBuffer(std::move(buf), position - range.position, nbytes);
+  }
+
+  // Read a range, going through the read-ahead cache and the prefetched range.
+  // `nbytes` must have been clamped to the object size by the caller.
+  Result<std::shared_ptr<Buffer>> CachedReadAt(int64_t position, int64_t nbytes) {
+    std::unique_ptr<CachedRange> cached, prefetch;
+    bool sequential;
+    {
+      std::lock_guard<std::mutex> lock(cache_mutex_);
+      if (cached_) {
+        cached.reset(new CachedRange(*cached_));
+      }
+      if (prefetch_) {
+        prefetch.reset(new CachedRange(*prefetch_));
+      }
+      sequential = (position == last_read_end_);
+      last_read_end_ = position + nbytes;
+    }
+
+    std::shared_ptr<Buffer> buf;
+    if (cached) {
+      ARROW_ASSIGN_OR_RAISE(buf, SliceCachedRange(*cached, position, nbytes));
+    }
+    if (!buf && prefetch) {
+      // A failed prefetch is not fatal, the range is simply fetched again
+      auto maybe_buf = SliceCachedRange(*prefetch, position, nbytes);
+      if (maybe_buf.ok() && *maybe_buf) {
+        buf = *std::move(maybe_buf);
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        cached_ = std::move(prefetch);
+        prefetch_.reset();
+      }
+    }
+    if (!buf) {
+      const int64_t fetch_size =
+          std::min(std::max(nbytes, read_ahead_size_), content_length_ - position);
+      ARROW_ASSIGN_OR_RAISE(auto fetched, FetchRange(position, fetch_size));
+      if (fetched->size() > nbytes) {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        cached_.reset(
+            new CachedRange{position, fetched->size(),
+                            Future<std::shared_ptr<Buffer>>::MakeFinished(fetched)});
+      }
+      buf = SliceBuffer(fetched, 0, std::min(nbytes, fetched->size()));
+    }
+
+    if (background_prefetch_ && sequential) {
+      RETURN_NOT_OK(PrefetchAfter(position + buf->size(), nbytes));
+    }
+    return buf;
+  }
+
+  // Start fetching the range following `position` in the background, unless it
+  // is already cached or being fetched
+  Status PrefetchAfter(int64_t position, int64_t last_read_size) {
+    const int64_t nbytes = std::min(std::max(last_read_size, read_ahead_size_),
+                                    content_length_ - position);
+    if (nbytes <= 0) {
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    for (const CachedRange* range : {cached_.get(), prefetch_.get()}) {
+      if (range != nullptr && range->position <= position &&
+          range->position + range->nbytes >= position + nbytes) {
+        return Status::OK();
+      }
+    }
+    auto self =
+        ::arrow::internal::checked_pointer_cast<ObjectInputFile>(shared_from_this());
+    ARROW_ASSIGN_OR_RAISE(auto fut, io::internal::GetIOThreadPool()->Submit(
+                                        [self, position, nbytes] {
+                                          return self->FetchRange(position, nbytes);
+                                        }));
+    prefetch_.reset(new CachedRange{position, nbytes, std::move(fut)});
+    return Status::OK();
+  }
+
   Aws::S3::S3Client* client_;
   S3Path path_;
+  const int64_t read_ahead_size_;
+  const bool background_prefetch_;
   bool closed_ = false;
   int64_t pos_ = 0;
   int64_t content_length_ = -1;
+
+  // Protects the members below
+  std::mutex cache_mutex_;
+  std::unique_ptr<CachedRange> cached_;
+  std::unique_ptr<CachedRange> prefetch_;
+  int64_t last_read_end_ = -1;
 };
 
 // A non-copying istream.
@@ -1459,7 +1599,8 @@ Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
+  auto ptr =
+      std::make_shared<ObjectInputFile>(impl_->client_.get(), path, impl_->options_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
@@ -1470,7 +1611,8 @@ Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
+  auto ptr =
+      std::make_shared<ObjectInputFile>(impl_->client_.get(), path, impl_->options_);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
@@ -55,6 +55,17 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// Minimum number of bytes fetched by each request issued by input files.
+  ///
+  /// Smaller reads are served from the last fetched range, so that a series
+  /// of small nearby reads (e.g. file footer and metadata) don't each incur
+  /// a separate request.  0 disables read-ahead.
+  int64_t read_ahead_size = 0;
+
+  /// Whether input files prefetch the next range in the background
+  /// when sequential reads are detected.
+  bool background_prefetch = false;
+
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
 
@@ -122,7 +133,10 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
 
   /// Create a random access file for reading from a S3 object.
   ///
-  /// See OpenInputStream for performance notes.
+  /// See OpenInputStream for performance notes.  S3Options.read_ahead_size
+  /// and S3Options.background_prefetch can be used to reduce the number of
+  /// requests issued for small reads, and ReadManyAt() to coalesce reads
+  /// of several ranges.
   Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
       const std::string& path) override;
 
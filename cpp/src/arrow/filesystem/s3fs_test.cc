@@ -343,6 +343,48 @@ class TestS3FS : public S3TestMixin {
     ASSERT_OK_AND_ASSIGN(fs_, S3FileSystem::Make(options_));
   }
 
+  void TestOpenInputFile() {
+    std::shared_ptr<io::RandomAccessFile> file;
+    std::shared_ptr<Buffer> buf;
+
+    // Nonexistent
+    ASSERT_RAISES(IOError, fs_->OpenInputFile("nonexistent-bucket/somefile"));
+    ASSERT_RAISES(IOError, fs_->OpenInputFile("bucket/zzzt"));
+
+    // "Files"
+    ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+    ASSERT_OK_AND_EQ(9, file->GetSize());
+    ASSERT_OK_AND_ASSIGN(buf, file->Read(4));
+    AssertBufferEqual(*buf, "some");
+    ASSERT_OK_AND_EQ(9, file->GetSize());
+    ASSERT_OK_AND_EQ(4, file->Tell());
+
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(2, 5));
+    AssertBufferEqual(*buf, "me da");
+    ASSERT_OK_AND_EQ(4, file->Tell());
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(5, 20));
+    AssertBufferEqual(*buf, "data");
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(9, 20));
+    AssertBufferEqual(*buf, "");
+
+    char result[10];
+    ASSERT_OK_AND_EQ(5, file->ReadAt(2, 5, &result));
+    ASSERT_OK_AND_EQ(4, file->ReadAt(5, 20, &result));
+    ASSERT_OK_AND_EQ(0, file->ReadAt(9, 0, &result));
+
+    // Reading past end of file
+    ASSERT_RAISES(IOError, file->ReadAt(10, 20));
+
+    ASSERT_OK(file->Seek(5));
+    ASSERT_OK_AND_ASSIGN(buf, file->Read(2));
+    AssertBufferEqual(*buf, "da");
+    ASSERT_OK(file->Seek(9));
+    ASSERT_OK_AND_ASSIGN(buf, file->Read(2));
+    AssertBufferEqual(*buf, "");
+    // Seeking past end of file
+    ASSERT_RAISES(IOError, file->Seek(10));
+  }
+
   void TestOpenOutputStream() {
     std::shared_ptr<io::OutputStream> stream;
 
@@ -725,46 +767,40 @@ TEST_F(TestS3FS, OpenInputStream) {
   ASSERT_RAISES(IOError, fs_->OpenInputStream("bucket"));
 }
 
-TEST_F(TestS3FS, OpenInputFile) {
-  std::shared_ptr<io::RandomAccessFile> file;
-  std::shared_ptr<Buffer> buf;
-
-  // Nonexistent
-  ASSERT_RAISES(IOError, fs_->OpenInputFile("nonexistent-bucket/somefile"));
-  ASSERT_RAISES(IOError, fs_->OpenInputFile("bucket/zzzt"));
-
-  // "Files"
-  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
-  ASSERT_OK_AND_EQ(9, file->GetSize());
-  ASSERT_OK_AND_ASSIGN(buf, file->Read(4));
-  AssertBufferEqual(*buf, "some");
-  ASSERT_OK_AND_EQ(9, file->GetSize());
-  ASSERT_OK_AND_EQ(4, file->Tell());
-
-  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(2, 5));
-  AssertBufferEqual(*buf, "me da");
-  ASSERT_OK_AND_EQ(4, file->Tell());
-  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(5, 20));
-  AssertBufferEqual(*buf, "data");
-  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(9, 20));
-  AssertBufferEqual(*buf, "");
+TEST_F(TestS3FS, OpenInputFile) { TestOpenInputFile(); }
 
-  char result[10];
-  ASSERT_OK_AND_EQ(5, file->ReadAt(2, 5, &result));
-  ASSERT_OK_AND_EQ(4, file->ReadAt(5, 20, &result));
-  ASSERT_OK_AND_EQ(0, file->ReadAt(9, 0, &result));
+TEST_F(TestS3FS, OpenInputFileReadAhead) {
+  options_.read_ahead_size = 4;
+  MakeFileSystem();
+  TestOpenInputFile();
+}
 
-  // Reading past end of file
-  ASSERT_RAISES(IOError, file->ReadAt(10, 20));
+TEST_F(TestS3FS, OpenInputFileBackgroundPrefetch) {
+  options_.read_ahead_size = 3;
+  options_.background_prefetch = true;
+  MakeFileSystem();
+  TestOpenInputFile();
+
+  // Sequential small reads
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/somefile"));
+  std::string contents;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(auto buf, file->Read(2));
+    if (buf->size() == 0) {
+      break;
+    }
+    contents += buf->ToString();
+  }
+  ASSERT_EQ(contents, "some data");
+}
 
-  ASSERT_OK(file->Seek(5));
-  ASSERT_OK_AND_ASSIGN(buf, file->Read(2));
-  AssertBufferEqual(*buf, "da");
-  ASSERT_OK(file->Seek(9));
-  ASSERT_OK_AND_ASSIGN(buf, file->Read(2));
-  AssertBufferEqual(*buf, "");
-  // Seeking past end of file
-  ASSERT_RAISES(IOError, file->Seek(10));
+TEST_F(TestS3FS, OpenInputFileReadManyAt) {
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/somefile"));
+  ASSERT_OK_AND_ASSIGN(auto buffers, file->ReadManyAt({{5, 3}, {0, 4}, {8, 10}}));
+  ASSERT_EQ(buffers.size(), 3);
+  AssertBufferEqual(*buffers[0], "dat");
+  AssertBufferEqual(*buffers[1], "some");
+  AssertBufferEqual(*buffers[2], "a");
 }
 
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
@@ -96,7 +96,10 @@ Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
       });
   if (it != impl_->entries.end() && it->range.Contains(range)) {
     ARROW_ASSIGN_OR_RAISE(auto buf, it->future.result());
-    return SliceBuffer(std::move(buf), range.offset - it->range.offset, range.length);
+    // The underlying read may have been truncated by EOF
+    const int64_t offset = std::min(range.offset - it->range.offset, buf->size());
+    const int64_t length = std::min(range.length, buf->size() - offset);
+    return SliceBuffer(std::move(buf), offset, length);
   }
   return Status::Invalid("ReadRangeCache did not find matching cache entry");
 }
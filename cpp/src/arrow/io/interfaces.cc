@@ -28,6 +28,7 @@
 #include <utility>
 
 #include "arrow/buffer.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/concurrency.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
@@ -153,6 +154,23 @@ Future<std::shared_ptr<Buffer>> RandomAccessFile::ReadAsync(int64_t position,
   return *std::move(maybe_fut);
 }
 
+Result<std::vector<std::shared_ptr<Buffer>>> RandomAccessFile::ReadManyAt(
+    const std::vector<ReadRange>& ranges) {
+  for (const auto& range : ranges) {
+    RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+  }
+  internal::ReadRangeCache cache(shared_from_this());
+  RETURN_NOT_OK(cache.Cache(ranges));
+
+  std::vector<std::shared_ptr<Buffer>> out;
+  out.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    ARROW_ASSIGN_OR_RAISE(auto buf, cache.Read(range));
+    out.push_back(std::move(buf));
+  }
+  return out;
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
@@ -361,6 +379,9 @@ struct ReadRangeCombiner {
     auto end = std::remove_if(ranges.begin(), ranges.end(),
                               [](const ReadRange& range) { return range.length == 0; });
     ranges.resize(end - ranges.begin());
+    if (ranges.size() == 0) {
+      return ranges;
+    }
     // Sort in position order
     std::sort(ranges.begin(), ranges.end(),
               [](const ReadRange& a, const ReadRange& b) { return a.offset < b.offset; });
@@ -274,6 +274,21 @@ class ARROW_EXPORT RandomAccessFile
   // EXPERIMENTAL
   virtual Future<std::shared_ptr<Buffer>> ReadAsync(int64_t position, int64_t nbytes);
 
+  /// \brief Read several ranges of data at once.
+  ///
+  /// The default implementation coalesces nearby ranges into larger reads
+  /// and issues them concurrently using ReadAsync(), which can drastically
+  /// reduce the number of round-trips on high-latency storage.
+  /// Subclasses may override it with a more efficient implementation.
+  ///
+  /// The ranges must not overlap.  As with ReadAt(), each returned buffer
+  /// can be shorter than requested if EOF is reached.
+  ///
+  /// \param[in] ranges The ranges to read
+  /// \return A vector of buffers, in the same order as `ranges`, or an error
+  virtual Result<std::vector<std::shared_ptr<Buffer>>> ReadManyAt(
+      const std::vector<ReadRange>& ranges);
+
   // Deprecated APIs
 
   ARROW_DEPRECATED("Use Result-returning overload")
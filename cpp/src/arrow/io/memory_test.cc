@@ -221,6 +221,26 @@ TEST(TestBufferReader, ReadAsync) {
   AssertBufferEqual(*buf, "ata1");
 }
 
+TEST(TestBufferReader, ReadManyAt) {
+  std::string data = "data123456";
+
+  auto reader = std::make_shared<BufferReader>(std::make_shared<Buffer>(data));
+
+  ASSERT_OK_AND_ASSIGN(auto buffers,
+                       reader->ReadManyAt({{6, 2}, {0, 4}, {4, 0}, {8, 5}}));
+  ASSERT_EQ(buffers.size(), 4);
+  AssertBufferEqual(*buffers[0], "34");
+  AssertBufferEqual(*buffers[1], "data");
+  AssertBufferEqual(*buffers[2], "");
+  AssertBufferEqual(*buffers[3], "56");
+
+  ASSERT_OK_AND_ASSIGN(buffers, reader->ReadManyAt({}));
+  ASSERT_EQ(buffers.size(), 0);
+
+  ASSERT_RAISES(Invalid, reader->ReadManyAt({{1, 2}, {-1, 1}}));
+  ASSERT_RAISES(Invalid, reader->ReadManyAt({{1, -1}}));
+}
+
 TEST(TestBufferReader, InvalidReads) {
   std::string data = "data123456";
   BufferReader reader(std::make_shared<Buffer>(data));
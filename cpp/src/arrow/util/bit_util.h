@@ -300,6 +300,15 @@ static inline int CountTrailingZeros(uint64_t value) {
 #endif
 }
 
+// Returns the number of set bits in a 64-bit word
+static inline int PopCount(uint64_t bitmap) {
+#if defined(_MSC_VER)
+  return static_cast<int>(__popcnt64(bitmap));
+#else
+  return __builtin_popcountll(bitmap);
+#endif
+}
+
 // Returns the minimum number of bits needed to represent an unsigned value
 static inline int NumRequiredBits(uint64_t x) { return 64 - CountLeadingZeros(x); }
 
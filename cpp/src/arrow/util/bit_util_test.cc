@@ -1073,6 +1073,38 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-1234);
   TestZigZag(std::numeric_limits<int32_t>::max());
   TestZigZag(-std::numeric_limits<int32_t>::max());
+  TestZigZag(std::numeric_limits<int32_t>::min());
+}
+
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLengthForInt64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
+TEST(BitStreamUtil, ZigZagEncoding) {
+  // Small magnitudes alternate between positive and negative values
+  for (int32_t v : {0, -1, 1, -2, 2, -64}) {
+    uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLength] = {};
+    BitUtil::BitWriter writer(buffer, sizeof(buffer));
+    writer.PutZigZagVlqInt(v);
+    writer.Flush();
+    EXPECT_EQ(v >= 0 ? 2 * v : -2 * v - 1, buffer[0]) << "v = " << v;
+  }
 }
 
 TEST(BitUtil, RoundTripLittleEndianTest) {
@@ -28,11 +28,46 @@ namespace arrow {
 namespace util {
 namespace internal {
 
+// The kernels transpose the bytes of blocks of values with the unpack
+// intrinsics.  An unpack stage interleaves the bytes of registers j and
+// j + kNumStreams / 2 into registers 2 * j and 2 * j + 1, which rotates the
+// bits of the byte index within a 128-bit lane across the registers left by
+// one.  log2(kNumStreams) stages thus gather the streams into values, and 4
+// stages scatter the values of a 128-bit lane into streams.
+
+template <typename T>
+void ByteStreamSplitDecodeScalar(const uint8_t* data, int64_t num_values, int64_t stride,
+                                 T* out) {
+  constexpr size_t kNumStreams = sizeof(T);
+
+  for (int64_t i = 0; i < num_values; ++i) {
+    uint8_t gathered_byte_data[kNumStreams];
+    for (size_t b = 0; b < kNumStreams; ++b) {
+      const size_t byte_index = b * stride + i;
+      gathered_byte_data[b] = data[byte_index];
+    }
+    out[i] = arrow::util::SafeLoadAs<T>(&gathered_byte_data[0]);
+  }
+}
+
+template <typename T>
+void ByteStreamSplitEncodeScalar(const uint8_t* raw_values, int64_t num_values,
+                                 uint8_t* output_buffer_raw) {
+  constexpr size_t kNumStreams = sizeof(T);
+
+  for (int64_t i = 0; i < num_values; ++i) {
+    for (size_t j = 0U; j < kNumStreams; ++j) {
+      const uint8_t byte_in_value = raw_values[i * kNumStreams + j];
+      output_buffer_raw[j * num_values + i] = byte_in_value;
+    }
+  }
+}
+
 #if defined(ARROW_HAVE_SSE2)
 
 template <typename T>
-void ByteStreamSlitDecodeSSE2(const uint8_t* data, int64_t num_values, int64_t stride,
-                              T* out) {
+void ByteStreamSplitDecodeSSE2(const uint8_t* data, int64_t num_values, int64_t stride,
+                               T* out) {
   constexpr size_t kNumStreams = sizeof(T);
   static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
   constexpr size_t kNumStreamsLog2 = (kNumStreams == 8U ? 3U : 2U);
@@ -46,14 +81,9 @@ void ByteStreamSlitDecodeSSE2(const uint8_t* data, int64_t num_values, int64_t s
   // This helps catch if the simd-based processing overflows into the suffix
   // since almost surely a test would fail.
   const int64_t num_processed_elements = (num_blocks * block_size) / kNumStreams;
-  for (int64_t i = num_processed_elements; i < num_values; ++i) {
-    uint8_t gathered_byte_data[kNumStreams];
-    for (size_t b = 0; b < kNumStreams; ++b) {
-      const size_t byte_index = b * stride + i;
-      gathered_byte_data[b] = data[byte_index];
-    }
-    out[i] = arrow::util::SafeLoadAs<T>(&gathered_byte_data[0]);
-  }
+  ByteStreamSplitDecodeScalar(data + num_processed_elements,
+                              num_values - num_processed_elements, stride,
+                              out + num_processed_elements);
 
   // The blocks get processed hierahically using the unpack intrinsics.
   // Example with four streams:
@@ -84,23 +114,47 @@ void ByteStreamSlitDecodeSSE2(const uint8_t* data, int64_t num_values, int64_t s
   }
 }
 
-#endif
-
 template <typename T>
-void ByteStreamSlitDecodeScalar(const uint8_t* data, int64_t num_values, int64_t stride,
-                                T* out) {
+void ByteStreamSplitEncodeSSE2(const uint8_t* raw_values, int64_t num_values,
+                               uint8_t* output_buffer_raw) {
   constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  constexpr int64_t kBlockSize = sizeof(__m128i);
 
-  for (int64_t i = 0; i < num_values; ++i) {
-    uint8_t gathered_byte_data[kNumStreams];
-    for (size_t b = 0; b < kNumStreams; ++b) {
-      const size_t byte_index = b * stride + i;
-      gathered_byte_data[b] = data[byte_index];
+  const int64_t num_blocks = num_values / kBlockSize;
+  const int64_t num_processed_elements = num_blocks * kBlockSize;
+  for (int64_t i = num_processed_elements; i < num_values; ++i) {
+    for (size_t j = 0U; j < kNumStreams; ++j) {
+      output_buffer_raw[j * num_values + i] = raw_values[i * kNumStreams + j];
+    }
+  }
+
+  __m128i stage[5][kNumStreams];
+  const size_t half = kNumStreams / 2U;
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+          &raw_values[(i * kNumStreams + j) * sizeof(__m128i)]));
+    }
+    for (size_t step = 0; step < 4; ++step) {
+      for (size_t j = 0; j < half; ++j) {
+        stage[step + 1U][j * 2] =
+            _mm_unpacklo_epi8(stage[step][j], stage[step][half + j]);
+        stage[step + 1U][j * 2 + 1U] =
+            _mm_unpackhi_epi8(stage[step][j], stage[step][half + j]);
+      }
+    }
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(&output_buffer_raw[j * num_values + i * kBlockSize]),
+          stage[4][j]);
     }
-    out[i] = arrow::util::SafeLoadAs<T>(&gathered_byte_data[0]);
   }
 }
 
+#endif  // ARROW_HAVE_SSE2
+
 }  // namespace internal
 }  // namespace util
 }  // namespace arrow
@@ -123,8 +123,19 @@ static struct {
   int64_t flag;
 } flag_mappings[] = {
 #if (defined(__i386) || defined(_M_IX86) || defined(__x86_64__) || defined(_M_X64))
-    {"ssse3", CpuInfo::SSSE3},   {"sse4_1", CpuInfo::SSE4_1},
-    {"sse4_2", CpuInfo::SSE4_2}, {"popcnt", CpuInfo::POPCNT},
+    {"ssse3", CpuInfo::SSSE3},
+    {"sse4_1", CpuInfo::SSE4_1},
+    {"sse4_2", CpuInfo::SSE4_2},
+    {"popcnt", CpuInfo::POPCNT},
+    {"avx", CpuInfo::AVX},
+    {"avx2", CpuInfo::AVX2},
+    {"avx512f", CpuInfo::AVX512F},
+    {"avx512cd", CpuInfo::AVX512CD},
+    {"avx512vl", CpuInfo::AVX512VL},
+    {"avx512dq", CpuInfo::AVX512DQ},
+    {"avx512bw", CpuInfo::AVX512BW},
+    {"bmi1", CpuInfo::BMI1},
+    {"bmi2", CpuInfo::BMI2},
 #endif
 #if defined(__aarch64__)
     {"asimd", CpuInfo::ASIMD},
@@ -203,9 +214,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
     return false;
   }
   const int register_ECX_id = 1;
+  const int register_extended_features_id = 7;
   int highest_valid_id = 0;
   int highest_extended_valid_id = 0;
   std::bitset<32> features_ECX;
+  std::bitset<32> extended_features_EBX;
   std::array<int, 4> cpu_info;
 
   // Get highest valid id
@@ -217,6 +230,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   __cpuidex(cpu_info.data(), register_ECX_id, 0);
   features_ECX = cpu_info[2];
 
+  if (highest_valid_id >= register_extended_features_id) {
+    __cpuidex(cpu_info.data(), register_extended_features_id, 0);
+    extended_features_EBX = cpu_info[1];
+  }
+
   // Get highest extended id
   __cpuid(cpu_info.data(), 0x80000000);
   highest_extended_valid_id = cpu_info[0];
@@ -235,6 +253,16 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+  if (features_ECX[28]) *hardware_flags |= CpuInfo::AVX;
+
+  if (extended_features_EBX[3]) *hardware_flags |= CpuInfo::BMI1;
+  if (extended_features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+  if (extended_features_EBX[8]) *hardware_flags |= CpuInfo::BMI2;
+  if (extended_features_EBX[16]) *hardware_flags |= CpuInfo::AVX512F;
+  if (extended_features_EBX[17]) *hardware_flags |= CpuInfo::AVX512DQ;
+  if (extended_features_EBX[28]) *hardware_flags |= CpuInfo::AVX512CD;
+  if (extended_features_EBX[30]) *hardware_flags |= CpuInfo::AVX512BW;
+  if (extended_features_EBX[31]) *hardware_flags |= CpuInfo::AVX512VL;
   return true;
 }
 #endif
@@ -27,11 +27,12 @@ namespace arrow {
 namespace internal {
 
 // A parallelizer that takes a `Status(int)` function and calls it with
-// arguments between 0 and `num_tasks - 1`, on an arbitrary number of threads.
+// arguments between 0 and `num_tasks - 1`, on an arbitrary number of threads
+// of `pool` (the CPU thread pool by default).
 
 template <class FUNCTION>
-Status ParallelFor(int num_tasks, FUNCTION&& func) {
-  auto pool = internal::GetCpuThreadPool();
+Status ParallelFor(int num_tasks, FUNCTION&& func,
+                   ThreadPool* pool = internal::GetCpuThreadPool()) {
   std::vector<Future<Status>> futures(num_tasks);
 
   for (int i = 0; i < num_tasks; ++i) {
@@ -44,5 +45,20 @@ Status ParallelFor(int num_tasks, FUNCTION&& func) {
   return st;
 }
 
+// Same as ParallelFor, but calls `func` serially on the current thread
+// if `use_threads` is false.
+
+template <class FUNCTION>
+Status OptionalParallelFor(bool use_threads, int num_tasks, FUNCTION&& func,
+                           ThreadPool* pool = internal::GetCpuThreadPool()) {
+  if (use_threads) {
+    return ParallelFor(num_tasks, std::forward<FUNCTION>(func), pool);
+  }
+  for (int i = 0; i < num_tasks; ++i) {
+    RETURN_NOT_OK(func(i));
+  }
+  return Status::OK();
+}
+
 }  // namespace internal
 }  // namespace arrow
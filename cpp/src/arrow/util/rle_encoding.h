@@ -656,7 +656,7 @@ inline void RleEncoder::FlushRepeatedRun() {
   DCHECK_GT(repeat_count_, 0);
   bool result = true;
   // The lsb of 0 indicates this is a repeated run
-  int32_t indicator_value = repeat_count_ << 1 | 0;
+  uint32_t indicator_value = static_cast<uint32_t>(repeat_count_) << 1 | 0;
   result &= bit_writer_.PutVlqInt(indicator_value);
   result &= bit_writer_.PutAligned(current_value_,
                                    static_cast<int>(BitUtil::CeilDiv(bit_width_, 8)));
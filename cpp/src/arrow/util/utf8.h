@@ -171,6 +171,38 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+// Return whether the data only contains ASCII characters (which implies
+// it is valid UTF8).  The bytes are OR-ed together in blocks of 64 so that
+// the compiler vectorizes the inner loop, only checking between blocks.
+inline bool ValidateAscii(const uint8_t* data, int64_t size) {
+  static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
+  static constexpr int64_t kBlockSize = 64;
+
+  while (size >= kBlockSize) {
+    uint64_t words[kBlockSize / 8];
+    memcpy(words, data, kBlockSize);
+    uint64_t mask = 0;
+    for (uint64_t word : words) {
+      mask |= word;
+    }
+    if (ARROW_PREDICT_FALSE((mask & high_bits_64) != 0)) {
+      return false;
+    }
+    size -= kBlockSize;
+    data += kBlockSize;
+  }
+  uint8_t mask = 0;
+  while (size-- > 0) {
+    mask |= *data++;
+  }
+  return (mask & 0x80) == 0;
+}
+
+inline bool ValidateAscii(const util::string_view& str) {
+  return ValidateAscii(reinterpret_cast<const uint8_t*>(str.data()),
+                       static_cast<int64_t>(str.size()));
+}
+
 // Skip UTF8 byte order mark, if any.
 ARROW_EXPORT
 Result<const uint8_t*> SkipUTF8BOM(const uint8_t* data, int64_t size);
@@ -251,6 +251,24 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST_F(UTF8Test, ValidateAscii) {
+  ASSERT_TRUE(ValidateAscii(""));
+  ASSERT_TRUE(ValidateAscii("a\x7f"));
+  // Check a non-ASCII character at every position, on both sides of the
+  // 64-byte block boundaries
+  for (size_t size : {1, 7, 63, 64, 65, 130}) {
+    std::string s(size, 'x');
+    ASSERT_TRUE(ValidateAscii(s));
+    for (size_t i = 0; i < size; ++i) {
+      for (const auto& t : valid_sequences_2) {
+        std::string u = s;
+        u[i] = t[0];
+        ASSERT_FALSE(ValidateAscii(u)) << "at position " << i << " of " << size;
+      }
+    }
+  }
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
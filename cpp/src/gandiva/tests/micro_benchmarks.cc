@@ -16,6 +16,7 @@
 // under the License.
 
 #include <stdlib.h>
+#include <string>
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "benchmark/benchmark.h"
@@ -63,6 +64,43 @@ static void TimedTestAdd3(benchmark::State& state) {
   ASSERT_OK(status);
 }
 
+// Binary int64 arithmetic, comparable with the arithmetic kernels of
+// arrow/compute/compute_benchmark.cc
+static void TimedTestInt64Binary(benchmark::State& state, const std::string& function) {
+  auto field0 = field("f0", int64());
+  auto field1 = field("f1", int64());
+  auto schema = arrow::schema({field0, field1});
+  auto pool_ = arrow::default_memory_pool();
+
+  auto field_result = field("result", int64());
+  auto result = TreeExprBuilder::MakeFunction(
+      function, {TreeExprBuilder::MakeField(field0), TreeExprBuilder::MakeField(field1)},
+      int64());
+  auto expr = TreeExprBuilder::MakeExpression(result, field_result);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {expr}, TestConfiguration(), &projector));
+
+  Int64DataGenerator data_generator;
+  ProjectEvaluator evaluator(projector);
+
+  Status status = TimedEvaluate<arrow::Int64Type, int64_t>(
+      schema, evaluator, data_generator, pool_, 1 * MILLION, 16 * THOUSAND, state);
+  ASSERT_OK(status);
+}
+
+static void TimedTestSubtract2(benchmark::State& state) {
+  TimedTestInt64Binary(state, "subtract");
+}
+
+static void TimedTestMultiply2(benchmark::State& state) {
+  TimedTestInt64Binary(state, "multiply");
+}
+
+static void TimedTestDivide2(benchmark::State& state) {
+  TimedTestInt64Binary(state, "divide");
+}
+
 static void TimedTestBigNested(benchmark::State& state) {
   // schema for input fields
   auto fielda = field("a", int32());
@@ -391,6 +429,9 @@ static void DecimalAdd3Large(benchmark::State& state) {
 }
 
 BENCHMARK(TimedTestAdd3)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(TimedTestSubtract2)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(TimedTestMultiply2)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(TimedTestDivide2)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestBigNested)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestExtractYear)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 BENCHMARK(TimedTestFilterAdd2)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
@@ -1895,6 +1895,73 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, num_rows / 3, arrow_properties, &buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(4, reader->num_row_groups());
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+}
+
+TEST(TestArrowReadWrite, WriteTableMaxRowGroupBytes) {
+  const int num_columns = 4;
+  const int num_rows = 50000;
+  const int64_t max_row_group_bytes = 256 * 1024;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 2, &table));
+
+  for (bool use_threads : {false, true}) {
+    auto write_props = WriterProperties::Builder()
+                           .write_batch_size(1000)
+                           ->disable_dictionary()
+                           ->max_row_group_bytes(max_row_group_bytes)
+                           ->build();
+    auto arrow_properties =
+        ArrowWriterProperties::Builder().set_use_threads(use_threads)->build();
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  table->num_rows(), write_props, arrow_properties));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    // About 3 MB of values, split by size rather than by the chunk size
+    const int num_row_groups = reader->num_row_groups();
+    ASSERT_GT(num_row_groups, 4);
+    int64_t rows_read = 0;
+    for (int i = 0; i < num_row_groups; ++i) {
+      auto row_group = reader->parquet_reader()->metadata()->RowGroup(i);
+      rows_read += row_group->num_rows();
+      // The last slice of a row group may overshoot by one write batch
+      ASSERT_LT(row_group->total_byte_size(), max_row_group_bytes * 5 / 4);
+      if (i < num_row_groups - 1) {
+        ASSERT_GT(row_group->total_byte_size(), max_row_group_bytes * 3 / 4);
+      }
+    }
+    ASSERT_EQ(num_rows * 2, rows_read);
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  }
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -1931,6 +1998,129 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   AssertTablesEqual(*table, *concatenated, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowReadWrite, ReadRowGroupsFiltered) {
+  const int32_t num_rows = 10000;
+  ::arrow::random::RandomArrayGenerator rag(42);
+
+  // A sequential key with some nulls, optional flat columns and a list column,
+  // written in small pages
+  std::vector<int32_t> keys(num_rows);
+  std::vector<bool> keys_valid(num_rows);
+  for (int32_t i = 0; i < num_rows; ++i) {
+    keys[i] = i;
+    keys_valid[i] = i % 7 != 0;
+  }
+  std::shared_ptr<Array> key_array, list_array;
+  ::arrow::ArrayFromVector<::arrow::Int32Type, int32_t>(keys_valid, keys, &key_array);
+  auto list_values = rag.Int32(2 * num_rows, 0, 100, /*null_probability=*/0.1);
+  ASSERT_OK(::arrow::ListArray::FromArrays(*rag.Offsets(num_rows + 1, 0, 2 * num_rows),
+                                           *list_values, default_memory_pool(),
+                                           &list_array));
+  auto table = Table::Make(
+      ::arrow::schema({::arrow::field("key", ::arrow::int32()),
+                       ::arrow::field("f64", ::arrow::float64()),
+                       ::arrow::field("str", ::arrow::utf8()),
+                       ::arrow::field("list", list_array->type())}),
+      {key_array, rag.Float64(num_rows, 0, 1, 0.2), rag.String(num_rows, 0, 16, 0.2),
+       list_array});
+
+  auto sink = CreateOutputStream();
+  auto write_props =
+      WriterProperties::Builder().data_pagesize(1024)->write_batch_size(64)->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), sink, num_rows / 2,
+                                write_props, default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(
+      OpenFile(std::make_shared<BufferReader>(buffer), default_memory_pool(), &reader));
+  ASSERT_EQ(2, reader->num_row_groups());
+  const std::vector<int> all_columns = {0, 1, 2, 3};
+
+  // Select runs of 200 keys out of 1000, a null key selecting nothing
+  auto selected = [](int32_t key) { return key % 1000 >= 300 && key % 1000 < 500; };
+  auto run_filter = [&](const Table& filter_columns,
+                        std::shared_ptr<ChunkedArray>* selection) {
+    ::arrow::ArrayVector chunks;
+    for (const auto& chunk : filter_columns.column(0)->chunks()) {
+      const auto& keys =
+          ::arrow::internal::checked_cast<const ::arrow::Int32Array&>(*chunk);
+      ::arrow::BooleanBuilder builder;
+      for (int64_t i = 0; i < keys.length(); ++i) {
+        if (keys.IsNull(i)) {
+          RETURN_NOT_OK(builder.AppendNull());
+        } else {
+          RETURN_NOT_OK(builder.Append(selected(keys.Value(i))));
+        }
+      }
+      std::shared_ptr<Array> chunk_selection;
+      RETURN_NOT_OK(builder.Finish(&chunk_selection));
+      chunks.push_back(chunk_selection);
+    }
+    *selection = std::make_shared<ChunkedArray>(chunks, ::arrow::boolean());
+    return Status::OK();
+  };
+
+  std::vector<bool> expected_selection(num_rows);
+  for (int32_t i = 0; i < num_rows; ++i) {
+    expected_selection[i] = keys_valid[i] && selected(i);
+  }
+  std::shared_ptr<Array> expected_mask;
+  ::arrow::ArrayFromVector<::arrow::BooleanType, bool>(expected_selection,
+                                                        &expected_mask);
+  std::shared_ptr<Table> expected;
+  FunctionContext ctx;
+  ASSERT_OK(::arrow::compute::Filter(&ctx, *table, *expected_mask, &expected));
+
+  for (bool use_threads : {false, true}) {
+    reader->set_use_threads(use_threads);
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(
+        reader->ReadRowGroupsFiltered({0, 1}, all_columns, {0}, run_filter, &result));
+    ASSERT_OK(result->ValidateFull());
+    ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+  }
+
+  // Filter columns may differ from the columns read
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(
+      reader->ReadRowGroupsFiltered({1}, {1, 2}, {0}, run_filter, &result));
+  std::shared_ptr<Table> expected_subset;
+  ASSERT_OK(expected->RemoveColumn(3, &expected_subset));
+  ASSERT_OK(expected_subset->RemoveColumn(0, &expected_subset));
+  const int64_t second_row_group_selected = std::count(
+      expected_selection.begin() + num_rows / 2, expected_selection.end(), true);
+  ::arrow::AssertTablesEqual(
+      *expected_subset->Slice(expected->num_rows() - second_row_group_selected),
+      *result, /*same_chunk_layout=*/false);
+
+  // Row groups without any selected row
+  auto none_filter = [](const Table& filter_columns,
+                        std::shared_ptr<ChunkedArray>* selection) {
+    std::shared_ptr<Array> all_false;
+    RETURN_NOT_OK(::arrow::MakeArrayFromScalar(
+        ::arrow::BooleanScalar(false), filter_columns.num_rows(), &all_false));
+    *selection = std::make_shared<ChunkedArray>(::arrow::ArrayVector{all_false});
+    return Status::OK();
+  };
+  ASSERT_OK_NO_THROW(
+      reader->ReadRowGroupsFiltered({0, 1}, all_columns, {0}, none_filter, &result));
+  ASSERT_EQ(0, result->num_rows());
+  ASSERT_TRUE(result->schema()->Equals(*table->schema()));
+
+  // Invalid selections
+  auto short_filter = [](const Table& filter_columns,
+                         std::shared_ptr<ChunkedArray>* selection) {
+    *selection = std::make_shared<ChunkedArray>(
+        ::arrow::ArrayVector{::arrow::ArrayFromJSON(::arrow::boolean(), "[true]")});
+    return Status::OK();
+  };
+  ASSERT_RAISES(Invalid, reader->ReadRowGroupsFiltered({0}, all_columns, {0},
+                                                       short_filter, &result));
+  ASSERT_RAISES(Invalid, reader->ReadRowGroupsFiltered({0}, all_columns, {}, run_filter,
+                                                       &result));
+}
+
 //  Exercise reading table manually with nested RowGroup and Column loops, i.e.
 //
 //  for (int i = 0; i < n_row_groups; i++)
@@ -1979,7 +2169,7 @@ TEST(TestArrowReadWrite, ReadTableManually) {
   AssertTablesEqual(*actual, *expected, /*same_chunk_layout=*/false);
 }
 
-TEST(TestArrowReadWrite, GetRecordBatchReader) {
+void TestGetRecordBatchReader(bool use_threads) {
   const int num_columns = 20;
   const int num_rows = 1000;
   const int batch_size = 100;
@@ -1993,6 +2183,7 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
 
   ArrowReaderProperties properties = default_arrow_reader_properties();
   properties.set_batch_size(batch_size);
+  properties.set_use_threads(use_threads);
 
   std::unique_ptr<FileReader> reader;
   FileReaderBuilder builder;
@@ -2029,6 +2220,17 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
 
   ASSERT_OK(rb_reader->ReadNext(&actual_batch));
   ASSERT_EQ(nullptr, actual_batch);
+
+  // Stop reading early, possibly while the next batch is being read ahead
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+  ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+  rb_reader.reset();
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchReader) { TestGetRecordBatchReader(false); }
+
+TEST(TestArrowReadWrite, GetRecordBatchReaderUseThreads) {
+  TestGetRecordBatchReader(true);
 }
 
 TEST(TestArrowReadWrite, ScanContents) {
@@ -2681,10 +2883,96 @@ TEST_F(TestNestedSchemaRead, ReadTablePartial) {
   ASSERT_NO_FATAL_FAILURE(ValidateTableArrayTypes(*table));
 }
 
-TEST_F(TestNestedSchemaRead, StructAndListTogetherUnsupported) {
+TEST_F(TestNestedSchemaRead, ReadRepeatedStruct) {
+  // The repeated group is read as a list of structs
   ASSERT_NO_FATAL_FAILURE(CreateSimpleNestedParquet(Repetition::REPEATED));
   std::shared_ptr<Table> table;
-  ASSERT_RAISES(NotImplemented, reader_->ReadTable(&table));
+  ASSERT_OK_NO_THROW(reader_->ReadTable(&table));
+  ASSERT_EQ(table->num_rows(), NUM_SIMPLE_TEST_ROWS);
+  ASSERT_NO_FATAL_FAILURE(ValidateTableArrayTypes(*table));
+
+  // Every third list is empty, the others have a single element
+  auto list_array = std::static_pointer_cast<ListArray>(table->column(0)->chunk(0));
+  ASSERT_OK(list_array->ValidateFull());
+  ASSERT_EQ(list_array->null_count(), 0);
+  for (int i = 0; i < NUM_SIMPLE_TEST_ROWS; i++) {
+    ASSERT_EQ(list_array->value_length(i), (i % 3 == 0) ? 0 : 1);
+  }
+  auto struct_array =
+      std::static_pointer_cast<::arrow::StructArray>(list_array->values());
+  ASSERT_EQ(struct_array->length(), NUM_SIMPLE_TEST_ROWS * 2 / 3);
+  ASSERT_EQ(struct_array->null_count(), 0);
+  ASSERT_EQ(struct_array->field(0)->null_count(), 0);
+  ASSERT_EQ(struct_array->field(1)->null_count(), NUM_SIMPLE_TEST_ROWS / 3);
+}
+
+TEST_F(TestNestedSchemaRead, ReadListOfStructsOfLists) {
+  // optional group col (LIST) {
+  //   repeated group list {
+  //     optional group element {
+  //       optional group a (LIST) {
+  //         repeated group list {
+  //           optional int32 element;
+  //         }
+  //       }
+  //       required int32 b;
+  //     }
+  //   }
+  // }
+  auto a = GroupNode::Make(
+      "a", Repetition::OPTIONAL,
+      {GroupNode::Make("list", Repetition::REPEATED,
+                       {PrimitiveNode::Make("element", Repetition::OPTIONAL,
+                                            ParquetType::INT32)})},
+      LogicalType::List());
+  auto element = GroupNode::Make(
+      "element", Repetition::OPTIONAL,
+      {a, PrimitiveNode::Make("b", Repetition::REQUIRED, ParquetType::INT32)});
+  auto col = GroupNode::Make("col", Repetition::OPTIONAL,
+                             {GroupNode::Make("list", Repetition::REPEATED, {element})},
+                             LogicalType::List());
+  auto schema_node = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, {col}));
+
+  // Rows: null, [], [null, {a: null, b: 1}, {a: [], b: 2}], [{a: [3, null], b: 4}]
+  std::vector<int16_t> a_def_levels = {0, 1, 2, 3, 4, 6, 5};
+  std::vector<int16_t> a_rep_levels = {0, 0, 0, 1, 1, 0, 2};
+  std::vector<int32_t> a_values = {3};
+  std::vector<int16_t> b_def_levels = {0, 1, 2, 3, 3, 3};
+  std::vector<int16_t> b_rep_levels = {0, 0, 0, 1, 1, 0};
+  std::vector<int32_t> b_values = {1, 2, 4};
+
+  InitNewParquetFile(schema_node, 4);
+  WriteColumnData(a_def_levels.size(), a_def_levels.data(), a_rep_levels.data(),
+                  a_values.data());
+  WriteColumnData(b_def_levels.size(), b_def_levels.data(), b_rep_levels.data(),
+                  b_values.data());
+  FinalizeParquetFile();
+  InitReader();
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK_NO_THROW(reader_->ReadTable(&table));
+  ASSERT_EQ(table->num_rows(), 4);
+  ASSERT_NO_FATAL_FAILURE(ValidateTableArrayTypes(*table));
+  auto actual = table->column(0)->chunk(0);
+  ASSERT_OK(actual->ValidateFull());
+
+  auto expected = ::arrow::ArrayFromJSON(actual->type(), R"([
+      null,
+      [],
+      [null, {"a": null, "b": 1}, {"a": [], "b": 2}],
+      [{"a": [3, null], "b": 4}]
+    ])");
+  ::arrow::AssertArraysEqual(*expected, *actual);
+
+  // Only read the struct's second field
+  ASSERT_OK_NO_THROW(reader_->ReadTable({1}, &table));
+  actual = table->column(0)->chunk(0);
+  ASSERT_OK(actual->ValidateFull());
+  expected = ::arrow::ArrayFromJSON(actual->type(), R"([
+      null, [], [null, {"b": 1}, {"b": 2}], [{"b": 4}]
+    ])");
+  ::arrow::AssertArraysEqual(*expected, *actual);
 }
 
 TEST_P(TestNestedSchemaRead, DeepNestedSchemaRead) {
@@ -3008,6 +3296,111 @@ INSTANTIATE_TEST_SUITE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+// Decode the dictionary-encoded chunks of a column to dense values
+void DecodeDictionaryColumn(const ChunkedArray& column,
+                            std::shared_ptr<ChunkedArray>* out) {
+  FunctionContext ctx(default_memory_pool());
+  ::arrow::ArrayVector chunks;
+  for (const auto& chunk : column.chunks()) {
+    const auto& dict_array = static_cast<const ::arrow::DictionaryArray&>(*chunk);
+    std::shared_ptr<Array> dense;
+    ASSERT_OK(::arrow::compute::Take(&ctx, *dict_array.dictionary(),
+                                     *dict_array.indices(), {}, &dense));
+    chunks.push_back(dense);
+  }
+  *out = std::make_shared<ChunkedArray>(chunks);
+}
+
+TEST(TestArrowReadDictionaries, ReadPrimitiveTypes) {
+  auto fields = {::arrow::field("int8", ::arrow::int8()),
+                 ::arrow::field("uint16", ::arrow::uint16()),
+                 ::arrow::field("int64", ::arrow::int64()),
+                 ::arrow::field("double", ::arrow::float64()),
+                 ::arrow::field("date32", ::arrow::date32()),
+                 ::arrow::field("decimal", ::arrow::decimal(10, 2)),
+                 ::arrow::field("fixed", ::arrow::fixed_size_binary(3))};
+  auto table = ::arrow::TableFromJSON(::arrow::schema(fields), {R"([
+    [1, 60000, -5, 1.5, 1, "1.23", "abc"],
+    [2, 60000, 7, null, 0, "-4.56", "def"],
+    [null, 1, -5, 1.5, 1, null, "abc"],
+    [1, 1, null, 2.5, null, "1.23", null],
+    [2, null, 7, 2.5, 0, "-4.56", "abc"],
+    [3, 60000, 8, 1.5, 2, "7.89", "ghi"]
+  ])"});
+
+  std::shared_ptr<Buffer> buffer;
+  // Several row groups, each with its own dictionaries
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, /*row_group_size=*/4,
+                         default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  for (int i = 0; i < table->num_columns(); ++i) {
+    properties.set_read_dictionary(i, true);
+  }
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ASSERT_EQ(actual->num_columns(), table->num_columns());
+  for (int i = 0; i < table->num_columns(); ++i) {
+    const auto& expected = table->column(i);
+    const auto& column = actual->column(i);
+    ASSERT_TRUE(column->type()->Equals(
+        ::arrow::dictionary(::arrow::int32(), expected->type())))
+        << column->type()->ToString();
+    ASSERT_EQ(column->num_chunks(), 2);
+
+    std::shared_ptr<ChunkedArray> dense;
+    ASSERT_NO_FATAL_FAILURE(DecodeDictionaryColumn(*column, &dense));
+    ::arrow::AssertChunkedEqual(*expected, *dense);
+  }
+}
+
+TEST(TestArrowReadDictionaries, ReadListOfDictionaries) {
+  // The elements of all row groups are concatenated, which requires
+  // unifying the dictionaries of the row groups
+  auto type = ::arrow::list(::arrow::int64());
+  auto values = ::arrow::ArrayFromJSON(type, "[[1, 2], [], null, [3, 1], [2, null, 4]]");
+  auto table = MakeSimpleTable(values, /*nullable=*/true);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, /*row_group_size=*/2,
+                         default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  auto column = actual->column(0);
+  ASSERT_TRUE(column->type()->Equals(
+      ::arrow::list(::arrow::dictionary(::arrow::int32(), ::arrow::int64()))));
+  ASSERT_EQ(column->num_chunks(), 1);
+
+  const auto& list_array = static_cast<const ListArray&>(*column->chunk(0));
+  ASSERT_OK(list_array.ValidateFull());
+  const auto& elements = static_cast<const ::arrow::DictionaryArray&>(
+      *list_array.values());
+  ::arrow::AssertArraysEqual(
+      *::arrow::ArrayFromJSON(::arrow::int64(), "[1, 2, 3, 4]"), *elements.dictionary());
+
+  std::shared_ptr<ChunkedArray> dense_elements;
+  ASSERT_NO_FATAL_FAILURE(
+      DecodeDictionaryColumn(ChunkedArray(list_array.values()), &dense_elements));
+  ::arrow::AssertChunkedEqual(
+      ChunkedArray(::arrow::ArrayFromJSON(::arrow::int64(), "[1, 2, 3, 1, 2, null, 4]")),
+      *dense_elements);
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -3033,6 +3426,67 @@ TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowWriteDictionaries, ChangingPrimitiveDictionaries) {
+  // Successive dictionaries of non-binary types are merged into the column
+  // chunk's dictionary rather than falling back to plain encoding
+  struct Case {
+    std::shared_ptr<DataType> value_type;
+    std::vector<std::string> dicts;
+    std::string expected;
+  };
+  const std::vector<std::string> indices = {"[2, 0, null, 1]", "[1, null, 0, 2]",
+                                            "[0, 0]"};
+  const std::vector<Case> cases = {
+      {::arrow::int64(),
+       {"[10, 20, 30]", "[30, 40, 10]", "[20]"},
+       "[30, 10, null, 20, 40, null, 30, 10, 20, 20]"},
+      {::arrow::date32(),
+       {"[10, 20, 30]", "[30, 40, 10]", "[20]"},
+       "[30, 10, null, 20, 40, null, 30, 10, 20, 20]"},
+      {::arrow::decimal(10, 2),
+       {R"(["0.10", "0.20", "0.30"])", R"(["0.30", "0.40", "0.10"])", R"(["0.20"])"},
+       R"(["0.30", "0.10", null, "0.20", "0.40", null, "0.30", "0.10", "0.20",
+           "0.20"])"}};
+
+  for (const auto& test_case : cases) {
+    SCOPED_TRACE(test_case.value_type->ToString());
+    auto dict_type = ::arrow::dictionary(::arrow::int8(), test_case.value_type);
+    std::vector<std::shared_ptr<Array>> chunks(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+      ASSERT_OK(::arrow::DictionaryArray::FromArrays(
+          dict_type, ::arrow::ArrayFromJSON(::arrow::int8(), indices[i]),
+          ::arrow::ArrayFromJSON(test_case.value_type, test_case.dicts[i]),
+          &chunks[i]));
+    }
+    auto dict_table = MakeSimpleTable(std::make_shared<ChunkedArray>(chunks),
+                                      /*nullable=*/true);
+    auto expected = MakeSimpleTable(
+        ::arrow::ArrayFromJSON(test_case.value_type, test_case.expected),
+        /*nullable=*/true);
+
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(dict_table, /*row_group_size=*/10,
+                                               default_arrow_writer_properties(),
+                                               &buffer));
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    auto column_metadata =
+        reader->parquet_reader()->metadata()->RowGroup(0)->ColumnChunk(0);
+    ASSERT_TRUE(column_metadata->has_dictionary_page());
+    for (const auto& stats : column_metadata->encoding_stats()) {
+      if (stats.page_type == PageType::DATA_PAGE) {
+        ASSERT_EQ(Encoding::PLAIN_DICTIONARY, stats.encoding);
+      }
+    }
+
+    std::shared_ptr<Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+    ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST(TestArrowWriteDictionaries, AutoReadAsDictionary) {
   constexpr int num_unique = 50;
   constexpr int repeat = 100;
@@ -24,18 +24,26 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/filter.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
 #include "arrow/util/thread_pool.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/column_reader.h"
 #include "parquet/exception.h"
 #include "parquet/file_reader.h"
+#include "parquet/level_conversion.h"
 #include "parquet/metadata.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -55,6 +63,7 @@ using arrow::Status;
 using arrow::StructArray;
 using arrow::Table;
 using arrow::TimestampArray;
+using arrow::internal::checked_cast;
 using arrow::internal::Iota;
 
 using parquet::schema::GroupNode;
@@ -64,6 +73,9 @@ using parquet::schema::PrimitiveNode;
 // Help reduce verbosity
 using ParquetReader = parquet::ParquetFileReader;
 
+using parquet::internal::DefRepLevelsToBitmap;
+using parquet::internal::DefRepLevelsToList;
+using parquet::internal::LevelInfo;
 using parquet::internal::RecordReader;
 
 #define BEGIN_PARQUET_CATCH_EXCEPTIONS try {
@@ -87,6 +99,16 @@ class ColumnReaderImpl : public ColumnReader {
   virtual const ColumnDescriptor* descr() const = 0;
 
   virtual ReaderType type() const = 0;
+
+  // Read the next records at the positions set in `selection`, which must not
+  // have nulls.  By default all records are read then filtered.
+  virtual Status NextSelectedBatch(const BooleanArray& selection, MemoryPool* pool,
+                                   std::shared_ptr<ChunkedArray>* out) {
+    std::shared_ptr<ChunkedArray> all_records;
+    RETURN_NOT_OK(NextBatch(selection.length(), &all_records));
+    ::arrow::compute::FunctionContext ctx(pool);
+    return ::arrow::compute::Filter(&ctx, *all_records, selection, out);
+  }
 };
 
 std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
@@ -251,6 +273,12 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroups(row_groups, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowGroupsFiltered(const std::vector<int>& row_groups,
+                               const std::vector<int>& column_indices,
+                               const std::vector<int>& filter_column_indices,
+                               const RowFilter& filter,
+                               std::shared_ptr<Table>* out) override;
+
   Status ReadRowGroup(int row_group_index, const std::vector<int>& column_indices,
                       std::shared_ptr<Table>* out) override {
     return ReadRowGroups({row_group_index}, column_indices, out);
@@ -298,18 +326,25 @@ class FileReaderImpl : public FileReader {
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
  public:
   RowGroupRecordBatchReader(std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers,
-                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size)
+                            std::shared_ptr<::arrow::Schema> schema, int64_t batch_size,
+                            bool use_threads)
       : field_readers_(std::move(field_readers)),
         schema_(std::move(schema)),
-        batch_size_(batch_size) {}
+        batch_size_(batch_size),
+        use_threads_(use_threads) {}
 
-  ~RowGroupRecordBatchReader() override {}
+  ~RowGroupRecordBatchReader() override {
+    // A pending readahead still uses the field readers
+    if (readahead_.is_valid()) {
+      readahead_.Wait();
+    }
+  }
 
   std::shared_ptr<::arrow::Schema> schema() const override { return schema_; }
 
   static Status Make(const std::vector<int>& row_groups,
                      const std::vector<int>& column_indices, FileReaderImpl* reader,
-                     int64_t batch_size,
+                     int64_t batch_size, bool use_threads,
                      std::unique_ptr<::arrow::RecordBatchReader>* out) {
     std::vector<int> field_indices;
     if (!reader->manifest_.GetFieldIndices(column_indices, &field_indices)) {
@@ -324,21 +359,60 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
                                            &field_readers[i]));
       fields.push_back(field_readers[i]->field());
     }
-    out->reset(new RowGroupRecordBatchReader(std::move(field_readers),
-                                             ::arrow::schema(fields), batch_size));
+    out->reset(new RowGroupRecordBatchReader(
+        std::move(field_readers), ::arrow::schema(fields), batch_size, use_threads));
     return Status::OK();
   }
 
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
-    // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
-    // does not currently honor the use_threads option.
+    if (!use_threads_) {
+      return DecodeNext(out);
+    }
+
+    // The next batch is decoded in the background while the current one is
+    // consumed, so that at most two batches are held at once.
+    if (!readahead_.is_valid()) {
+      RETURN_NOT_OK(Readahead());
+    }
+    const auto& result = readahead_.result();
+    if (!result.ok()) {
+      return result.status();
+    }
+    *out = *result;
+    if (*out != nullptr) {
+      RETURN_NOT_OK(Readahead());
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status Readahead() {
+    // Decoding is dispatched to the CPU thread pool, so wait for it from the IO
+    // thread pool rather than hold a CPU thread.
+    auto decode_next =
+        [this]() -> ::arrow::Result<std::shared_ptr<::arrow::RecordBatch>> {
+      std::shared_ptr<::arrow::RecordBatch> batch;
+      RETURN_NOT_OK(DecodeNext(&batch));
+      return batch;
+    };
+    ARROW_ASSIGN_OR_RAISE(readahead_,
+                          ::arrow::io::internal::GetIOThreadPool()->Submit(decode_next));
+    return Status::OK();
+  }
+
+  Status DecodeNext(std::shared_ptr<::arrow::RecordBatch>* out) {
     std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
-    for (size_t i = 0; i < field_readers_.size(); ++i) {
+    auto read_column = [&](int i) -> Status {
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
       RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
       if (columns[i]->num_chunks() > 1) {
         return Status::NotImplemented("This class cannot yet iterate chunked arrays");
       }
-    }
+      return Status::OK();
+      END_PARQUET_CATCH_EXCEPTIONS
+    };
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        use_threads_, static_cast<int>(field_readers_.size()), read_column));
 
     // Create an intermediate table and use TableBatchReader as an adaptor to a
     // RecordBatch
@@ -348,10 +422,11 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
     return table_batch_reader.ReadNext(out);
   }
 
- private:
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
   std::shared_ptr<::arrow::Schema> schema_;
   int64_t batch_size_;
+  bool use_threads_;
+  Future<std::shared_ptr<::arrow::RecordBatch>> readahead_;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -407,14 +482,15 @@ class LeafReader : public ColumnReaderImpl {
     NextRowGroup();
   }
 
+  // The levels are null if the column doesn't have any
   Status GetDefLevels(const int16_t** data, int64_t* length) override {
-    *data = record_reader_->def_levels();
+    *data = descr_->max_definition_level() > 0 ? record_reader_->def_levels() : nullptr;
     *length = record_reader_->levels_position();
     return Status::OK();
   }
 
   Status GetRepLevels(const int16_t** data, int64_t* length) override {
-    *data = record_reader_->rep_levels();
+    *data = descr_->max_repetition_level() > 0 ? record_reader_->rep_levels() : nullptr;
     *length = record_reader_->levels_position();
     return Status::OK();
   }
@@ -442,6 +518,47 @@ class LeafReader : public ColumnReaderImpl {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  Status NextSelectedBatch(const BooleanArray& selection, MemoryPool* pool,
+                           std::shared_ptr<ChunkedArray>* out) override {
+    if (descr_->max_repetition_level() > 0) {
+      return ColumnReaderImpl::NextSelectedBatch(selection, pool, out);
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+
+    const uint8_t* selected_bits = selection.values()->data();
+    const int64_t offset = selection.offset();
+    const int64_t length = selection.length();
+    record_reader_->Reserve(
+        ::arrow::internal::CountSetBits(selected_bits, offset, length));
+    record_reader_->Reset();
+
+    // Alternately skip and read runs of unselected and selected records
+    int64_t position = 0;
+    while (position < length) {
+      const bool selected = ::arrow::BitUtil::GetBit(selected_bits, offset + position);
+      int64_t run_end = position + 1;
+      while (run_end < length &&
+             ::arrow::BitUtil::GetBit(selected_bits, offset + run_end) == selected) {
+        ++run_end;
+      }
+      int64_t records_to_process = run_end - position;
+      while (records_to_process > 0 && record_reader_->HasMoreData()) {
+        const int64_t records_processed =
+            selected ? record_reader_->ReadRecords(records_to_process)
+                     : record_reader_->SkipRecords(records_to_process);
+        records_to_process -= records_processed;
+        if (records_processed == 0) {
+          NextRowGroup();
+        }
+      }
+      position = run_end;
+    }
+    RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
+                                     ctx_->pool, out));
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   const std::shared_ptr<Field> field() override { return field_; }
   const ColumnDescriptor* descr() const override { return descr_; }
 
@@ -460,15 +577,125 @@ class LeafReader : public ColumnReaderImpl {
   std::shared_ptr<RecordReader> record_reader_;
 };
 
-class NestedListReader : public ColumnReaderImpl {
+// Dictionary-encoded chunks read from different row groups generally have
+// different dictionaries, transpose them onto a unified dictionary
+Status UnifyDictionaryChunks(const ChunkedArray& chunked, MemoryPool* pool,
+                             ::arrow::ArrayVector* out) {
+  const auto& dict_type = checked_cast<const ::arrow::DictionaryType&>(*chunked.type());
+  std::unique_ptr<::arrow::DictionaryUnifier> unifier;
+  RETURN_NOT_OK(::arrow::DictionaryUnifier::Make(pool, dict_type.value_type(), &unifier));
+  std::vector<std::shared_ptr<Buffer>> transpose_maps(chunked.num_chunks());
+  for (int i = 0; i < chunked.num_chunks(); ++i) {
+    const auto& chunk = checked_cast<const ::arrow::DictionaryArray&>(*chunked.chunk(i));
+    RETURN_NOT_OK(unifier->Unify(*chunk.dictionary(), &transpose_maps[i]));
+  }
+  std::shared_ptr<DataType> unified_type;
+  std::shared_ptr<Array> unified_dictionary;
+  RETURN_NOT_OK(unifier->GetResult(&unified_type, &unified_dictionary));
+
+  // Keep the index type of the read dictionaries
+  unified_type = ::arrow::dictionary(dict_type.index_type(), dict_type.value_type(),
+                                     dict_type.ordered());
+  out->resize(chunked.num_chunks());
+  for (int i = 0; i < chunked.num_chunks(); ++i) {
+    const auto& chunk = checked_cast<const ::arrow::DictionaryArray&>(*chunked.chunk(i));
+    RETURN_NOT_OK(chunk.Transpose(
+        pool, unified_type, unified_dictionary,
+        reinterpret_cast<const int32_t*>(transpose_maps[i]->data()), &(*out)[i]));
+  }
+  return Status::OK();
+}
+
+// Nested lists are reassembled over a single array of elements
+Status ConcatenateChunks(const ChunkedArray& chunked, MemoryPool* pool,
+                         std::shared_ptr<Array>* out) {
+  if (chunked.num_chunks() == 1) {
+    *out = chunked.chunk(0);
+    return Status::OK();
+  } else if (chunked.num_chunks() == 0) {
+    return ::arrow::MakeArrayOfNull(pool, chunked.type(), 0, out);
+  }
+  if (chunked.type()->id() == ::arrow::Type::DICTIONARY) {
+    const auto& first = checked_cast<const ::arrow::DictionaryArray&>(*chunked.chunk(0));
+    for (int i = 1; i < chunked.num_chunks(); ++i) {
+      const auto& chunk =
+          checked_cast<const ::arrow::DictionaryArray&>(*chunked.chunk(i));
+      if (!chunk.dictionary()->Equals(*first.dictionary())) {
+        ::arrow::ArrayVector unified_chunks;
+        RETURN_NOT_OK(UnifyDictionaryChunks(chunked, pool, &unified_chunks));
+        return ::arrow::Concatenate(unified_chunks, pool, out);
+      }
+    }
+  }
+  return ::arrow::Concatenate(chunked.chunks(), pool, out);
+}
+
+// Assemble a struct array from children that may be chunked differently, by
+// slicing them at their common chunk boundaries
+Status MakeStructChunks(const std::shared_ptr<DataType>& type, int64_t length,
+                        const std::vector<std::shared_ptr<ChunkedArray>>& children,
+                        const std::shared_ptr<Buffer>& null_bitmap, int64_t null_count,
+                        MemoryPool* pool, std::shared_ptr<ChunkedArray>* out) {
+  const bool single_chunk =
+      std::all_of(children.begin(), children.end(),
+                  [](const std::shared_ptr<ChunkedArray>& child) {
+                    return child->num_chunks() == 1;
+                  });
+  if (single_chunk) {
+    ::arrow::ArrayVector children_arrays;
+    for (const auto& child : children) {
+      children_arrays.push_back(child->chunk(0));
+    }
+    *out = std::make_shared<ChunkedArray>(std::make_shared<StructArray>(
+        type, length, children_arrays, null_bitmap, null_count));
+    return Status::OK();
+  }
+
+  std::vector<int> chunk_index(children.size(), 0);
+  std::vector<int64_t> chunk_offset(children.size(), 0);
+  ::arrow::ArrayVector chunks;
+  for (int64_t position = 0; position < length;) {
+    int64_t chunk_length = length - position;
+    for (size_t i = 0; i < children.size(); ++i) {
+      while (chunk_offset[i] == children[i]->chunk(chunk_index[i])->length()) {
+        ++chunk_index[i];
+        chunk_offset[i] = 0;
+      }
+      chunk_length = std::min(
+          chunk_length, children[i]->chunk(chunk_index[i])->length() - chunk_offset[i]);
+    }
+
+    ::arrow::ArrayVector children_arrays;
+    for (size_t i = 0; i < children.size(); ++i) {
+      children_arrays.push_back(
+          children[i]->chunk(chunk_index[i])->Slice(chunk_offset[i], chunk_length));
+      chunk_offset[i] += chunk_length;
+    }
+    std::shared_ptr<Buffer> chunk_null_bitmap;
+    int64_t chunk_null_count = 0;
+    if (null_bitmap != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(chunk_null_bitmap,
+                            ::arrow::internal::CopyBitmap(pool, null_bitmap->data(),
+                                                          position, chunk_length));
+      chunk_null_count = chunk_length - ::arrow::internal::CountSetBits(
+                                            null_bitmap->data(), position, chunk_length);
+    }
+    chunks.push_back(std::make_shared<StructArray>(
+        type, chunk_length, children_arrays, chunk_null_bitmap, chunk_null_count));
+    position += chunk_length;
+  }
+  *out = std::make_shared<ChunkedArray>(chunks, type);
+  return Status::OK();
+}
+
+// Reassembles lists of any type from the levels of the first leaf below them
+class PARQUET_NO_EXPORT ListReader : public ColumnReaderImpl {
  public:
-  NestedListReader(std::shared_ptr<ReaderContext> ctx, std::shared_ptr<Field> field,
-                   int16_t max_definition_level, int16_t max_repetition_level,
-                   std::unique_ptr<ColumnReaderImpl> item_reader)
+  ListReader(std::shared_ptr<ReaderContext> ctx, std::shared_ptr<Field> field,
+             LevelInfo level_info, std::unique_ptr<ColumnReaderImpl> item_reader)
       : ctx_(std::move(ctx)),
         field_(std::move(field)),
-        max_definition_level_(max_definition_level),
-        max_repetition_level_(max_repetition_level),
+        level_info_(level_info),
         item_reader_(std::move(item_reader)) {}
 
   Status GetDefLevels(const int16_t** data, int64_t* length) override {
@@ -480,29 +707,44 @@ class NestedListReader : public ColumnReaderImpl {
   }
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override {
-    if (item_reader_->type() == ColumnReaderImpl::STRUCT) {
-      return Status::Invalid("Mix of struct and list types not yet supported");
-    }
-
-    RETURN_NOT_OK(item_reader_->NextBatch(records_to_read, out));
-
-    // ARROW-3762(wesm): If item reader yields a chunked array, we reject as
-    // this is not yet implemented
-    if ((*out)->num_chunks() > 1) {
-      return Status::NotImplemented(
-          "Nested data conversions not implemented for chunked array outputs");
-    }
+    std::shared_ptr<ChunkedArray> items;
+    RETURN_NOT_OK(item_reader_->NextBatch(records_to_read, &items));
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(ConcatenateChunks(*items, ctx_->pool, &values));
 
     const int16_t* def_levels;
     const int16_t* rep_levels;
     int64_t num_levels;
     RETURN_NOT_OK(item_reader_->GetDefLevels(&def_levels, &num_levels));
     RETURN_NOT_OK(item_reader_->GetRepLevels(&rep_levels, &num_levels));
-    std::shared_ptr<Array> result;
-    RETURN_NOT_OK(ReconstructNestedList((*out)->chunk(0), field_, max_definition_level_,
-                                        max_repetition_level_, def_levels, rep_levels,
-                                        num_levels, ctx_->pool, &result));
-    *out = std::make_shared<ChunkedArray>(result);
+    if (def_levels == nullptr || rep_levels == nullptr) {
+      return Status::Invalid("Parquet list field \"", field_->ToString(),
+                             "\" has no repeated leaf");
+    }
+
+    std::shared_ptr<ResizableBuffer> offsets;
+    std::shared_ptr<ResizableBuffer> valid_bits;
+    RETURN_NOT_OK(AllocateResizableBuffer(
+        ctx_->pool, (num_levels + 1) * sizeof(int32_t), &offsets));
+    RETURN_NOT_OK(AllocateResizableBuffer(
+        ctx_->pool, ::arrow::BitUtil::BytesForBits(num_levels), &valid_bits));
+    auto offsets_data = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    int64_t length = 0;
+    int64_t null_count = 0;
+    DefRepLevelsToList(def_levels, rep_levels, num_levels, level_info_, offsets_data,
+                       valid_bits->mutable_data(), &length, &null_count);
+
+    if (offsets_data[length] != values->length()) {
+      return Status::IOError("Parquet list decoding error. Expected ",
+                             offsets_data[length], " elements in field \"",
+                             field_->ToString(), "\" but decoded ", values->length());
+    }
+    RETURN_NOT_OK(offsets->Resize((length + 1) * sizeof(int32_t)));
+    RETURN_NOT_OK(valid_bits->Resize(::arrow::BitUtil::BytesForBits(length)));
+
+    *out = std::make_shared<ChunkedArray>(
+        std::make_shared<ListArray>(field_->type(), length, offsets, values,
+                                    null_count > 0 ? valid_bits : nullptr, null_count));
     return Status::OK();
   }
 
@@ -515,190 +757,102 @@ class NestedListReader : public ColumnReaderImpl {
  private:
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
-  int16_t max_definition_level_;
-  int16_t max_repetition_level_;
+  LevelInfo level_info_;
   std::unique_ptr<ColumnReaderImpl> item_reader_;
 };
 
 class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
  public:
   explicit StructReader(std::shared_ptr<ReaderContext> ctx,
-                        const SchemaField& schema_field,
-                        std::shared_ptr<Field> filtered_field,
+                        std::shared_ptr<Field> filtered_field, LevelInfo level_info,
                         std::vector<std::unique_ptr<ColumnReaderImpl>>&& children)
       : ctx_(std::move(ctx)),
-        schema_field_(schema_field),
         filtered_field_(std::move(filtered_field)),
-        struct_def_level_(schema_field.max_definition_level),
+        level_info_(level_info),
         children_(std::move(children)) {}
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
-  Status GetDefLevels(const int16_t** data, int64_t* length) override;
-  Status GetRepLevels(const int16_t** data, int64_t* length) override;
+
+  // The levels of any leaf below the struct describe its slots; use the first
+  Status GetDefLevels(const int16_t** data, int64_t* length) override {
+    return children_[0]->GetDefLevels(data, length);
+  }
+  Status GetRepLevels(const int16_t** data, int64_t* length) override {
+    return children_[0]->GetRepLevels(data, length);
+  }
+
   const std::shared_ptr<Field> field() override { return filtered_field_; }
   const ColumnDescriptor* descr() const override { return nullptr; }
   ReaderType type() const override { return STRUCT; }
 
  private:
   std::shared_ptr<ReaderContext> ctx_;
-  SchemaField schema_field_;
   std::shared_ptr<Field> filtered_field_;
-  int16_t struct_def_level_;
+  LevelInfo level_info_;
   std::vector<std::unique_ptr<ColumnReaderImpl>> children_;
-  std::shared_ptr<ResizableBuffer> def_levels_buffer_;
-  Status DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap, int64_t* null_count);
 };
 
-Status StructReader::DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap_out,
-                                          int64_t* null_count_out) {
-  std::shared_ptr<Buffer> null_bitmap;
-  auto null_count = 0;
-  const int16_t* def_levels_data;
-  int64_t def_levels_length;
-  RETURN_NOT_OK(GetDefLevels(&def_levels_data, &def_levels_length));
-  RETURN_NOT_OK(AllocateEmptyBitmap(ctx_->pool, def_levels_length, &null_bitmap));
-  uint8_t* null_bitmap_ptr = null_bitmap->mutable_data();
-  for (int64_t i = 0; i < def_levels_length; i++) {
-    if (def_levels_data[i] < struct_def_level_) {
-      // Mark null
-      null_count += 1;
-    } else {
-      DCHECK_EQ(def_levels_data[i], struct_def_level_);
-      ::arrow::BitUtil::SetBit(null_bitmap_ptr, i);
-    }
-  }
-
-  *null_count_out = null_count;
-  *null_bitmap_out = (null_count == 0) ? nullptr : null_bitmap;
-  return Status::OK();
-}
-
-// TODO(itaiin): Consider caching the results of this calculation -
-//   note that this is only used once for each read for now
-Status StructReader::GetDefLevels(const int16_t** data, int64_t* length) {
-  *data = nullptr;
-  if (children_.size() == 0) {
-    // Empty struct
-    *length = 0;
-    return Status::OK();
-  }
-
-  // We have at least one child
-  const int16_t* child_def_levels;
-  int64_t child_length = 0;
-  bool found_nullable_child = false;
-  int16_t* result_levels = nullptr;
-
-  int child_index = 0;
-  while (child_index < static_cast<int>(children_.size())) {
-    if (!children_[child_index]->field()->nullable()) {
-      ++child_index;
-      continue;
-    }
-    RETURN_NOT_OK(children_[child_index]->GetDefLevels(&child_def_levels, &child_length));
-    auto size = child_length * sizeof(int16_t);
-    RETURN_NOT_OK(AllocateResizableBuffer(ctx_->pool, size, &def_levels_buffer_));
-    // Initialize with the minimal def level
-    std::memset(def_levels_buffer_->mutable_data(), -1, size);
-    result_levels = reinterpret_cast<int16_t*>(def_levels_buffer_->mutable_data());
-    found_nullable_child = true;
-    break;
-  }
-
-  if (!found_nullable_child) {
-    *data = nullptr;
-    *length = 0;
-    return Status::OK();
-  }
-
-  // Look at the rest of the children
-
-  // When a struct is defined, all of its children def levels are at least at
-  // nesting level, and def level equals nesting level.
-  // When a struct is not defined, all of its children def levels are less than
-  // the nesting level, and the def level equals max(children def levels)
-  // All other possibilities are malformed definition data.
-  for (; child_index < static_cast<int>(children_.size()); ++child_index) {
-    // Child is non-nullable, and therefore has no definition levels
-    if (!children_[child_index]->field()->nullable()) {
-      continue;
-    }
-
-    auto& child = children_[child_index];
-    int64_t current_child_length;
-    RETURN_NOT_OK(child->GetDefLevels(&child_def_levels, &current_child_length));
-
-    if (child_length != current_child_length) {
-      std::stringstream ss;
-      ss << "Parquet struct decoding error. Expected to decode " << child_length
-         << " definition levels"
-         << " from child field \"" << child->field()->ToString() << "\" in parent \""
-         << this->field()->ToString() << "\" but was only able to decode "
-         << current_child_length;
-      return Status::IOError(ss.str());
-    }
-
-    DCHECK_EQ(child_length, current_child_length);
-    for (int64_t i = 0; i < child_length; i++) {
-      // Check that value is either uninitialized, or current
-      // and previous children def levels agree on the struct level
-      DCHECK((result_levels[i] == -1) || ((result_levels[i] >= struct_def_level_) ==
-                                          (child_def_levels[i] >= struct_def_level_)));
-      result_levels[i] =
-          std::max(result_levels[i], std::min(child_def_levels[i], struct_def_level_));
-    }
-  }
-  *data = reinterpret_cast<const int16_t*>(def_levels_buffer_->data());
-  *length = static_cast<int64_t>(child_length);
-  return Status::OK();
-}
-
-Status StructReader::GetRepLevels(const int16_t** data, int64_t* length) {
-  return Status::NotImplemented("GetRepLevels is not implemented for struct");
-}
-
 Status StructReader::NextBatch(int64_t records_to_read,
                                std::shared_ptr<ChunkedArray>* out) {
-  std::vector<std::shared_ptr<Array>> children_arrays;
-  std::shared_ptr<Buffer> null_bitmap;
-  int64_t null_count;
-
-  // Gather children arrays and def levels
+  std::vector<std::shared_ptr<ChunkedArray>> children_arrays;
   for (auto& child : children_) {
-    if (child->type() == ColumnReaderImpl::LIST) {
-      return Status::Invalid("Mix of struct and list types not yet supported");
-    }
-
     std::shared_ptr<ChunkedArray> field;
     RETURN_NOT_OK(child->NextBatch(records_to_read, &field));
-
-    if (field->num_chunks() > 1) {
-      return Status::Invalid("Chunked field reads not yet supported with StructArray");
-    }
-    children_arrays.push_back(field->chunk(0));
+    children_arrays.push_back(std::move(field));
   }
 
-  RETURN_NOT_OK(DefLevelsToNullArray(&null_bitmap, &null_count));
+  const int16_t* def_levels;
+  const int16_t* rep_levels;
+  int64_t num_levels;
+  RETURN_NOT_OK(GetDefLevels(&def_levels, &num_levels));
+  RETURN_NOT_OK(GetRepLevels(&rep_levels, &num_levels));
 
   int64_t struct_length = children_arrays[0]->length();
-  for (size_t i = 1; i < children_arrays.size(); ++i) {
+  std::shared_ptr<ResizableBuffer> null_bitmap;
+  int64_t null_count = 0;
+  if (def_levels != nullptr && level_info_.HasNullableValues()) {
+    RETURN_NOT_OK(AllocateResizableBuffer(
+        ctx_->pool, ::arrow::BitUtil::BytesForBits(num_levels), &null_bitmap));
+    DefRepLevelsToBitmap(def_levels, rep_levels, num_levels, level_info_,
+                         null_bitmap->mutable_data(), 0, &struct_length, &null_count);
+    RETURN_NOT_OK(null_bitmap->Resize(::arrow::BitUtil::BytesForBits(struct_length)));
+  }
+
+  for (size_t i = 0; i < children_arrays.size(); ++i) {
     if (children_arrays[i]->length() != struct_length) {
-      // TODO(wesm): This should really only occur if the Parquet file is
-      // malformed. Should this be a DCHECK?
-      return Status::Invalid("Struct children had different lengths");
+      return Status::IOError("Parquet struct decoding error. Expected to decode ",
+                             struct_length, " values from child field \"",
+                             children_[i]->field()->ToString(), "\" in parent \"",
+                             field()->ToString(), "\" but decoded ",
+                             children_arrays[i]->length());
     }
   }
 
-  auto result = std::make_shared<StructArray>(field()->type(), struct_length,
-                                              children_arrays, null_bitmap, null_count);
-  *out = std::make_shared<ChunkedArray>(result);
-  return Status::OK();
+  return MakeStructChunks(field()->type(), struct_length, children_arrays,
+                          null_count > 0 ? null_bitmap : nullptr, null_count, ctx_->pool,
+                          out);
 }
 
 // ----------------------------------------------------------------------
 // File reader implementation
 
-Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>& ctx,
+// The levels describing the slots of a field in its Arrow array.  The
+// levels of a list field are those of its repeated child.
+LevelInfo ComputeLevelInfo(const SchemaField& field,
+                           int16_t repeated_ancestor_def_level) {
+  const bool is_list =
+      !field.is_leaf() && field.field->type()->id() == ::arrow::Type::LIST;
+  LevelInfo level_info;
+  level_info.def_level =
+      static_cast<int16_t>(field.max_definition_level - (is_list ? 1 : 0));
+  level_info.rep_level =
+      static_cast<int16_t>(field.max_repetition_level - (is_list ? 1 : 0));
+  level_info.repeated_ancestor_def_level = repeated_ancestor_def_level;
+  return level_info;
+}
+
+Status GetReader(const SchemaField& field, int16_t repeated_ancestor_def_level,
+                 const std::shared_ptr<ReaderContext>& ctx,
                  std::unique_ptr<ColumnReaderImpl>* out) {
   BEGIN_PARQUET_CATCH_EXCEPTIONS
 
@@ -707,32 +861,30 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
     if (!field.is_leaf()) {
       return Status::Invalid("Parquet non-leaf node has no children");
     }
+    if (!ctx->IncludesLeaf(field.column_index)) {
+      *out = nullptr;
+      return Status::OK();
+    }
     std::unique_ptr<FileColumnIterator> input(
         ctx->iterator_factory(field.column_index, ctx->reader));
     out->reset(new LeafReader(ctx, field.field, std::move(input)));
   } else if (type_id == ::arrow::Type::LIST) {
-    // We can only read lists-of-lists or structs at the moment
-    auto list_field = field.field;
-    auto child = &field.children[0];
-    while (child->field->type()->id() == ::arrow::Type::LIST) {
-      child = &child->children[0];
-    }
-    if (child->field->type()->id() == ::arrow::Type::STRUCT) {
-      return Status::NotImplemented(
-          "Reading lists of structs from Parquet files "
-          "not yet supported: ",
-          field.field->ToString());
-    }
-    if (!ctx->IncludesLeaf(child->column_index)) {
+    // Elements of the list have a slot once its repeated child is defined
+    std::unique_ptr<ColumnReaderImpl> child_reader;
+    RETURN_NOT_OK(GetReader(field.children[0], field.max_definition_level, ctx,
+                            &child_reader));
+    if (!child_reader) {
+      // All leaves below were pruned
       *out = nullptr;
       return Status::OK();
     }
-    std::unique_ptr<ColumnReaderImpl> child_reader;
-    RETURN_NOT_OK(GetReader(*child, ctx, &child_reader));
-    // Use the max definition/repetition level of the leaf here
-    out->reset(new NestedListReader(ctx, list_field, child->max_definition_level,
-                                    child->max_repetition_level,
-                                    std::move(child_reader)));
+    // The element type may differ from the schema's if struct fields were pruned
+    auto list_field = ::arrow::field(field.field->name(),
+                                     ::arrow::list(child_reader->field()),
+                                     field.field->nullable(), field.field->metadata());
+    out->reset(new ListReader(ctx, list_field,
+                              ComputeLevelInfo(field, repeated_ancestor_def_level),
+                              std::move(child_reader)));
   } else if (type_id == ::arrow::Type::STRUCT) {
     std::vector<std::shared_ptr<Field>> child_fields;
     std::vector<std::unique_ptr<ColumnReaderImpl>> child_readers;
@@ -742,12 +894,12 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
         continue;
       }
       std::unique_ptr<ColumnReaderImpl> child_reader;
-      RETURN_NOT_OK(GetReader(child, ctx, &child_reader));
+      RETURN_NOT_OK(GetReader(child, repeated_ancestor_def_level, ctx, &child_reader));
       if (!child_reader) {
         // If all children were pruned, then we do not try to read this field
         continue;
       }
-      child_fields.push_back(child.field);
+      child_fields.push_back(child_reader->field());
       child_readers.emplace_back(std::move(child_reader));
     }
     if (child_fields.size() == 0) {
@@ -757,7 +909,9 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
     auto filtered_field =
         ::arrow::field(field.field->name(), ::arrow::struct_(child_fields),
                        field.field->nullable(), field.field->metadata());
-    out->reset(new StructReader(ctx, field, filtered_field, std::move(child_readers)));
+    out->reset(new StructReader(ctx, filtered_field,
+                                ComputeLevelInfo(field, repeated_ancestor_def_level),
+                                std::move(child_readers)));
   } else {
     return Status::Invalid("Unsupported nested type: ", field.field->ToString());
   }
@@ -766,6 +920,11 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
   END_PARQUET_CATCH_EXCEPTIONS
 }
 
+Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>& ctx,
+                 std::unique_ptr<ColumnReaderImpl>* out) {
+  return GetReader(field, /*repeated_ancestor_def_level=*/0, ctx, out);
+}
+
 Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_indices,
                                             const std::vector<int>& column_indices,
                                             std::unique_ptr<RecordBatchReader>* out) {
@@ -774,7 +933,8 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_in
     RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
   }
   return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this,
-                                         reader_properties_.batch_size(), out);
+                                         reader_properties_.batch_size(),
+                                         reader_properties_.use_threads(), out);
 }
 
 Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_factory,
@@ -839,6 +999,131 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   END_PARQUET_CATCH_EXCEPTIONS
 }
 
+// Flatten the selection returned by a RowFilter into a single boolean array
+// without nulls
+Status MakeSelection(const ChunkedArray& selection, int64_t num_rows, MemoryPool* pool,
+                     std::shared_ptr<BooleanArray>* out) {
+  if (selection.type()->id() != ::arrow::Type::BOOL) {
+    return Status::TypeError("Row filter must return a boolean selection, got ",
+                             *selection.type());
+  }
+  if (selection.length() != num_rows) {
+    return Status::Invalid("Row filter returned a selection of length ",
+                           selection.length(), " for ", num_rows, " rows");
+  }
+  std::shared_ptr<Array> flat;
+  if (selection.num_chunks() == 1) {
+    flat = selection.chunk(0);
+  } else {
+    RETURN_NOT_OK(::arrow::Concatenate(selection.chunks(), pool, &flat));
+  }
+  const auto& values = checked_cast<const BooleanArray&>(*flat);
+  if (values.null_count() == 0) {
+    *out = std::static_pointer_cast<BooleanArray>(flat);
+    return Status::OK();
+  }
+  // Null means unselected
+  ARROW_ASSIGN_OR_RAISE(
+      auto selected_bits,
+      ::arrow::internal::BitmapAnd(pool, values.values()->data(), values.offset(),
+                                   values.null_bitmap_data(), values.offset(),
+                                   values.length(), /*out_offset=*/0));
+  *out = std::make_shared<BooleanArray>(values.length(), std::move(selected_bits));
+  return Status::OK();
+}
+
+Status FileReaderImpl::ReadRowGroupsFiltered(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+    const std::vector<int>& filter_column_indices, const RowFilter& filter,
+    std::shared_ptr<Table>* out) {
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+
+  if (filter_column_indices.empty()) {
+    return Status::Invalid("No column to filter rows with");
+  }
+  std::vector<int> field_indices;
+  std::vector<int> filter_field_indices;
+  if (!manifest_.GetFieldIndices(column_indices, &field_indices) ||
+      !manifest_.GetFieldIndices(filter_column_indices, &filter_field_indices)) {
+    return Status::Invalid("Invalid column index");
+  }
+
+  const int num_fields = static_cast<int>(field_indices.size());
+  auto included_leaves = VectorToSharedSet(column_indices);
+  std::vector<std::shared_ptr<Field>> fields(num_fields);
+  // Flat fields already read to evaluate the filter are only filtered
+  std::vector<int> filter_table_positions(num_fields, -1);
+  for (int i = 0; i < num_fields; ++i) {
+    std::unique_ptr<ColumnReaderImpl> reader;
+    RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, {}, &reader));
+    fields[i] = reader->field();
+    if (manifest_.schema_fields[field_indices[i]].is_leaf()) {
+      auto it = std::find(filter_field_indices.begin(), filter_field_indices.end(),
+                          field_indices[i]);
+      if (it != filter_field_indices.end()) {
+        filter_table_positions[i] = static_cast<int>(it - filter_field_indices.begin());
+      }
+    }
+  }
+
+  std::vector<::arrow::ArrayVector> chunks(num_fields);
+  for (int row_group : row_groups) {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group));
+    std::shared_ptr<Table> filter_table;
+    RETURN_NOT_OK(ReadRowGroups({row_group}, filter_column_indices, &filter_table));
+    const int64_t num_rows = filter_table->num_rows();
+    if (num_rows == 0) {
+      continue;
+    }
+    std::shared_ptr<ChunkedArray> filter_result;
+    RETURN_NOT_OK(filter(*filter_table, &filter_result));
+    std::shared_ptr<BooleanArray> selection;
+    RETURN_NOT_OK(MakeSelection(*filter_result, num_rows, pool_, &selection));
+    const int64_t num_selected = ::arrow::internal::CountSetBits(
+        selection->values()->data(), selection->offset(), num_rows);
+    if (num_selected == 0) {
+      continue;
+    }
+
+    auto ReadColumnFunc = [&](int i) {
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
+      std::shared_ptr<ChunkedArray> column;
+      if (filter_table_positions[i] >= 0) {
+        column = filter_table->column(filter_table_positions[i]);
+        if (num_selected < num_rows) {
+          std::shared_ptr<ChunkedArray> all_rows = std::move(column);
+          ::arrow::compute::FunctionContext ctx(pool_);
+          RETURN_NOT_OK(::arrow::compute::Filter(&ctx, *all_rows, *selection, &column));
+        }
+      } else {
+        std::unique_ptr<ColumnReaderImpl> reader;
+        RETURN_NOT_OK(
+            GetFieldReader(field_indices[i], included_leaves, {row_group}, &reader));
+        if (num_selected < num_rows) {
+          RETURN_NOT_OK(reader->NextSelectedBatch(*selection, pool_, &column));
+        } else {
+          RETURN_NOT_OK(reader->NextBatch(num_rows, &column));
+        }
+      }
+      chunks[i].insert(chunks[i].end(), column->chunks().begin(),
+                       column->chunks().end());
+      return Status::OK();
+      END_PARQUET_CATCH_EXCEPTIONS
+    };
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        reader_properties_.use_threads(), num_fields, ReadColumnFunc));
+  }
+
+  std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
+  for (int i = 0; i < num_fields; ++i) {
+    columns[i] = std::make_shared<ChunkedArray>(std::move(chunks[i]), fields[i]->type());
+  }
+  auto result_schema = ::arrow::schema(fields, manifest_.schema_metadata);
+  *out = Table::Make(result_schema, columns);
+  return (*out)->Validate();
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
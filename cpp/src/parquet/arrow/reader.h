@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -193,6 +194,27 @@ class PARQUET_EXPORT FileReader {
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Compute the rows to keep from the values of some columns, as a
+  /// boolean selection of the same length (null meaning false).
+  using RowFilter = std::function<::arrow::Status(
+      const ::arrow::Table& filter_columns,
+      std::shared_ptr<::arrow::ChunkedArray>* selection)>;
+
+  /// \brief Read the rows of the given row groups selected by a filter
+  ///
+  /// For each row group, the columns indicated by filter_column_indices are
+  /// read first and passed to `filter`.  The other columns are then only
+  /// materialized for the selected rows: row groups without any selected row
+  /// are not read further, and data pages of flat columns without any selected
+  /// row are skipped without being decompressed.  Columns under a repeated
+  /// node are read entirely then filtered.
+  ///
+  /// NOTE: Experimental API
+  virtual ::arrow::Status ReadRowGroupsFiltered(
+      const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+      const std::vector<int>& filter_column_indices, const RowFilter& filter,
+      std::shared_ptr<::arrow::Table>* out) = 0;
+
   /// \brief Scan file contents with one thread, return number of rows
   virtual ::arrow::Status ScanContents(std::vector<int> columns,
                                        const int32_t column_batch_size,
@@ -335,9 +335,35 @@ struct SchemaTreeContext {
   }
 };
 
-bool IsDictionaryReadSupported(const DataType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+bool IsDictionaryReadSupported(const DataType& type, ParquetType::type physical_type) {
+  // Dictionary pages of BOOLEAN and INT96 columns are always decoded densely
+  if (physical_type == ParquetType::BOOLEAN || physical_type == ParquetType::INT96) {
+    return false;
+  }
+  switch (type.id()) {
+    case ::arrow::Type::INT8:
+    case ::arrow::Type::UINT8:
+    case ::arrow::Type::INT16:
+    case ::arrow::Type::UINT16:
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::UINT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::UINT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+    case ::arrow::Type::DATE32:
+    case ::arrow::Type::DATE64:
+    case ::arrow::Type::TIME32:
+    case ::arrow::Type::TIME64:
+    case ::arrow::Type::TIMESTAMP:
+    case ::arrow::Type::DECIMAL:
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+      return true;
+    default:
+      return false;
+  }
 }
 
 Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_node,
@@ -345,7 +371,7 @@ Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_n
   std::shared_ptr<DataType> storage_type;
   RETURN_NOT_OK(GetPrimitiveType(primitive_node, &storage_type));
   if (ctx->properties.read_dictionary(column_index) &&
-      IsDictionaryReadSupported(*storage_type)) {
+      IsDictionaryReadSupported(*storage_type, primitive_node.physical_type())) {
     *out = ::arrow::dictionary(::arrow::int32(), storage_type);
   } else {
     *out = storage_type;
@@ -612,6 +638,7 @@ Status GetOriginSchema(const std::shared_ptr<const KeyValueMetadata>& metadata,
 }
 
 Status ApplyOriginalMetadata(std::shared_ptr<Field> field, const Field& origin_field,
+                             const ColumnDescriptor* leaf_descr,
                              std::shared_ptr<Field>* out) {
   auto origin_type = origin_field.type();
   if (field->type()->id() == ::arrow::Type::TIMESTAMP) {
@@ -627,8 +654,8 @@ Status ApplyOriginalMetadata(std::shared_ptr<Field> field, const Field& origin_f
     }
   }
   if (origin_type->id() == ::arrow::Type::DICTIONARY &&
-      field->type()->id() != ::arrow::Type::DICTIONARY &&
-      IsDictionaryReadSupported(*field->type())) {
+      field->type()->id() != ::arrow::Type::DICTIONARY && leaf_descr != nullptr &&
+      IsDictionaryReadSupported(*field->type(), leaf_descr->physical_type())) {
     const auto& dict_origin_type =
         static_cast<const ::arrow::DictionaryType&>(*origin_type);
     field = field->WithType(
@@ -691,8 +718,10 @@ Status SchemaManifest::Make(const SchemaDescriptor* schema,
       continue;
     }
     auto origin_field = manifest->origin_schema->field(i);
-    RETURN_NOT_OK(
-        ApplyOriginalMetadata(out_field->field, *origin_field, &out_field->field));
+    const ColumnDescriptor* leaf_descr =
+        out_field->is_leaf() ? schema->Column(out_field->column_index) : nullptr;
+    RETURN_NOT_OK(ApplyOriginalMetadata(out_field->field, *origin_field, leaf_descr,
+                                        &out_field->field));
   }
   return Status::OK();
 }
@@ -881,27 +910,11 @@ Status TransferDate64(RecordReader* reader, MemoryPool* pool,
 }
 
 // ----------------------------------------------------------------------
-// Binary, direct to dictionary-encoded
-
-Status TransferDictionary(RecordReader* reader,
-                          const std::shared_ptr<DataType>& logical_value_type,
-                          std::shared_ptr<ChunkedArray>* out) {
-  auto dict_reader = dynamic_cast<DictionaryRecordReader*>(reader);
-  DCHECK(dict_reader);
-  *out = dict_reader->GetResult();
-  if (!logical_value_type->Equals(*(*out)->type())) {
-    RETURN_NOT_OK((*out)->View(logical_value_type, out));
-  }
-  return Status::OK();
-}
+// Binary
 
 Status TransferBinary(RecordReader* reader,
                       const std::shared_ptr<DataType>& logical_value_type,
                       std::shared_ptr<ChunkedArray>* out) {
-  if (reader->read_dictionary()) {
-    return TransferDictionary(
-        reader, ::arrow::dictionary(::arrow::int32(), logical_value_type), out);
-  }
   auto binary_reader = dynamic_cast<BinaryRecordReader*>(reader);
   DCHECK(binary_reader);
   auto chunks = binary_reader->GetBuilderChunks();
@@ -1131,27 +1144,15 @@ Status ConvertToDecimal128<ByteArrayType>(const Array& array,
   return Status::OK();
 }
 
-/// \brief Convert an Int32 or Int64 array into a Decimal128Array
-/// The parquet spec allows systems to write decimals in int32, int64 if the values are
-/// small enough to fit in less 4 bytes or less than 8 bytes, respectively.
-/// This function implements the conversion from int32 and int64 arrays to decimal arrays.
-template <
-    typename ParquetIntegerType,
-    typename = ::arrow::enable_if_t<std::is_same<ParquetIntegerType, Int32Type>::value ||
-                                    std::is_same<ParquetIntegerType, Int64Type>::value>>
-static Status DecimalIntegerTransfer(RecordReader* reader, MemoryPool* pool,
-                                     const std::shared_ptr<DataType>& type, Datum* out) {
-  DCHECK_EQ(type->id(), ::arrow::Type::DECIMAL);
-
-  const int64_t length = reader->values_written();
-
-  using ElementType = typename ParquetIntegerType::c_type;
+/// \brief Convert int32 or int64 values into the bytes of Decimal128 values
+template <typename ElementType>
+static Status IntegersToDecimalBytes(const ElementType* values, int64_t length,
+                                     const std::shared_ptr<DataType>& type,
+                                     MemoryPool* pool, std::shared_ptr<Buffer>* out) {
   static_assert(std::is_same<ElementType, int32_t>::value ||
                     std::is_same<ElementType, int64_t>::value,
                 "ElementType must be int32_t or int64_t");
 
-  const auto values = reinterpret_cast<const ElementType*>(reader->values());
-
   const auto& decimal_type = static_cast<const ::arrow::Decimal128Type&>(*type);
   const int64_t type_length = decimal_type.byte_width();
 
@@ -1173,6 +1174,59 @@ static Status DecimalIntegerTransfer(RecordReader* reader, MemoryPool* pool,
     // no need to byteswap here because we're sign/zero extending exactly 8 bytes
     out_ptr_view[1] = static_cast<uint64_t>(value < 0 ? -1 : 0);
   }
+  *out = data;
+  return Status::OK();
+}
+
+template <typename ParquetIntegerType>
+static Status IntegerArrayToDecimal128(const Array& array,
+                                       const std::shared_ptr<DataType>& type,
+                                       MemoryPool* pool, std::shared_ptr<Array>* out) {
+  using ElementType = typename ParquetIntegerType::c_type;
+  const auto& int_array = static_cast<const ::arrow::NumericArray<
+      typename ::arrow::CTypeTraits<ElementType>::ArrowType>&>(array);
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(IntegersToDecimalBytes(int_array.raw_values(), int_array.length(), type,
+                                       pool, &data));
+  *out = std::make_shared<::arrow::Decimal128Array>(
+      type, int_array.length(), data, int_array.null_bitmap(), int_array.null_count());
+  return Status::OK();
+}
+
+template <>
+Status ConvertToDecimal128<Int32Type>(const Array& array,
+                                      const std::shared_ptr<DataType>& type,
+                                      MemoryPool* pool, std::shared_ptr<Array>* out) {
+  return IntegerArrayToDecimal128<Int32Type>(array, type, pool, out);
+}
+
+template <>
+Status ConvertToDecimal128<Int64Type>(const Array& array,
+                                      const std::shared_ptr<DataType>& type,
+                                      MemoryPool* pool, std::shared_ptr<Array>* out) {
+  return IntegerArrayToDecimal128<Int64Type>(array, type, pool, out);
+}
+
+/// \brief Convert an Int32 or Int64 array into a Decimal128Array
+/// The parquet spec allows systems to write decimals in int32, int64 if the values are
+/// small enough to fit in less 4 bytes or less than 8 bytes, respectively.
+/// This function implements the conversion from int32 and int64 arrays to decimal arrays.
+template <
+    typename ParquetIntegerType,
+    typename = ::arrow::enable_if_t<std::is_same<ParquetIntegerType, Int32Type>::value ||
+                                    std::is_same<ParquetIntegerType, Int64Type>::value>>
+static Status DecimalIntegerTransfer(RecordReader* reader, MemoryPool* pool,
+                                     const std::shared_ptr<DataType>& type, Datum* out) {
+  DCHECK_EQ(type->id(), ::arrow::Type::DECIMAL);
+
+  const int64_t length = reader->values_written();
+
+  using ElementType = typename ParquetIntegerType::c_type;
+  const auto values = reinterpret_cast<const ElementType*>(reader->values());
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(IntegersToDecimalBytes(values, length, type, pool, &data));
 
   if (reader->nullable_values()) {
     std::shared_ptr<ResizableBuffer> is_valid = reader->ReleaseIsValid();
@@ -1209,6 +1263,110 @@ Status TransferDecimal(RecordReader* reader, MemoryPool* pool,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Direct to dictionary-encoded
+
+template <typename ArrowType, typename ParquetCType>
+Status ConvertDictionaryIntegers(const Array& dictionary,
+                                 const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                                 std::shared_ptr<Array>* out) {
+  using ArrowCType = typename ArrowType::c_type;
+  const int64_t length = dictionary.length();
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(::arrow::AllocateBuffer(pool, length * sizeof(ArrowCType), &data));
+
+  auto values = dictionary.data()->GetValues<ParquetCType>(1);
+  auto out_ptr = reinterpret_cast<ArrowCType*>(data->mutable_data());
+  std::copy(values, values + length, out_ptr);
+  *out = std::make_shared<ArrayType<ArrowType>>(type, length, data);
+  return Status::OK();
+}
+
+// Convert the dictionary values, as read in the Arrow type matching the
+// physical type, to the logical value type
+Status ConvertDictionaryValues(const std::shared_ptr<Array>& dictionary,
+                               const std::shared_ptr<DataType>& value_type,
+                               const ColumnDescriptor* descr, MemoryPool* pool,
+                               std::shared_ptr<Array>* out) {
+  if (dictionary->type()->Equals(*value_type)) {
+    *out = dictionary;
+    return Status::OK();
+  }
+  switch (value_type->id()) {
+    case ::arrow::Type::INT8:
+      return ConvertDictionaryIntegers<::arrow::Int8Type, int32_t>(*dictionary,
+                                                                   value_type, pool, out);
+    case ::arrow::Type::UINT8:
+      return ConvertDictionaryIntegers<::arrow::UInt8Type, int32_t>(
+          *dictionary, value_type, pool, out);
+    case ::arrow::Type::INT16:
+      return ConvertDictionaryIntegers<::arrow::Int16Type, int32_t>(
+          *dictionary, value_type, pool, out);
+    case ::arrow::Type::UINT16:
+      return ConvertDictionaryIntegers<::arrow::UInt16Type, int32_t>(
+          *dictionary, value_type, pool, out);
+    case ::arrow::Type::DATE64: {
+      const int64_t length = dictionary->length();
+      std::shared_ptr<Buffer> data;
+      RETURN_NOT_OK(::arrow::AllocateBuffer(pool, length * sizeof(int64_t), &data));
+      auto values = dictionary->data()->GetValues<int32_t>(1);
+      auto out_ptr = reinterpret_cast<int64_t*>(data->mutable_data());
+      for (int64_t i = 0; i < length; i++) {
+        *out_ptr++ = static_cast<int64_t>(values[i]) * kMillisecondsPerDay;
+      }
+      *out = std::make_shared<::arrow::Date64Array>(value_type, length, data);
+      return Status::OK();
+    }
+    case ::arrow::Type::DECIMAL:
+      switch (descr->physical_type()) {
+        case ::parquet::Type::INT32:
+          return ConvertToDecimal128<Int32Type>(*dictionary, value_type, pool, out);
+        case ::parquet::Type::INT64:
+          return ConvertToDecimal128<Int64Type>(*dictionary, value_type, pool, out);
+        case ::parquet::Type::BYTE_ARRAY:
+          return ConvertToDecimal128<ByteArrayType>(*dictionary, value_type, pool, out);
+        case ::parquet::Type::FIXED_LEN_BYTE_ARRAY:
+          return ConvertToDecimal128<FLBAType>(*dictionary, value_type, pool, out);
+        default:
+          return Status::Invalid(
+              "Physical type for decimal must be int32, int64, byte array, or fixed "
+              "length binary");
+      }
+    default:
+      // Same memory layout, e.g. uint32 stored as int32 or string as binary
+      return dictionary->View(value_type, out);
+  }
+}
+
+Status TransferDictionary(RecordReader* reader,
+                          const std::shared_ptr<DataType>& logical_type,
+                          const ColumnDescriptor* descr, MemoryPool* pool,
+                          std::shared_ptr<ChunkedArray>* out) {
+  auto dict_reader = dynamic_cast<DictionaryRecordReader*>(reader);
+  DCHECK(dict_reader);
+  std::shared_ptr<ChunkedArray> result = dict_reader->GetResult();
+  if (logical_type->Equals(*result->type())) {
+    *out = result;
+    return Status::OK();
+  }
+
+  // Each chunk has its own dictionary (one per dictionary page), convert it
+  // and keep the indices as is
+  const auto& value_type =
+      checked_cast<const ::arrow::DictionaryType&>(*logical_type).value_type();
+  ::arrow::ArrayVector chunks(result->num_chunks());
+  for (int i = 0; i < result->num_chunks(); ++i) {
+    const auto& chunk = checked_cast<const ::arrow::DictionaryArray&>(*result->chunk(i));
+    std::shared_ptr<Array> dictionary;
+    RETURN_NOT_OK(ConvertDictionaryValues(chunk.dictionary(), value_type, descr, pool,
+                                          &dictionary));
+    chunks[i] = std::make_shared<::arrow::DictionaryArray>(logical_type, chunk.indices(),
+                                                           dictionary);
+  }
+  *out = std::make_shared<ChunkedArray>(std::move(chunks), logical_type);
+  return Status::OK();
+}
+
 Status TransferExtension(RecordReader* reader, std::shared_ptr<DataType> value_type,
                          const ColumnDescriptor* descr, MemoryPool* pool, Datum* out) {
   std::shared_ptr<ChunkedArray> result;
@@ -1247,7 +1405,7 @@ Status TransferColumnData(RecordReader* reader, std::shared_ptr<DataType> value_
   std::shared_ptr<ChunkedArray> chunked_result;
   switch (value_type->id()) {
     case ::arrow::Type::DICTIONARY: {
-      RETURN_NOT_OK(TransferDictionary(reader, value_type, &chunked_result));
+      RETURN_NOT_OK(TransferDictionary(reader, value_type, descr, pool, &chunked_result));
       result = chunked_result;
     } break;
     case ::arrow::Type::NA: {
@@ -1344,118 +1502,5 @@ Status TransferColumnData(RecordReader* reader, std::shared_ptr<DataType> value_
   return Status::OK();
 }
 
-Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
-                             std::shared_ptr<Field> field, int16_t max_def_level,
-                             int16_t max_rep_level, const int16_t* def_levels,
-                             const int16_t* rep_levels, int64_t total_levels,
-                             ::arrow::MemoryPool* pool, std::shared_ptr<Array>* out) {
-  // Walk downwards to extract nullability
-  std::vector<std::string> item_names;
-  std::vector<bool> nullable;
-  std::vector<std::shared_ptr<const ::arrow::KeyValueMetadata>> field_metadata;
-  std::vector<std::shared_ptr<::arrow::Int32Builder>> offset_builders;
-  std::vector<std::shared_ptr<::arrow::BooleanBuilder>> valid_bits_builders;
-  nullable.push_back(field->nullable());
-  while (field->type()->num_children() > 0) {
-    if (field->type()->num_children() > 1) {
-      return Status::NotImplemented("Fields with more than one child are not supported.");
-    } else {
-      if (field->type()->id() != ::arrow::Type::LIST) {
-        return Status::NotImplemented("Currently only nesting with Lists is supported.");
-      }
-      field = field->type()->child(0);
-    }
-    item_names.push_back(field->name());
-    offset_builders.emplace_back(
-        std::make_shared<::arrow::Int32Builder>(::arrow::int32(), pool));
-    valid_bits_builders.emplace_back(
-        std::make_shared<::arrow::BooleanBuilder>(::arrow::boolean(), pool));
-    nullable.push_back(field->nullable());
-    field_metadata.push_back(field->metadata());
-  }
-
-  int64_t list_depth = offset_builders.size();
-  // This describes the minimal definition that describes a level that
-  // reflects a value in the primitive values array.
-  int16_t values_def_level = max_def_level;
-  if (nullable[nullable.size() - 1]) {
-    values_def_level--;
-  }
-
-  // The definition levels that are needed so that a list is declared
-  // as empty and not null.
-  std::vector<int16_t> empty_def_level(list_depth);
-  int def_level = 0;
-  for (int i = 0; i < list_depth; i++) {
-    if (nullable[i]) {
-      def_level++;
-    }
-    empty_def_level[i] = static_cast<int16_t>(def_level);
-    def_level++;
-  }
-
-  int32_t values_offset = 0;
-  std::vector<int64_t> null_counts(list_depth, 0);
-  for (int64_t i = 0; i < total_levels; i++) {
-    int16_t rep_level = rep_levels[i];
-    if (rep_level < max_rep_level) {
-      for (int64_t j = rep_level; j < list_depth; j++) {
-        if (j == (list_depth - 1)) {
-          RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-        } else {
-          RETURN_NOT_OK(offset_builders[j]->Append(
-              static_cast<int32_t>(offset_builders[j + 1]->length())));
-        }
-
-        if (((empty_def_level[j] - 1) == def_levels[i]) && (nullable[j])) {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(false));
-          null_counts[j]++;
-          break;
-        } else {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(true));
-          if (empty_def_level[j] == def_levels[i]) {
-            break;
-          }
-        }
-      }
-    }
-    if (def_levels[i] >= values_def_level) {
-      values_offset++;
-    }
-  }
-  // Add the final offset to all lists
-  for (int64_t j = 0; j < list_depth; j++) {
-    if (j == (list_depth - 1)) {
-      RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-    } else {
-      RETURN_NOT_OK(offset_builders[j]->Append(
-          static_cast<int32_t>(offset_builders[j + 1]->length())));
-    }
-  }
-
-  std::vector<std::shared_ptr<Buffer>> offsets;
-  std::vector<std::shared_ptr<Buffer>> valid_bits;
-  std::vector<int64_t> list_lengths;
-  for (int64_t j = 0; j < list_depth; j++) {
-    list_lengths.push_back(offset_builders[j]->length() - 1);
-    std::shared_ptr<Array> array;
-    RETURN_NOT_OK(offset_builders[j]->Finish(&array));
-    offsets.emplace_back(std::static_pointer_cast<Int32Array>(array)->values());
-    RETURN_NOT_OK(valid_bits_builders[j]->Finish(&array));
-    valid_bits.emplace_back(std::static_pointer_cast<BooleanArray>(array)->values());
-  }
-
-  *out = arr;
-
-  // TODO(wesm): Use passed-in field
-  for (int64_t j = list_depth - 1; j >= 0; j--) {
-    auto list_type = ::arrow::list(::arrow::field(item_names[j], (*out)->type(),
-                                                  nullable[j + 1], field_metadata[j]));
-    *out = std::make_shared<::arrow::ListArray>(list_type, list_lengths[j], offsets[j],
-                                                *out, valid_bits[j], null_counts[j]);
-  }
-  return Status::OK();
-}
-
 }  // namespace arrow
 }  // namespace parquet
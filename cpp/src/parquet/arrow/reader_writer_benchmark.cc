@@ -18,6 +18,10 @@
 #include "benchmark/benchmark.h"
 
 #include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
@@ -45,6 +49,8 @@ namespace parquet {
 
 using arrow::FileReader;
 using arrow::WriteTable;
+using schema::GroupNode;
+using schema::NodePtr;
 using schema::PrimitiveNode;
 
 namespace benchmark {
@@ -267,6 +273,190 @@ static void BM_ReadMultipleRowGroups(::benchmark::State& state) {
 
 BENCHMARK(BM_ReadMultipleRowGroups);
 
+// A table of nullable int64 columns, with BENCHMARK_SIZE values in total
+static std::shared_ptr<::arrow::Table> WideTable(int num_columns) {
+  std::vector<int64_t> values(BENCHMARK_SIZE / num_columns, 128);
+  auto column = TableFromVector<Int64Type>(values, true)->column(0);
+
+  std::vector<std::shared_ptr<::arrow::Field>> fields;
+  std::vector<std::shared_ptr<::arrow::ChunkedArray>> columns;
+  for (int i = 0; i < num_columns; i++) {
+    fields.push_back(::arrow::field("column" + std::to_string(i), ::arrow::int64()));
+    columns.push_back(column);
+  }
+  return ::arrow::Table::Make(::arrow::schema(fields), columns);
+}
+
+static void BM_WriteWideTable(::benchmark::State& state) {
+  const bool use_threads = state.range(0) != 0;
+  auto table = WideTable(500);
+  auto arrow_properties =
+      ArrowWriterProperties::Builder().set_use_threads(use_threads)->build();
+
+  while (state.KeepRunning()) {
+    auto output = CreateOutputStream();
+    // Small row groups, so that closing the column chunks weighs in
+    EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output,
+                           table->num_rows() / 20, default_writer_properties(),
+                           arrow_properties));
+  }
+  SetBytesProcessed<true, Int64Type>(state);
+}
+
+BENCHMARK(BM_WriteWideTable)->Arg(false)->Arg(true)->UseRealTime();
+
+static void BM_ReadRecordBatches(::benchmark::State& state) {
+  const bool use_threads = state.range(0) != 0;
+  auto table = WideTable(16);
+  auto output = CreateOutputStream();
+  // This writes 10 RowGroups
+  EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output,
+                         table->num_rows() / 10));
+  PARQUET_ASSIGN_OR_THROW(auto buffer, output->Finish());
+
+  while (state.KeepRunning()) {
+    auto reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    std::unique_ptr<FileReader> arrow_reader;
+    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(), std::move(reader),
+                                 &arrow_reader));
+    arrow_reader->set_use_threads(use_threads);
+
+    std::vector<int> rgs(arrow_reader->num_row_groups());
+    std::iota(rgs.begin(), rgs.end(), 0);
+    std::shared_ptr<::arrow::RecordBatchReader> batch_reader;
+    EXIT_NOT_OK(arrow_reader->GetRecordBatchReader(rgs, &batch_reader));
+
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    do {
+      EXIT_NOT_OK(batch_reader->ReadNext(&batch));
+    } while (batch != nullptr);
+  }
+  SetBytesProcessed<true, Int64Type>(state);
+}
+
+BENCHMARK(BM_ReadRecordBatches)->Arg(false)->Arg(true)->UseRealTime();
+
+// A three-level list of optional `element`s
+static NodePtr ListOf(const std::string& name, NodePtr element) {
+  return GroupNode::Make(name, Repetition::OPTIONAL,
+                         {GroupNode::Make("list", Repetition::REPEATED, {element})},
+                         LogicalType::List());
+}
+
+// list<struct<values: list<int64>>>
+static NodePtr ListOfStructOfList() {
+  auto values = PrimitiveNode::Make("element", Repetition::OPTIONAL, Type::INT64);
+  auto element =
+      GroupNode::Make("element", Repetition::OPTIONAL, {ListOf("values", values)});
+  return ListOf("column", element);
+}
+
+// struct<values: list<int64>>
+static NodePtr StructOfList() {
+  auto values = PrimitiveNode::Make("element", Repetition::OPTIONAL, Type::INT64);
+  return GroupNode::Make("column", Repetition::OPTIONAL, {ListOf("values", values)});
+}
+
+// Generates the levels and values of a single nested column, where each list has
+// kListSize elements and each optional node is null with `null_probability`
+class NestedLevelGenerator {
+ public:
+  static constexpr int kListSize = 4;
+
+  NestedLevelGenerator(const ColumnDescriptor* descr, double null_probability)
+      : null_(null_probability) {
+    for (const schema::Node* node = descr->schema_node().get(); node->parent() != nullptr;
+         node = node->parent()) {
+      path_.insert(path_.begin(), node);
+    }
+  }
+
+  void AppendRow() { Append(0, 0, 0, 0); }
+
+  std::vector<int16_t> def_levels;
+  std::vector<int16_t> rep_levels;
+  std::vector<int64_t> values;
+
+ private:
+  void Append(size_t depth, int16_t def_level, int16_t rep_level,
+              int16_t max_rep_level) {
+    if (depth == path_.size()) {
+      def_levels.push_back(def_level);
+      rep_levels.push_back(rep_level);
+      values.push_back(static_cast<int64_t>(values.size()));
+      return;
+    }
+    const schema::Node* node = path_[depth];
+    if (node->is_repeated()) {
+      for (int i = 0; i < kListSize; ++i) {
+        Append(depth + 1, def_level + 1, i == 0 ? rep_level : max_rep_level + 1,
+               max_rep_level + 1);
+      }
+    } else if (node->is_optional() && null_(rng_)) {
+      def_levels.push_back(def_level);
+      rep_levels.push_back(rep_level);
+    } else {
+      Append(depth + 1, def_level + (node->is_optional() ? 1 : 0), rep_level,
+             max_rep_level);
+    }
+  }
+
+  std::vector<const schema::Node*> path_;
+  std::default_random_engine rng_{42};
+  std::bernoulli_distribution null_;
+};
+
+// Read back a single nested column of about BENCHMARK_SIZE levels, where state.range(0)
+// is the percentage of nulls at each optional level
+static void ReadNestedColumn(NodePtr column, ::benchmark::State& state) {
+  auto root = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, {column}));
+  SchemaDescriptor schema_descr;
+  schema_descr.Init(root);
+  NestedLevelGenerator generator(schema_descr.Column(0), state.range(0) / 100.0);
+  int64_t num_rows = 0;
+  while (generator.def_levels.size() < static_cast<size_t>(BENCHMARK_SIZE)) {
+    generator.AppendRow();
+    ++num_rows;
+  }
+
+  auto output = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(output, root);
+  auto column_writer =
+      static_cast<Int64Writer*>(file_writer->AppendRowGroup()->NextColumn());
+  column_writer->WriteBatch(static_cast<int64_t>(generator.def_levels.size()),
+                            generator.def_levels.data(), generator.rep_levels.data(),
+                            generator.values.data());
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, output->Finish());
+
+  while (state.KeepRunning()) {
+    auto reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    std::unique_ptr<FileReader> arrow_reader;
+    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(), std::move(reader),
+                                 &arrow_reader));
+    std::shared_ptr<::arrow::Table> table;
+    EXIT_NOT_OK(arrow_reader->ReadTable(&table));
+  }
+  state.SetItemsProcessed(state.iterations() * num_rows);
+  state.SetBytesProcessed(state.iterations() * generator.def_levels.size() *
+                          (sizeof(int64_t) + 2 * sizeof(int16_t)));
+}
+
+static void BM_ReadListOfStructOfList(::benchmark::State& state) {
+  ReadNestedColumn(ListOfStructOfList(), state);
+}
+
+BENCHMARK(BM_ReadListOfStructOfList)->Arg(0)->Arg(10)->Arg(50);
+
+static void BM_ReadStructOfList(::benchmark::State& state) {
+  ReadNestedColumn(StructOfList(), state);
+}
+
+BENCHMARK(BM_ReadStructOfList)->Arg(0)->Arg(10)->Arg(50);
+
 }  // namespace benchmark
 
 }  // namespace parquet
@@ -31,6 +31,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/arrow/schema.h"
@@ -491,7 +492,15 @@ class FileWriterImpl : public FileWriter {
       chunk_size = this->properties().max_row_group_length();
     }
 
+    // Encrypting column chunks from several threads isn't supported
+    const bool use_threads = arrow_properties_->use_threads() &&
+                             table.num_columns() > 1 &&
+                             properties().file_encryption_properties() == nullptr;
+
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (use_threads) {
+        return WriteBufferedRowGroup(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -505,6 +514,12 @@ class FileWriterImpl : public FileWriter {
       return Status::OK();
     }
 
+    if (properties().max_row_group_bytes() > 0) {
+      RETURN_NOT_OK_ELSE(WriteSizedRowGroups(table, chunk_size, use_threads),
+                         PARQUET_IGNORE_NOT_OK(Close()));
+      return Status::OK();
+    }
+
     for (int chunk = 0; chunk * chunk_size < table.num_rows(); chunk++) {
       int64_t offset = chunk * chunk_size;
       RETURN_NOT_OK_ELSE(
@@ -514,6 +529,97 @@ class FileWriterImpl : public FileWriter {
     return Status::OK();
   }
 
+  // Write row groups of at most max_rows rows and about max_row_group_bytes
+  // bytes.  Each row group is written in slices, whose length is extrapolated
+  // from the size per row estimated so far to the remaining byte budget, so
+  // that only a few slices are needed per row group.
+  Status WriteSizedRowGroups(const Table& table, int64_t max_rows, bool use_threads) {
+    const int64_t max_bytes = properties().max_row_group_bytes();
+    const int64_t min_slice_rows = std::max<int64_t>(properties().write_batch_size(), 1);
+    int64_t offset = 0;
+    while (offset < table.num_rows()) {
+      RETURN_NOT_OK(NewBufferedRowGroup());
+      int64_t rows = 0;
+      int64_t bytes = 0;
+      while (offset < table.num_rows() && rows < max_rows && bytes < max_bytes) {
+        const int64_t remaining_rows =
+            std::min(max_rows - rows, table.num_rows() - offset);
+        int64_t slice_rows = std::min(min_slice_rows, remaining_rows);
+        if (rows > 0 && bytes > 0) {
+          const double bytes_per_row = static_cast<double>(bytes) / rows;
+          const double budget_rows =
+              static_cast<double>(max_bytes - bytes) / bytes_per_row;
+          slice_rows = budget_rows >= static_cast<double>(remaining_rows)
+                           ? remaining_rows
+                           : std::max(slice_rows, static_cast<int64_t>(budget_rows));
+        }
+        RETURN_NOT_OK(WriteBufferedColumns(table, offset, slice_rows, use_threads));
+        offset += slice_rows;
+        rows += slice_rows;
+        PARQUET_CATCH_NOT_OK(bytes = row_group_writer_->EstimatedTotalBytes());
+      }
+      RETURN_NOT_OK(FinishBufferedColumns(use_threads));
+    }
+    return Status::OK();
+  }
+
+  Status NewBufferedRowGroup() {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    return Status::OK();
+  }
+
+  // Write and finish the column chunks of a row group concurrently.  The pages
+  // are encoded and compressed in memory, and only copied to the sink in column
+  // order once the row group is closed.
+  Status WriteBufferedRowGroup(const Table& table, int64_t offset, int64_t size) {
+    RETURN_NOT_OK(NewBufferedRowGroup());
+    return WriteBufferedColumns(table, offset, size, /*use_threads=*/true,
+                                /*finish_pages=*/true);
+  }
+
+  // Append a slice of the table to all column chunks of the current buffered
+  // row group, committing their last pages if the slice ends the row group
+  Status WriteBufferedColumns(const Table& table, int64_t offset, int64_t size,
+                              bool use_threads, bool finish_pages = false) {
+    auto WriteColumn = [&](int i) {
+      const SchemaField* schema_field = nullptr;
+      RETURN_NOT_OK(schema_manifest_.GetColumnField(i, &schema_field));
+      ColumnWriter* column_writer = nullptr;
+      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(i));
+      if (column_writer == nullptr) {
+        return Status::Invalid("No Parquet column writer for column ", i);
+      }
+
+      // The scratch buffers can't be shared between threads
+      ArrowWriteContext write_context(memory_pool(), arrow_properties_.get());
+      ArrowColumnWriter arrow_writer(&write_context, column_writer, schema_field,
+                                     &schema_manifest_);
+      Status status;
+      PARQUET_CATCH_NOT_OK(status = arrow_writer.Write(*table.column(i), offset, size));
+      RETURN_NOT_OK(status);
+      if (finish_pages) {
+        PARQUET_CATCH_NOT_OK(column_writer->FinishPages());
+      }
+      return Status::OK();
+    };
+    return ::arrow::internal::OptionalParallelFor(use_threads, table.num_columns(),
+                                                  WriteColumn);
+  }
+
+  // Commit the last pages of all column chunks of the current buffered row
+  // group, leaving only their copy to the sink to the row group's Close
+  Status FinishBufferedColumns(bool use_threads) {
+    auto FinishColumn = [&](int i) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->column(i)->FinishPages());
+      return Status::OK();
+    };
+    return ::arrow::internal::OptionalParallelFor(
+        use_threads, row_group_writer_->num_columns(), FinishColumn);
+  }
+
   const WriterProperties& properties() const { return *writer_->properties(); }
 
   ::arrow::MemoryPool* memory_pool() const override {
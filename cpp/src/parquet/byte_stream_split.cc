@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "parquet/byte_stream_split.h"
+
+#include <cstdint>
+
+#include "arrow/util/byte_stream_split.h"
+#include "arrow/util/cpu_info.h"
+#include "parquet/exception.h"
+
+namespace parquet {
+namespace internal {
+
+#define DECLARE_BYTE_STREAM_SPLIT_KERNELS(NAMESPACE)                                  \
+  namespace NAMESPACE {                                                               \
+  void ByteStreamSplitEncodeFloat(const uint8_t* values, int64_t num_values,          \
+                                  uint8_t* out);                                      \
+  void ByteStreamSplitEncodeDouble(const uint8_t* values, int64_t num_values,         \
+                                   uint8_t* out);                                     \
+  void ByteStreamSplitDecodeFloat(const uint8_t* data, int64_t num_values,            \
+                                  int64_t stride, float* out);                        \
+  void ByteStreamSplitDecodeDouble(const uint8_t* data, int64_t num_values,           \
+                                   int64_t stride, double* out);                      \
+  }
+
+#if defined(PARQUET_HAVE_RUNTIME_AVX2)
+DECLARE_BYTE_STREAM_SPLIT_KERNELS(avx2)
+#endif
+#if defined(PARQUET_HAVE_RUNTIME_AVX512)
+DECLARE_BYTE_STREAM_SPLIT_KERNELS(avx512)
+#endif
+
+#undef DECLARE_BYTE_STREAM_SPLIT_KERNELS
+
+namespace {
+
+using ::arrow::internal::CpuInfo;
+
+struct ByteStreamSplitKernels {
+  void (*encode_float)(const uint8_t*, int64_t, uint8_t*);
+  void (*encode_double)(const uint8_t*, int64_t, uint8_t*);
+  void (*decode_float)(const uint8_t*, int64_t, int64_t, float*);
+  void (*decode_double)(const uint8_t*, int64_t, int64_t, double*);
+};
+
+#if defined(PARQUET_HAVE_RUNTIME_AVX2) || defined(PARQUET_HAVE_RUNTIME_AVX512)
+bool CpuSupports(int64_t flags) {
+  return (CpuInfo::GetInstance()->hardware_flags() & flags) == flags;
+}
+#endif
+
+// Return null if the implementation is unavailable
+const ByteStreamSplitKernels* GetImplKernels(ByteStreamSplitImpl impl) {
+  namespace util = ::arrow::util::internal;
+  static const ByteStreamSplitKernels scalar = {
+      &util::ByteStreamSplitEncodeScalar<float>,
+      &util::ByteStreamSplitEncodeScalar<double>,
+      &util::ByteStreamSplitDecodeScalar<float>,
+      &util::ByteStreamSplitDecodeScalar<double>};
+#if defined(ARROW_HAVE_SSE2)
+  static const ByteStreamSplitKernels sse2 = {&util::ByteStreamSplitEncodeSSE2<float>,
+                                              &util::ByteStreamSplitEncodeSSE2<double>,
+                                              &util::ByteStreamSplitDecodeSSE2<float>,
+                                              &util::ByteStreamSplitDecodeSSE2<double>};
+#endif
+#if defined(PARQUET_HAVE_RUNTIME_AVX2)
+  static const ByteStreamSplitKernels avx2 = {
+      &avx2::ByteStreamSplitEncodeFloat, &avx2::ByteStreamSplitEncodeDouble,
+      &avx2::ByteStreamSplitDecodeFloat, &avx2::ByteStreamSplitDecodeDouble};
+#endif
+#if defined(PARQUET_HAVE_RUNTIME_AVX512)
+  static const ByteStreamSplitKernels avx512 = {
+      &avx512::ByteStreamSplitEncodeFloat, &avx512::ByteStreamSplitEncodeDouble,
+      &avx512::ByteStreamSplitDecodeFloat, &avx512::ByteStreamSplitDecodeDouble};
+#endif
+
+  switch (impl) {
+    case ByteStreamSplitImpl::kAuto:
+      for (auto best : {ByteStreamSplitImpl::kAVX512, ByteStreamSplitImpl::kAVX2,
+                        ByteStreamSplitImpl::kSSE2}) {
+        if (const auto* kernels = GetImplKernels(best)) {
+          return kernels;
+        }
+      }
+      return &scalar;
+    case ByteStreamSplitImpl::kScalar:
+      return &scalar;
+    case ByteStreamSplitImpl::kSSE2:
+#if defined(ARROW_HAVE_SSE2)
+      return &sse2;
+#else
+      return nullptr;
+#endif
+    case ByteStreamSplitImpl::kAVX2:
+#if defined(PARQUET_HAVE_RUNTIME_AVX2)
+      if (CpuSupports(CpuInfo::AVX2)) {
+        return &avx2;
+      }
+#endif
+      return nullptr;
+    case ByteStreamSplitImpl::kAVX512:
+#if defined(PARQUET_HAVE_RUNTIME_AVX512)
+      if (CpuSupports(CpuInfo::AVX512)) {
+        return &avx512;
+      }
+#endif
+      return nullptr;
+  }
+  return nullptr;
+}
+
+const ByteStreamSplitKernels& GetKernels(ByteStreamSplitImpl impl) {
+  if (impl == ByteStreamSplitImpl::kAuto) {
+    static const ByteStreamSplitKernels* best = GetImplKernels(impl);
+    return *best;
+  }
+  const auto* kernels = GetImplKernels(impl);
+  if (kernels == nullptr) {
+    throw ParquetException("BYTE_STREAM_SPLIT implementation not available on this CPU");
+  }
+  return *kernels;
+}
+
+}  // namespace
+
+bool IsByteStreamSplitImplAvailable(ByteStreamSplitImpl impl) {
+  return GetImplKernels(impl) != nullptr;
+}
+
+void ByteStreamSplitEncode(const float* values, int64_t num_values, uint8_t* out,
+                           ByteStreamSplitImpl impl) {
+  GetKernels(impl).encode_float(reinterpret_cast<const uint8_t*>(values), num_values,
+                                out);
+}
+
+void ByteStreamSplitEncode(const double* values, int64_t num_values, uint8_t* out,
+                           ByteStreamSplitImpl impl) {
+  GetKernels(impl).encode_double(reinterpret_cast<const uint8_t*>(values), num_values,
+                                 out);
+}
+
+void ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64_t stride,
+                           float* out, ByteStreamSplitImpl impl) {
+  GetKernels(impl).decode_float(data, num_values, stride, out);
+}
+
+void ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64_t stride,
+                           double* out, ByteStreamSplitImpl impl) {
+  GetKernels(impl).decode_double(data, num_values, stride, out);
+}
+
+}  // namespace internal
+}  // namespace parquet
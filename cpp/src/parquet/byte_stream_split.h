@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// BYTE_STREAM_SPLIT encoding and decoding of FLOAT and DOUBLE values.
+//
+// The kernels are vectorized, with implementations for SSE2, AVX2 and
+// AVX-512 selected at runtime depending on the CPU.
+
+#pragma once
+
+#include <cstdint>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+namespace internal {
+
+/// \brief An implementation of the BYTE_STREAM_SPLIT kernels
+enum class ByteStreamSplitImpl {
+  /// The fastest implementation supported by the CPU
+  kAuto,
+  kScalar,
+  kSSE2,
+  kAVX2,
+  kAVX512
+};
+
+/// \brief Whether an implementation was compiled in and is supported by the CPU
+PARQUET_EXPORT
+bool IsByteStreamSplitImplAvailable(ByteStreamSplitImpl impl);
+
+/// \brief Scatter the bytes of `num_values` values into sizeof(T) streams of
+/// `num_values` bytes each.
+///
+/// Requesting an unavailable implementation raises ParquetException.
+PARQUET_EXPORT
+void ByteStreamSplitEncode(const float* values, int64_t num_values, uint8_t* out,
+                           ByteStreamSplitImpl impl = ByteStreamSplitImpl::kAuto);
+PARQUET_EXPORT
+void ByteStreamSplitEncode(const double* values, int64_t num_values, uint8_t* out,
+                           ByteStreamSplitImpl impl = ByteStreamSplitImpl::kAuto);
+
+/// \brief Gather `num_values` values from sizeof(T) streams starting `stride`
+/// bytes apart.
+///
+/// Requesting an unavailable implementation raises ParquetException.
+PARQUET_EXPORT
+void ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64_t stride,
+                           float* out,
+                           ByteStreamSplitImpl impl = ByteStreamSplitImpl::kAuto);
+PARQUET_EXPORT
+void ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64_t stride,
+                           double* out,
+                           ByteStreamSplitImpl impl = ByteStreamSplitImpl::kAuto);
+
+}  // namespace internal
+}  // namespace parquet
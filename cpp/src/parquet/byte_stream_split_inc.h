@@ -0,0 +1,307 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// BYTE_STREAM_SPLIT kernels for AVX2 and AVX-512.  This file is included by
+// one translation unit per instruction set, each compiled with the matching
+// compiler flags and defining PARQUET_IMPL_NAMESPACE to a distinct namespace,
+// so that no template instantiated with the wider instruction set is shared
+// with other translation units.
+//
+// The kernels transpose the bytes of blocks of values as the SSE2 kernels in
+// arrow/util/byte_stream_split.h do, with the lanes of the wider registers
+// permuted so that the values stay in order.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__) || defined(__AVX512BW__)
+#include <immintrin.h>
+#endif
+
+#ifndef PARQUET_IMPL_NAMESPACE
+#error "PARQUET_IMPL_NAMESPACE must be defined"
+#endif
+
+namespace parquet {
+namespace internal {
+namespace PARQUET_IMPL_NAMESPACE {
+
+template <typename T>
+void ByteStreamSplitDecodeScalar(const uint8_t* data, int64_t num_values, int64_t stride,
+                                 T* out) {
+  constexpr size_t kNumStreams = sizeof(T);
+
+  for (int64_t i = 0; i < num_values; ++i) {
+    uint8_t gathered_byte_data[kNumStreams];
+    for (size_t b = 0; b < kNumStreams; ++b) {
+      gathered_byte_data[b] = data[b * stride + i];
+    }
+    std::memcpy(&out[i], gathered_byte_data, kNumStreams);
+  }
+}
+
+#if defined(__AVX2__)
+
+template <typename T>
+void ByteStreamSplitDecodeAVX2(const uint8_t* data, int64_t num_values, int64_t stride,
+                               T* out) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  constexpr size_t kNumStreamsLog2 = (kNumStreams == 8U ? 3U : 2U);
+  constexpr int64_t kBlockSize = sizeof(__m256i);
+
+  const int64_t num_blocks = num_values / kBlockSize;
+  const int64_t num_processed_elements = num_blocks * kBlockSize;
+  ByteStreamSplitDecodeScalar(data + num_processed_elements,
+                              num_values - num_processed_elements, stride,
+                              out + num_processed_elements);
+
+  __m256i stage[kNumStreamsLog2 + 1U][kNumStreams];
+  __m256i out_values[kNumStreams];
+  const size_t half = kNumStreams / 2U;
+  uint8_t* output_data = reinterpret_cast<uint8_t*>(out);
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(&data[i * kBlockSize + j * stride]));
+    }
+    for (size_t step = 0; step < kNumStreamsLog2; ++step) {
+      for (size_t j = 0; j < half; ++j) {
+        stage[step + 1U][j * 2] =
+            _mm256_unpacklo_epi8(stage[step][j], stage[step][half + j]);
+        stage[step + 1U][j * 2 + 1U] =
+            _mm256_unpackhi_epi8(stage[step][j], stage[step][half + j]);
+      }
+    }
+    // The low lanes hold the first half of the values, the high lanes the
+    // second half
+    const __m256i* result = stage[kNumStreamsLog2];
+    for (size_t j = 0; j < half; ++j) {
+      out_values[j] = _mm256_permute2x128_si256(result[j * 2], result[j * 2 + 1U], 0x20);
+      out_values[half + j] =
+          _mm256_permute2x128_si256(result[j * 2], result[j * 2 + 1U], 0x31);
+    }
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(&output_data[(i * kNumStreams + j) * kBlockSize]),
+          out_values[j]);
+    }
+  }
+}
+
+template <typename T>
+void ByteStreamSplitEncodeAVX2(const uint8_t* raw_values, int64_t num_values,
+                               uint8_t* output_buffer_raw) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  constexpr int64_t kBlockSize = sizeof(__m256i);
+
+  const int64_t num_blocks = num_values / kBlockSize;
+  const int64_t num_processed_elements = num_blocks * kBlockSize;
+  for (int64_t i = num_processed_elements; i < num_values; ++i) {
+    for (size_t j = 0U; j < kNumStreams; ++j) {
+      output_buffer_raw[j * num_values + i] = raw_values[i * kNumStreams + j];
+    }
+  }
+
+  __m256i values[kNumStreams];
+  __m256i stage[5][kNumStreams];
+  const size_t half = kNumStreams / 2U;
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      values[j] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+          &raw_values[(i * kNumStreams + j) * kBlockSize]));
+    }
+    // Gather the first half of the values in the low lanes, and the second
+    // half in the high lanes
+    for (size_t j = 0; j < half; ++j) {
+      stage[0][j * 2] = _mm256_permute2x128_si256(values[j], values[half + j], 0x20);
+      stage[0][j * 2 + 1U] =
+          _mm256_permute2x128_si256(values[j], values[half + j], 0x31);
+    }
+    for (size_t step = 0; step < 4; ++step) {
+      for (size_t j = 0; j < half; ++j) {
+        stage[step + 1U][j * 2] =
+            _mm256_unpacklo_epi8(stage[step][j], stage[step][half + j]);
+        stage[step + 1U][j * 2 + 1U] =
+            _mm256_unpackhi_epi8(stage[step][j], stage[step][half + j]);
+      }
+    }
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(&output_buffer_raw[j * num_values + i * kBlockSize]),
+          stage[4][j]);
+    }
+  }
+}
+
+#endif  // __AVX2__
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+// Transpose the 128-bit lanes of four registers: lane j of register i moves to
+// lane i of register j
+inline void TransposeLanes4x4(const __m512i* in, __m512i* out) {
+  // Indices of 64-bit words, 8 to 15 denoting the words of the second operand
+  const __m512i low_lanes = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+  const __m512i high_lanes = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+  const __m512i even_lanes = _mm512_setr_epi64(0, 1, 4, 5, 8, 9, 12, 13);
+  const __m512i odd_lanes = _mm512_setr_epi64(2, 3, 6, 7, 10, 11, 14, 15);
+  const __m512i t0 = _mm512_permutex2var_epi64(in[0], low_lanes, in[1]);
+  const __m512i t1 = _mm512_permutex2var_epi64(in[2], low_lanes, in[3]);
+  const __m512i t2 = _mm512_permutex2var_epi64(in[0], high_lanes, in[1]);
+  const __m512i t3 = _mm512_permutex2var_epi64(in[2], high_lanes, in[3]);
+  out[0] = _mm512_permutex2var_epi64(t0, even_lanes, t1);
+  out[1] = _mm512_permutex2var_epi64(t0, odd_lanes, t1);
+  out[2] = _mm512_permutex2var_epi64(t2, even_lanes, t3);
+  out[3] = _mm512_permutex2var_epi64(t2, odd_lanes, t3);
+}
+
+template <typename T>
+void ByteStreamSplitDecodeAVX512(const uint8_t* data, int64_t num_values, int64_t stride,
+                                 T* out) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  constexpr size_t kNumStreamsLog2 = (kNumStreams == 8U ? 3U : 2U);
+  constexpr size_t kNumGroups = kNumStreams / 4U;
+  constexpr int64_t kBlockSize = sizeof(__m512i);
+
+  const int64_t num_blocks = num_values / kBlockSize;
+  const int64_t num_processed_elements = num_blocks * kBlockSize;
+  ByteStreamSplitDecodeScalar(data + num_processed_elements,
+                              num_values - num_processed_elements, stride,
+                              out + num_processed_elements);
+
+  __m512i stage[kNumStreamsLog2 + 1U][kNumStreams];
+  __m512i out_values[kNumStreams];
+  const size_t half = kNumStreams / 2U;
+  uint8_t* output_data = reinterpret_cast<uint8_t*>(out);
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = _mm512_loadu_si512(&data[i * kBlockSize + j * stride]);
+    }
+    for (size_t step = 0; step < kNumStreamsLog2; ++step) {
+      for (size_t j = 0; j < half; ++j) {
+        stage[step + 1U][j * 2] =
+            _mm512_unpacklo_epi8(stage[step][j], stage[step][half + j]);
+        stage[step + 1U][j * 2 + 1U] =
+            _mm512_unpackhi_epi8(stage[step][j], stage[step][half + j]);
+      }
+    }
+    // Lane l of the registers holds the l-th quarter of the values
+    for (size_t g = 0; g < kNumGroups; ++g) {
+      __m512i transposed[4];
+      TransposeLanes4x4(&stage[kNumStreamsLog2][g * 4], transposed);
+      for (size_t l = 0; l < 4; ++l) {
+        out_values[l * kNumGroups + g] = transposed[l];
+      }
+    }
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      _mm512_storeu_si512(&output_data[(i * kNumStreams + j) * kBlockSize],
+                          out_values[j]);
+    }
+  }
+}
+
+template <typename T>
+void ByteStreamSplitEncodeAVX512(const uint8_t* raw_values, int64_t num_values,
+                                 uint8_t* output_buffer_raw) {
+  constexpr size_t kNumStreams = sizeof(T);
+  static_assert(kNumStreams == 4U || kNumStreams == 8U, "Invalid number of streams.");
+  constexpr size_t kNumGroups = kNumStreams / 4U;
+  constexpr int64_t kBlockSize = sizeof(__m512i);
+
+  const int64_t num_blocks = num_values / kBlockSize;
+  const int64_t num_processed_elements = num_blocks * kBlockSize;
+  for (int64_t i = num_processed_elements; i < num_values; ++i) {
+    for (size_t j = 0U; j < kNumStreams; ++j) {
+      output_buffer_raw[j * num_values + i] = raw_values[i * kNumStreams + j];
+    }
+  }
+
+  __m512i values[kNumStreams];
+  __m512i stage[5][kNumStreams];
+  const size_t half = kNumStreams / 2U;
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      values[j] = _mm512_loadu_si512(&raw_values[(i * kNumStreams + j) * kBlockSize]);
+    }
+    // Gather the l-th quarter of the values in lane l of the registers
+    for (size_t g = 0; g < kNumGroups; ++g) {
+      __m512i quarters[4];
+      for (size_t l = 0; l < 4; ++l) {
+        quarters[l] = values[l * kNumGroups + g];
+      }
+      TransposeLanes4x4(quarters, &stage[0][g * 4]);
+    }
+    for (size_t step = 0; step < 4; ++step) {
+      for (size_t j = 0; j < half; ++j) {
+        stage[step + 1U][j * 2] =
+            _mm512_unpacklo_epi8(stage[step][j], stage[step][half + j]);
+        stage[step + 1U][j * 2 + 1U] =
+            _mm512_unpackhi_epi8(stage[step][j], stage[step][half + j]);
+      }
+    }
+    for (size_t j = 0; j < kNumStreams; ++j) {
+      _mm512_storeu_si512(&output_buffer_raw[j * num_values + i * kBlockSize],
+                          stage[4][j]);
+    }
+  }
+}
+
+#endif  // __AVX512BW__
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#define BYTE_STREAM_SPLIT_ENCODE ByteStreamSplitEncodeAVX512
+#define BYTE_STREAM_SPLIT_DECODE ByteStreamSplitDecodeAVX512
+#else
+#define BYTE_STREAM_SPLIT_ENCODE ByteStreamSplitEncodeAVX2
+#define BYTE_STREAM_SPLIT_DECODE ByteStreamSplitDecodeAVX2
+#endif
+
+void ByteStreamSplitEncodeFloat(const uint8_t* values, int64_t num_values,
+                                uint8_t* out) {
+  BYTE_STREAM_SPLIT_ENCODE<float>(values, num_values, out);
+}
+
+void ByteStreamSplitEncodeDouble(const uint8_t* values, int64_t num_values,
+                                 uint8_t* out) {
+  BYTE_STREAM_SPLIT_ENCODE<double>(values, num_values, out);
+}
+
+void ByteStreamSplitDecodeFloat(const uint8_t* data, int64_t num_values, int64_t stride,
+                                float* out) {
+  BYTE_STREAM_SPLIT_DECODE<float>(data, num_values, stride, out);
+}
+
+void ByteStreamSplitDecodeDouble(const uint8_t* data, int64_t num_values,
+                                 int64_t stride, double* out) {
+  BYTE_STREAM_SPLIT_DECODE<double>(data, num_values, stride, out);
+}
+
+#undef BYTE_STREAM_SPLIT_ENCODE
+#undef BYTE_STREAM_SPLIT_DECODE
+
+}  // namespace PARQUET_IMPL_NAMESPACE
+}  // namespace internal
+}  // namespace parquet
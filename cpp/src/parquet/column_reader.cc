@@ -41,6 +41,7 @@
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/internal_file_decryptor.h"
+#include "parquet/level_conversion.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 #include "parquet/thrift_internal.h"  // IWYU pragma: keep
@@ -183,6 +184,8 @@ class SerializedPageReader : public PageReader {
   // Implement the PageReader interface
   std::shared_ptr<Page> NextPage() override;
 
+  int64_t SkipDataPages(int64_t max_values) override;
+
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
  private:
@@ -191,12 +194,19 @@ class SerializedPageReader : public PageReader {
 
   void InitDecryption();
 
+  // Deserialize the next page header into current_page_header_, return false
+  // at the end of the stream
+  bool ReadPageHeader();
+
   std::shared_ptr<Buffer> DecompressPage(int compressed_len, int uncompressed_len,
                                          const uint8_t* page_buffer);
 
   std::shared_ptr<ArrowInputStream> stream_;
 
   format::PageHeader current_page_header_;
+  // Whether current_page_header_ was read by SkipDataPages() for a page that
+  // couldn't be skipped
+  bool has_buffered_header_ = false;
   std::shared_ptr<Page> current_page_;
 
   // Compression codec to use.
@@ -265,46 +275,89 @@ void SerializedPageReader::UpdateDecryption(const std::shared_ptr<Decryptor>& de
   }
 }
 
-std::shared_ptr<Page> SerializedPageReader::NextPage() {
-  // Loop here because there may be unhandled page types that we skip until
-  // finding a page that we do know what to do with
-
-  while (seen_num_rows_ < total_num_rows_) {
-    uint32_t header_size = 0;
-    uint32_t allowed_page_size = kDefaultPageHeaderSize;
+bool SerializedPageReader::ReadPageHeader() {
+  uint32_t header_size = 0;
+  uint32_t allowed_page_size = kDefaultPageHeaderSize;
+
+  // Page headers can be very large because of page statistics
+  // We try to deserialize a larger buffer progressively
+  // until a maximum allowed header limit
+  while (true) {
+    PARQUET_ASSIGN_OR_THROW(auto view, stream_->Peek(allowed_page_size));
+    if (view.size() == 0) {
+      return false;
+    }
 
-    // Page headers can be very large because of page statistics
-    // We try to deserialize a larger buffer progressively
-    // until a maximum allowed header limit
-    while (true) {
-      PARQUET_ASSIGN_OR_THROW(auto view, stream_->Peek(allowed_page_size));
-      if (view.size() == 0) {
-        return std::shared_ptr<Page>(nullptr);
+    // This gets used, then set by DeserializeThriftMsg
+    header_size = static_cast<uint32_t>(view.size());
+    try {
+      if (crypto_ctx_.meta_decryptor != nullptr) {
+        UpdateDecryption(crypto_ctx_.meta_decryptor, encryption::kDictionaryPageHeader,
+                         data_page_header_aad_);
+      }
+      DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(view.data()), &header_size,
+                           &current_page_header_, crypto_ctx_.meta_decryptor);
+      break;
+    } catch (std::exception& e) {
+      // Failed to deserialize. Double the allowed page header size and try again
+      std::stringstream ss;
+      ss << e.what();
+      allowed_page_size *= 2;
+      if (allowed_page_size > max_page_header_size_) {
+        ss << "Deserializing page header failed.\n";
+        throw ParquetException(ss.str());
       }
+    }
+  }
+  // Advance the stream offset
+  PARQUET_THROW_NOT_OK(stream_->Advance(header_size));
+  return true;
+}
 
-      // This gets used, then set by DeserializeThriftMsg
-      header_size = static_cast<uint32_t>(view.size());
-      try {
-        if (crypto_ctx_.meta_decryptor != nullptr) {
-          UpdateDecryption(crypto_ctx_.meta_decryptor, encryption::kDictionaryPageHeader,
-                           data_page_header_aad_);
-        }
-        DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(view.data()), &header_size,
-                             &current_page_header_, crypto_ctx_.meta_decryptor);
+int64_t SerializedPageReader::SkipDataPages(int64_t max_values) {
+  // The AAD of encrypted pages depends on the page ordinal, keep things simple
+  if (crypto_ctx_.meta_decryptor != nullptr || crypto_ctx_.data_decryptor != nullptr) {
+    return 0;
+  }
+  int64_t values_skipped = 0;
+  while (seen_num_rows_ < total_num_rows_) {
+    if (!has_buffered_header_) {
+      if (!ReadPageHeader()) {
         break;
-      } catch (std::exception& e) {
-        // Failed to deserialize. Double the allowed page header size and try again
-        std::stringstream ss;
-        ss << e.what();
-        allowed_page_size *= 2;
-        if (allowed_page_size > max_page_header_size_) {
-          ss << "Deserializing page header failed.\n";
-          throw ParquetException(ss.str());
-        }
       }
+      // Keep the header for NextPage() if the page can't be skipped
+      has_buffered_header_ = true;
     }
-    // Advance the stream offset
-    PARQUET_THROW_NOT_OK(stream_->Advance(header_size));
+    const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
+    int64_t num_values;
+    if (page_type == PageType::DATA_PAGE) {
+      num_values = current_page_header_.data_page_header.num_values;
+    } else if (page_type == PageType::DATA_PAGE_V2) {
+      num_values = current_page_header_.data_page_header_v2.num_values;
+    } else {
+      break;
+    }
+    if (values_skipped + num_values > max_values) {
+      break;
+    }
+    PARQUET_THROW_NOT_OK(stream_->Advance(current_page_header_.compressed_page_size));
+    has_buffered_header_ = false;
+    ++page_ordinal_;
+    seen_num_rows_ += num_values;
+    values_skipped += num_values;
+  }
+  return values_skipped;
+}
+
+std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  // Loop here because there may be unhandled page types that we skip until
+  // finding a page that we do know what to do with
+
+  while (seen_num_rows_ < total_num_rows_) {
+    if (!has_buffered_header_ && !ReadPageHeader()) {
+      return std::shared_ptr<Page>(nullptr);
+    }
+    has_buffered_header_ = false;
 
     int compressed_len = current_page_header_.compressed_page_size;
     int uncompressed_len = current_page_header_.uncompressed_page_size;
@@ -659,14 +712,12 @@ class ColumnReaderImplBase {
       current_decoder_ = it->second.get();
     } else {
       switch (encoding) {
-        case Encoding::PLAIN: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::PLAIN, descr_);
-          current_decoder_ = decoder.get();
-          decoders_[static_cast<int>(encoding)] = std::move(decoder);
-          break;
-        }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::PLAIN:
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -674,11 +725,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -972,7 +1018,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   using T = typename DType::c_type;
   using BASE = ColumnReaderImplBase<DType>;
   TypedRecordReader(const ColumnDescriptor* descr, MemoryPool* pool) : BASE(descr, pool) {
-    nullable_values_ = internal::HasSpacedValues(descr);
+    leaf_info_ = internal::LevelInfo::ComputeLevelInfo(descr);
+    nullable_values_ = leaf_info_.HasNullableValues();
     at_record_start_ = true;
     records_read_ = 0;
     values_written_ = 0;
@@ -1071,6 +1118,55 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (this->max_rep_level_ > 0) {
+      ParquetException::NYI("skipping records of repeated columns");
+    }
+    // Without repetition levels, every level or value is a record
+    int64_t records_skipped = SkipBufferedRecords(num_records);
+
+    while (records_skipped < num_records) {
+      if (available_values_current_page() == 0) {
+        // Drop the following pages without decompressing them if possible
+        records_skipped += this->pager_->SkipDataPages(num_records - records_skipped);
+        if (records_skipped == num_records) {
+          break;
+        }
+      }
+      if (!this->HasNextInternal()) {
+        break;
+      }
+
+      const int64_t records_remaining = num_records - records_skipped;
+      const int64_t available = available_values_current_page();
+      if (available <= records_remaining) {
+        // Don't bother decoding the levels and values of the rest of the page
+        this->ConsumeBufferedValues(available);
+        records_skipped += available;
+        continue;
+      }
+
+      const int64_t batch_size = std::min(kMinLevelBatchSize, records_remaining);
+      if (this->max_def_level_ > 0) {
+        // Nulls have no values, so the levels must be decoded to know how many
+        // values to skip
+        ReserveLevels(batch_size);
+        const int64_t levels_read =
+            this->ReadDefinitionLevels(batch_size, def_levels() + levels_written_);
+        if (levels_read == 0) {
+          break;
+        }
+        levels_written_ += levels_read;
+        records_skipped += SkipBufferedRecords(records_remaining);
+      } else {
+        SkipValues(batch_size);
+        this->ConsumeBufferedValues(batch_size);
+        records_skipped += batch_size;
+      }
+    }
+    return records_skipped;
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1250,6 +1346,44 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
+  // Skip up to num_records records of a non-repeated column among the
+  // buffered levels, return the number of records skipped
+  int64_t SkipBufferedRecords(int64_t num_records) {
+    const int64_t records_skipped =
+        std::min(levels_written_ - levels_position_, num_records);
+    if (records_skipped == 0) {
+      return 0;
+    }
+    const int16_t* def_levels = this->def_levels() + levels_position_;
+    SkipValues(std::count(def_levels, def_levels + records_skipped,
+                          this->max_def_level_));
+    levels_position_ += records_skipped;
+    this->ConsumeBufferedValues(records_skipped);
+    return records_skipped;
+  }
+
+  // Decode and discard values of the current page
+  void SkipValues(int64_t num_values) {
+    if (num_values == 0) {
+      return;
+    }
+    const int64_t batch_size = std::min(kMinLevelBatchSize, num_values);
+    if (skip_scratch_ == nullptr) {
+      skip_scratch_ = AllocateBuffer(this->pool_);
+    }
+    if (skip_scratch_->size() < batch_size * static_cast<int64_t>(sizeof(T))) {
+      PARQUET_THROW_NOT_OK(skip_scratch_->Resize(batch_size * sizeof(T), false));
+    }
+    T* scratch = reinterpret_cast<T*>(skip_scratch_->mutable_data());
+    while (num_values > 0) {
+      const int64_t values_to_skip = std::min(batch_size, num_values);
+      if (this->ReadValues(values_to_skip, scratch) != values_to_skip) {
+        throw ParquetException("Fewer values in the data page than expected");
+      }
+      num_values -= values_to_skip;
+    }
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(int64_t num_records) {
     // Conservative upper bound
@@ -1276,11 +1410,13 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
 
     int64_t null_count = 0;
     if (nullable_values_) {
+      // Levels below the closest repeated ancestor have no slot; the other
+      // levels denote either a value or a null at some level below it
       int64_t values_with_nulls = 0;
-      internal::DefinitionLevelsToBitmap(
-          def_levels() + start_levels_position, levels_position_ - start_levels_position,
-          this->max_def_level_, this->max_rep_level_, &values_with_nulls, &null_count,
-          valid_bits_->mutable_data(), values_written_);
+      internal::DefRepLevelsToBitmap(
+          def_levels() + start_levels_position, /*rep_levels=*/nullptr,
+          levels_position_ - start_levels_position, leaf_info_,
+          valid_bits_->mutable_data(), values_written_, &values_with_nulls, &null_count);
       values_to_read = values_with_nulls - null_count;
       ReadValuesSpaced(values_with_nulls, null_count);
     } else {
@@ -1344,6 +1480,11 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   T* ValuesHead() {
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
+
+  internal::LevelInfo leaf_info_;
+
+  // Destination of values decoded by SkipRecords()
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1439,12 +1580,16 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
+// Reads dictionary-encoded column chunks as the dictionary page plus int32
+// indices, without materializing the dense values.  A new output chunk is
+// started with each new dictionary.
+template <typename DType>
+class DictionaryRecordReaderImpl : public TypedRecordReader<DType>,
+                                   virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, pool), builder_(pool) {
+  DictionaryRecordReaderImpl(const ColumnDescriptor* descr, ::arrow::MemoryPool* pool)
+      : TypedRecordReader<DType>(descr, pool),
+        builder_(DictionaryValueType(descr), pool) {
     this->read_dictionary_ = true;
   }
 
@@ -1471,7 +1616,7 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       /// If there is a new dictionary, we may need to flush the builder, then
       /// insert the new dictionary values
       FlushBuilder();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       decoder->InsertDictionary(&builder_);
       this->new_dictionary_ = false;
     }
@@ -1479,43 +1624,60 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read - null_count);
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
+  // The Arrow type of the dictionary values, matching the physical type
+  static std::shared_ptr<::arrow::DataType> DictionaryValueType(
+      const ColumnDescriptor* descr) {
+    switch (descr->physical_type()) {
+      case Type::INT32:
+        return ::arrow::int32();
+      case Type::INT64:
+        return ::arrow::int64();
+      case Type::FLOAT:
+        return ::arrow::float32();
+      case Type::DOUBLE:
+        return ::arrow::float64();
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        return ::arrow::fixed_size_binary(descr->type_length());
+      default:
+        return ::arrow::binary();
+    }
+  }
 
-  ::arrow::BinaryDictionary32Builder builder_;
+  typename EncodingTraits<DType>::DictAccumulator builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
@@ -1529,13 +1691,14 @@ void TypedRecordReader<ByteArrayType>::DebugPrintState() {}
 template <>
 void TypedRecordReader<FLBAType>::DebugPrintState() {}
 
-std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor* descr,
-                                                        ::arrow::MemoryPool* pool,
-                                                        bool read_dictionary) {
+template <typename DType, typename DenseRecordReader = TypedRecordReader<DType>>
+std::shared_ptr<RecordReader> MakeTypedRecordReader(const ColumnDescriptor* descr,
+                                                    ::arrow::MemoryPool* pool,
+                                                    bool read_dictionary) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool);
+    return std::make_shared<DictionaryRecordReaderImpl<DType>>(descr, pool);
   } else {
-    return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
+    return std::make_shared<DenseRecordReader>(descr, pool);
   }
 }
 
@@ -1546,19 +1709,21 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, pool);
     case Type::INT32:
-      return std::make_shared<TypedRecordReader<Int32Type>>(descr, pool);
+      return MakeTypedRecordReader<Int32Type>(descr, pool, read_dictionary);
     case Type::INT64:
-      return std::make_shared<TypedRecordReader<Int64Type>>(descr, pool);
+      return MakeTypedRecordReader<Int64Type>(descr, pool, read_dictionary);
     case Type::INT96:
       return std::make_shared<TypedRecordReader<Int96Type>>(descr, pool);
     case Type::FLOAT:
-      return std::make_shared<TypedRecordReader<FloatType>>(descr, pool);
+      return MakeTypedRecordReader<FloatType>(descr, pool, read_dictionary);
     case Type::DOUBLE:
-      return std::make_shared<TypedRecordReader<DoubleType>>(descr, pool);
+      return MakeTypedRecordReader<DoubleType>(descr, pool, read_dictionary);
     case Type::BYTE_ARRAY:
-      return MakeByteArrayRecordReader(descr, pool, read_dictionary);
+      return MakeTypedRecordReader<ByteArrayType, ByteArrayChunkedRecordReader>(
+          descr, pool, read_dictionary);
     case Type::FIXED_LEN_BYTE_ARRAY:
-      return std::make_shared<FLBARecordReader>(descr, pool);
+      return MakeTypedRecordReader<FLBAType, FLBARecordReader>(descr, pool,
+                                                               read_dictionary);
     default: {
       // PARQUET-1481: This can occur if the file is corrupt
       std::stringstream ss;
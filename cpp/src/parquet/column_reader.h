@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "parquet/exception.h"
+#include "parquet/level_conversion.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -109,6 +110,16 @@ class PARQUET_EXPORT PageReader {
   // containing new Page otherwise
   virtual std::shared_ptr<Page> NextPage() = 0;
 
+  /// \brief Skip the next data pages, as long as they hold no more than
+  /// `max_values` values (including nulls) in total, without decompressing
+  /// them.
+  ///
+  /// Skipping stops before any other kind of page.  Implementations may skip
+  /// fewer pages than possible.
+  ///
+  /// \return the number of values skipped
+  virtual int64_t SkipDataPages(int64_t max_values) { return 0; }
+
   virtual void set_max_page_header_size(uint32_t size) = 0;
 };
 
@@ -218,6 +229,13 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Skip the indicated number of records without materializing them.
+  ///
+  /// Data pages entirely made of skipped records are not decompressed nor
+  /// decoded.  Only columns without repeated ancestors are supported.
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
@@ -308,51 +326,13 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Valid for all physical types except BOOLEAN and INT96, the
+/// dictionary values having the Arrow type matching the physical type
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
 };
 
-static inline void DefinitionLevelsToBitmap(
-    const int16_t* def_levels, int64_t num_def_levels, const int16_t max_definition_level,
-    const int16_t max_repetition_level, int64_t* values_read, int64_t* null_count,
-    uint8_t* valid_bits, int64_t valid_bits_offset) {
-  // We assume here that valid_bits is large enough to accommodate the
-  // additional definition levels and the ones that have already been written
-  ::arrow::internal::BitmapWriter valid_bits_writer(valid_bits, valid_bits_offset,
-                                                    num_def_levels);
-
-  // TODO(itaiin): As an interim solution we are splitting the code path here
-  // between repeated+flat column reads, and non-repeated+nested reads.
-  // Those paths need to be merged in the future
-  for (int i = 0; i < num_def_levels; ++i) {
-    if (def_levels[i] == max_definition_level) {
-      valid_bits_writer.Set();
-    } else if (max_repetition_level > 0) {
-      // repetition+flat case
-      if (def_levels[i] == (max_definition_level - 1)) {
-        valid_bits_writer.Clear();
-        *null_count += 1;
-      } else {
-        continue;
-      }
-    } else {
-      // non-repeated+nested case
-      if (def_levels[i] < max_definition_level) {
-        valid_bits_writer.Clear();
-        *null_count += 1;
-      } else {
-        throw ParquetException("definition level exceeds maximum");
-      }
-    }
-
-    valid_bits_writer.Next();
-  }
-  valid_bits_writer.Finish();
-  *values_read = valid_bits_writer.position();
-}
-
 }  // namespace internal
 
 namespace internal {
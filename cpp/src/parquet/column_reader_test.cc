@@ -319,6 +319,54 @@ TEST_F(TestPrimitiveReader, TestInt32FlatRequiredSkip) {
   reader_.reset();
 }
 
+TEST_F(TestPrimitiveReader, TestInt32FlatOptionalSkipRecords) {
+  int levels_per_page = 100;
+  int num_pages = 5;
+  max_def_level_ = 1;
+  max_rep_level_ = 0;
+  NodePtr type = schema::Int32("b", Repetition::OPTIONAL);
+  const ColumnDescriptor descr(type, max_def_level_, max_rep_level_);
+  MakePages<Int32Type>(&descr, num_pages, levels_per_page, def_levels_, rep_levels_,
+                       values_, data_buffer_, pages_, Encoding::PLAIN);
+  auto pager = new test::MockPageReader(pages_);
+  auto reader = internal::RecordReader::Make(&descr);
+  reader->SetPageReader(std::unique_ptr<PageReader>(pager));
+
+  // Check the records read against the records [begin, end) of the column
+  auto CheckRecords = [&](int64_t begin, int64_t end) {
+    ASSERT_EQ(end - begin, reader->values_written());
+    auto values_begin = values_.begin() + std::count(def_levels_.begin(),
+                                                     def_levels_.begin() + begin, 1);
+    const int32_t* read_values = reinterpret_cast<const int32_t*>(reader->values());
+    for (int64_t i = begin; i < end; ++i) {
+      if (def_levels_[i] == 1) {
+        ASSERT_EQ(*values_begin++, read_values[i - begin]) << "at record " << i;
+      }
+    }
+    reader->Reset();
+  };
+
+  ASSERT_EQ(50, reader->ReadRecords(50));
+  ASSERT_NO_FATAL_FAILURE(CheckRecords(0, 50));
+
+  // 1) Skip within the buffered levels
+  ASSERT_EQ(30, reader->SkipRecords(30));
+  // 2) Skip the rest of the buffered levels then whole pages
+  ASSERT_EQ(220, reader->SkipRecords(220));
+  ASSERT_EQ(2, pager->num_skipped_pages());
+  ASSERT_EQ(50, reader->ReadRecords(50));
+  ASSERT_NO_FATAL_FAILURE(CheckRecords(300, 350));
+
+  // 3) Skip part of a page that can't be skipped entirely
+  ASSERT_EQ(70, reader->SkipRecords(70));
+  ASSERT_EQ(2, pager->num_skipped_pages());
+  ASSERT_EQ(80, reader->ReadRecords(100));
+  ASSERT_NO_FATAL_FAILURE(CheckRecords(420, 500));
+
+  // Nothing left to skip at the end of the column chunk
+  ASSERT_EQ(0, reader->SkipRecords(10));
+}
+
 TEST_F(TestPrimitiveReader, TestDictionaryEncodedPages) {
   max_def_level_ = 0;
   max_rep_level_ = 0;
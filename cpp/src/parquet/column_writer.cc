@@ -553,6 +553,7 @@ class ColumnWriterImpl {
         rows_written_(0),
         total_bytes_written_(0),
         total_compressed_bytes_(0),
+        pages_finished_(false),
         closed_(false),
         fallback_(false),
         definition_levels_sink_(allocator_),
@@ -571,6 +572,8 @@ class ColumnWriterImpl {
 
   virtual ~ColumnWriterImpl() = default;
 
+  void FinishPages();
+
   int64_t Close();
 
  protected:
@@ -606,14 +609,14 @@ class ColumnWriterImpl {
 
   // Write multiple definition levels
   void WriteDefinitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_finished_);
     PARQUET_THROW_NOT_OK(
         definition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
 
   // Write multiple repetition levels
   void WriteRepetitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_finished_);
     PARQUET_THROW_NOT_OK(
         repetition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
@@ -659,6 +662,9 @@ class ColumnWriterImpl {
   // Records the current number of compressed bytes in a column
   int64_t total_compressed_bytes_;
 
+  // Flag to check if the buffered values have been committed to pages
+  bool pages_finished_;
+
   // Flag to check if the Writer has been closed
   bool closed_;
 
@@ -852,9 +858,9 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
   }
 }
 
-int64_t ColumnWriterImpl::Close() {
-  if (!closed_) {
-    closed_ = true;
+void ColumnWriterImpl::FinishPages() {
+  if (!pages_finished_) {
+    pages_finished_ = true;
     if (has_dictionary_ && !fallback_) {
       WriteDictionaryPage();
     }
@@ -870,6 +876,13 @@ int64_t ColumnWriterImpl::Close() {
     if (rows_written_ > 0 && chunk_statistics.is_set()) {
       metadata_->SetStatistics(chunk_statistics);
     }
+  }
+}
+
+int64_t ColumnWriterImpl::Close() {
+  if (!closed_) {
+    closed_ = true;
+    FinishPages();
     pager_->Close(has_dictionary_, fallback_);
   }
 
@@ -905,12 +918,54 @@ inline void DoInBatches(int64_t total, int64_t batch_size, Action&& action) {
 
 bool DictionaryDirectWriteSupported(const ::arrow::Array& array) {
   DCHECK_EQ(array.type_id(), ::arrow::Type::DICTIONARY);
-  const ::arrow::DictionaryType& dict_type =
-      static_cast<const ::arrow::DictionaryType&>(*array.type());
-  auto id = dict_type.value_type()->id();
-  return id == ::arrow::Type::BINARY || id == ::arrow::Type::STRING;
+  // Any value type that can be written densely can have its dictionary
+  // inserted into the encoder's dictionary, except null values
+  const auto& dictionary =
+      static_cast<const ::arrow::DictionaryArray&>(array).dictionary();
+  return dictionary->null_count() == 0;
 }
 
+// Stands in for a column writer when serializing the values of an Arrow
+// dictionary with the dense write functions: the values are inserted into the
+// dictionary of the encoder instead of being encoded, and their dictionary
+// indices recorded
+template <typename DType>
+class DictionaryValuesInserter {
+ public:
+  using T = typename DType::c_type;
+
+  DictionaryValuesInserter(TypedColumnWriter<DType>* writer, DictEncoder<DType>* encoder,
+                           TypedStatistics<DType>* statistics, int32_t* out_indices)
+      : writer_(writer),
+        encoder_(encoder),
+        statistics_(statistics),
+        out_indices_(out_indices) {}
+
+  const ColumnDescriptor* descr() const { return writer_->descr(); }
+
+  const WriterProperties* properties() { return writer_->properties(); }
+
+  void WriteBatch(int64_t num_values, const int16_t*, const int16_t*, const T* values) {
+    encoder_->InsertDictionaryValues(values, static_cast<int>(num_values), out_indices_);
+    // TODO(wesm): If some dictionary values are unobserved, then the
+    // statistics will be inaccurate. Do we care enough to fix it?
+    if (statistics_ != nullptr) {
+      statistics_->Update(values, num_values, 0);
+    }
+  }
+
+  void WriteBatchSpaced(int64_t, const int16_t*, const int16_t*, const uint8_t*, int64_t,
+                        const T*) {
+    throw ParquetException("Dictionary values cannot be null");
+  }
+
+ private:
+  TypedColumnWriter<DType>* writer_;
+  DictEncoder<DType>* encoder_;
+  TypedStatistics<DType>* statistics_;
+  int32_t* out_indices_;
+};
+
 Status ConvertDictionaryToDense(const ::arrow::Array& array, MemoryPool* pool,
                                 std::shared_ptr<::arrow::Array>* out) {
   const ::arrow::DictionaryType& dict_type =
@@ -955,6 +1010,8 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
+  void FinishPages() override { ColumnWriterImpl::FinishPages(); }
+
   int64_t Close() override { return ColumnWriterImpl::Close(); }
 
   void WriteBatch(int64_t num_values, const int16_t* def_levels,
@@ -1017,7 +1074,13 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   }
 
   int64_t EstimatedBufferedValueBytes() const override {
-    return current_encoder_->EstimatedDataEncodedSize();
+    int64_t estimated_bytes = current_encoder_->EstimatedDataEncodedSize();
+    if (has_dictionary_ && !fallback_) {
+      // The dictionary page is only written when the column chunk is closed
+      auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
+      estimated_bytes += dict_encoder->dict_encoded_size();
+    }
+    return estimated_bytes;
   }
 
  protected:
@@ -1034,7 +1097,22 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   Status WriteArrowDense(const int16_t* def_levels, const int16_t* rep_levels,
                          int64_t num_levels, const ::arrow::Array& array,
-                         ArrowWriteContext* context);
+                         ArrowWriteContext* context) {
+    return WriteArrowValues(def_levels, rep_levels, num_levels, array, context,
+                            static_cast<TypedColumnWriter<DType>*>(this));
+  }
+
+  // Serialize the values of an Arrow array to the physical type and write
+  // them with `writer`, either this column writer or a DictionaryValuesInserter
+  template <typename ColumnWriterType>
+  Status WriteArrowValues(const int16_t* def_levels, const int16_t* rep_levels,
+                          int64_t num_levels, const ::arrow::Array& array,
+                          ArrowWriteContext* context, ColumnWriterType* writer);
+
+  // Insert the values of an Arrow dictionary into the dictionary of the
+  // encoder, computing the transposition of its indices
+  Status InsertArrowDictionary(const ::arrow::Array& dictionary,
+                               ArrowWriteContext* context);
 
   void WriteDictionaryPage() override {
     // We have to dynamic cast here because of TypedEncoder<Type> as
@@ -1089,10 +1167,12 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::shared_ptr<TypedStats> chunk_statistics_;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
-  // dictionary passed to DictEncoder<T>::PutDictionary so we can check
-  // subsequent array chunks to see either if materialization is required (in
-  // which case we call back to the dense write path)
+  // last dictionary inserted into the encoder so we can check whether
+  // subsequent array chunks have the same dictionary, along with the
+  // transposition of its indices to the encoder's dictionary (empty if the
+  // indices are the same)
   std::shared_ptr<::arrow::Array> preserved_dictionary_;
+  std::vector<int32_t> dictionary_transpose_map_;
 
   int64_t WriteLevels(int64_t num_values, const int16_t* def_levels,
                       const int16_t* rep_levels) {
@@ -1258,15 +1338,16 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
   // - If dictionary encoding is not enabled, convert to densely
   //   encoded and call WriteArrow
   // - Dictionary encoding enabled
-  //   - If this is the first time this is called, then we call
-  //     PutDictionary into the encoder and then PutIndices on each
-  //     chunk. We store the dictionary that was written in
+  //   - If this is the first time this is called, then we insert the
+  //     dictionary values into the encoder and then PutIndices on each
+  //     chunk. We store the dictionary that was inserted in
   //     preserved_dictionary_ so that subsequent calls to this method
-  //     can make sure the dictionary has not changed
-  //   - On subsequent calls, we have to check whether the dictionary
-  //     has changed. If it has, then we trigger the varying
-  //     dictionary path and materialize each chunk and then call
-  //     WriteArrow with that
+  //     can check whether the dictionary has changed
+  //   - On subsequent calls, if the dictionary has changed, then we insert
+  //     the values of the new dictionary into the encoder (new values are
+  //     appended to its dictionary) and transpose the indices onto the
+  //     encoder's dictionary.  If this makes the dictionary page too large,
+  //     fall back to plain encoding and materialize the chunk
   auto WriteDense = [&] {
     std::shared_ptr<::arrow::Array> dense_array;
     RETURN_NOT_OK(
@@ -1290,6 +1371,21 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
   std::shared_ptr<::arrow::Array> dictionary = data.dictionary();
   std::shared_ptr<::arrow::Array> indices = data.indices();
 
+  if (preserved_dictionary_ == nullptr || (dictionary != preserved_dictionary_ &&
+                                           !dictionary->Equals(*preserved_dictionary_))) {
+    // A new dictionary, merge it into the encoder's dictionary
+    const bool is_first_dictionary = dict_encoder->num_entries() == 0;
+    RETURN_NOT_OK(InsertArrowDictionary(*dictionary, ctx));
+    preserved_dictionary_ = dictionary;
+    if (!is_first_dictionary &&
+        dict_encoder->dict_encoded_size() >= properties_->dictionary_pagesize_limit()) {
+      PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
+      return WriteDense();
+    }
+  }
+  const int32_t* transpose_map =
+      dictionary_transpose_map_.empty() ? nullptr : dictionary_transpose_map_.data();
+
   int64_t value_offset = 0;
   auto WriteIndicesChunk = [&](int64_t offset, int64_t batch_size) {
     int64_t batch_num_values = 0;
@@ -1297,33 +1393,39 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
     WriteLevelsSpaced(batch_size, AddIfNotNull(def_levels, offset),
                       AddIfNotNull(rep_levels, offset), &batch_num_values,
                       &batch_num_spaced_values);
-    dict_encoder->PutIndices(*indices->Slice(value_offset, batch_num_spaced_values));
+    dict_encoder->PutIndices(*indices->Slice(value_offset, batch_num_spaced_values),
+                             transpose_map);
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     value_offset += batch_num_spaced_values;
   };
 
-  // Handle seeing dictionary for the first time
-  if (!preserved_dictionary_) {
-    // It's a new dictionary. Call PutDictionary and keep track of it
-    PARQUET_CATCH_NOT_OK(dict_encoder->PutDictionary(*dictionary));
-
-    // TODO(wesm): If some dictionary values are unobserved, then the
-    // statistics will be inaccurate. Do we care enough to fix it?
-    if (page_statistics_ != nullptr) {
-      PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
-    }
-    preserved_dictionary_ = dictionary;
-  } else if (!dictionary->Equals(*preserved_dictionary_)) {
-    // Dictionary has changed
-    PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
-    return WriteDense();
-  }
-
   PARQUET_CATCH_NOT_OK(
       DoInBatches(num_levels, properties_->write_batch_size(), WriteIndicesChunk));
   return Status::OK();
 }
 
+template <typename DType>
+Status TypedColumnWriterImpl<DType>::InsertArrowDictionary(
+    const ::arrow::Array& dictionary, ArrowWriteContext* ctx) {
+  auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
+  dictionary_transpose_map_.resize(static_cast<size_t>(dictionary.length()));
+  DictionaryValuesInserter<DType> inserter(this, dict_encoder, page_statistics_.get(),
+                                           dictionary_transpose_map_.data());
+  // Serialize the dictionary values like dense values, without levels
+  RETURN_NOT_OK(WriteArrowValues(/*def_levels=*/nullptr, /*rep_levels=*/nullptr,
+                                 dictionary.length(), dictionary, ctx, &inserter));
+
+  // Don't transpose the indices if they match the encoder's dictionary
+  bool identity = true;
+  for (size_t i = 0; i < dictionary_transpose_map_.size() && identity; ++i) {
+    identity = dictionary_transpose_map_[i] == static_cast<int32_t>(i);
+  }
+  if (identity) {
+    dictionary_transpose_map_.clear();
+  }
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Direct Arrow write path
 
@@ -1345,11 +1447,10 @@ struct SerializeFunctor {
   }
 };
 
-template <typename ParquetType, typename ArrowType>
+template <typename ParquetType, typename ArrowType, typename ColumnWriterType>
 Status WriteArrowSerialize(const ::arrow::Array& array, int64_t num_levels,
                            const int16_t* def_levels, const int16_t* rep_levels,
-                           ArrowWriteContext* ctx,
-                           TypedColumnWriter<ParquetType>* writer) {
+                           ArrowWriteContext* ctx, ColumnWriterType* writer) {
   using ParquetCType = typename ParquetType::c_type;
   using ArrayType = typename ::arrow::TypeTraits<ArrowType>::ArrayType;
 
@@ -1372,11 +1473,10 @@ Status WriteArrowSerialize(const ::arrow::Array& array, int64_t num_levels,
   return Status::OK();
 }
 
-template <typename ParquetType>
+template <typename ParquetType, typename ColumnWriterType>
 Status WriteArrowZeroCopy(const ::arrow::Array& array, int64_t num_levels,
                           const int16_t* def_levels, const int16_t* rep_levels,
-                          ArrowWriteContext* ctx,
-                          TypedColumnWriter<ParquetType>* writer) {
+                          ArrowWriteContext* ctx, ColumnWriterType* writer) {
   using T = typename ParquetType::c_type;
   const auto& data = static_cast<const ::arrow::PrimitiveArray&>(array);
   const T* values = nullptr;
@@ -1399,12 +1499,12 @@ Status WriteArrowZeroCopy(const ::arrow::Array& array, int64_t num_levels,
 #define WRITE_SERIALIZE_CASE(ArrowEnum, ArrowType, ParquetType)  \
   case ::arrow::Type::ArrowEnum:                                 \
     return WriteArrowSerialize<ParquetType, ::arrow::ArrowType>( \
-        array, num_levels, def_levels, rep_levels, ctx, this);
+        array, num_levels, def_levels, rep_levels, ctx, writer);
 
 #define WRITE_ZERO_COPY_CASE(ArrowEnum, ArrowType, ParquetType)                       \
   case ::arrow::Type::ArrowEnum:                                                      \
     return WriteArrowZeroCopy<ParquetType>(array, num_levels, def_levels, rep_levels, \
-                                           ctx, this);
+                                           ctx, writer);
 
 #define ARROW_UNSUPPORTED()                                          \
   std::stringstream ss;                                              \
@@ -1426,16 +1526,15 @@ struct SerializeFunctor<BooleanType, ::arrow::BooleanType> {
 };
 
 template <>
-Status TypedColumnWriterImpl<BooleanType>::WriteArrowDense(const int16_t* def_levels,
-                                                           const int16_t* rep_levels,
-                                                           int64_t num_levels,
-                                                           const ::arrow::Array& array,
-                                                           ArrowWriteContext* ctx) {
+template <typename ColumnWriterType>
+Status TypedColumnWriterImpl<BooleanType>::WriteArrowValues(
+    const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
+    const ::arrow::Array& array, ArrowWriteContext* ctx, ColumnWriterType* writer) {
   if (array.type_id() != ::arrow::Type::BOOL) {
     ARROW_UNSUPPORTED();
   }
   return WriteArrowSerialize<BooleanType, ::arrow::BooleanType>(
-      array, num_levels, def_levels, rep_levels, ctx, this);
+      array, num_levels, def_levels, rep_levels, ctx, writer);
 }
 
 // ----------------------------------------------------------------------
@@ -1469,14 +1568,14 @@ struct SerializeFunctor<Int32Type, ::arrow::Time32Type> {
 };
 
 template <>
-Status TypedColumnWriterImpl<Int32Type>::WriteArrowDense(const int16_t* def_levels,
-                                                         const int16_t* rep_levels,
-                                                         int64_t num_levels,
-                                                         const ::arrow::Array& array,
-                                                         ArrowWriteContext* ctx) {
+template <typename ColumnWriterType>
+Status TypedColumnWriterImpl<Int32Type>::WriteArrowValues(
+    const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
+    const ::arrow::Array& array, ArrowWriteContext* ctx, ColumnWriterType* writer) {
   switch (array.type()->id()) {
     case ::arrow::Type::NA: {
-      PARQUET_CATCH_NOT_OK(WriteBatch(num_levels, def_levels, rep_levels, nullptr));
+      PARQUET_CATCH_NOT_OK(
+          writer->WriteBatch(num_levels, def_levels, rep_levels, nullptr));
     } break;
       WRITE_SERIALIZE_CASE(INT8, Int8Type, Int32Type)
       WRITE_SERIALIZE_CASE(UINT8, UInt8Type, Int32Type)
@@ -1593,9 +1692,10 @@ struct SerializeFunctor<Int64Type, ::arrow::TimestampType> {
 #undef COERCE_INVALID
 #undef COERCE_MULTIPLY
 
+template <typename ColumnWriterType>
 Status WriteTimestamps(const ::arrow::Array& values, int64_t num_levels,
                        const int16_t* def_levels, const int16_t* rep_levels,
-                       ArrowWriteContext* ctx, TypedColumnWriter<Int64Type>* writer) {
+                       ArrowWriteContext* ctx, ColumnWriterType* writer) {
   const auto& source_type = static_cast<const ::arrow::TimestampType&>(*values.type());
 
   auto WriteCoerce = [&](const ArrowWriterProperties* properties) {
@@ -1640,14 +1740,13 @@ Status WriteTimestamps(const ::arrow::Array& values, int64_t num_levels,
 }
 
 template <>
-Status TypedColumnWriterImpl<Int64Type>::WriteArrowDense(const int16_t* def_levels,
-                                                         const int16_t* rep_levels,
-                                                         int64_t num_levels,
-                                                         const ::arrow::Array& array,
-                                                         ArrowWriteContext* ctx) {
+template <typename ColumnWriterType>
+Status TypedColumnWriterImpl<Int64Type>::WriteArrowValues(
+    const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
+    const ::arrow::Array& array, ArrowWriteContext* ctx, ColumnWriterType* writer) {
   switch (array.type()->id()) {
     case ::arrow::Type::TIMESTAMP:
-      return WriteTimestamps(array, num_levels, def_levels, rep_levels, ctx, this);
+      return WriteTimestamps(array, num_levels, def_levels, rep_levels, ctx, writer);
       WRITE_ZERO_COPY_CASE(INT64, Int64Type, Int64Type)
       WRITE_SERIALIZE_CASE(UINT32, UInt32Type, Int64Type)
       WRITE_SERIALIZE_CASE(UINT64, UInt64Type, Int64Type)
@@ -1658,45 +1757,42 @@ Status TypedColumnWriterImpl<Int64Type>::WriteArrowDense(const int16_t* def_leve
 }
 
 template <>
-Status TypedColumnWriterImpl<Int96Type>::WriteArrowDense(const int16_t* def_levels,
-                                                         const int16_t* rep_levels,
-                                                         int64_t num_levels,
-                                                         const ::arrow::Array& array,
-                                                         ArrowWriteContext* ctx) {
+template <typename ColumnWriterType>
+Status TypedColumnWriterImpl<Int96Type>::WriteArrowValues(
+    const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
+    const ::arrow::Array& array, ArrowWriteContext* ctx, ColumnWriterType* writer) {
   if (array.type_id() != ::arrow::Type::TIMESTAMP) {
     ARROW_UNSUPPORTED();
   }
   return WriteArrowSerialize<Int96Type, ::arrow::TimestampType>(
-      array, num_levels, def_levels, rep_levels, ctx, this);
+      array, num_levels, def_levels, rep_levels, ctx, writer);
 }
 
 // ----------------------------------------------------------------------
 // Floating point types
 
 template <>
-Status TypedColumnWriterImpl<FloatType>::WriteArrowDense(const int16_t* def_levels,
-                                                         const int16_t* rep_levels,
-                                                         int64_t num_levels,
-                                                         const ::arrow::Array& array,
-                                                         ArrowWriteContext* ctx) {
+template <typename ColumnWriterType>
+Status TypedColumnWriterImpl<FloatType>::WriteArrowValues(
+    const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
+    const ::arrow::Array& array, ArrowWriteContext* ctx, ColumnWriterType* writer) {
   if (array.type_id() != ::arrow::Type::FLOAT) {
     ARROW_UNSUPPORTED();
   }
   return WriteArrowZeroCopy<FloatType>(array, num_levels, def_levels, rep_levels, ctx,
-                                       this);
+                                       writer);
 }
 
 template <>
-Status TypedColumnWriterImpl<DoubleType>::WriteArrowDense(const int16_t* def_levels,
-                                                          const int16_t* rep_levels,
-                                                          int64_t num_levels,
-                                                          const ::arrow::Array& array,
-                                                          ArrowWriteContext* ctx) {
+template <typename ColumnWriterType>
+Status TypedColumnWriterImpl<DoubleType>::WriteArrowValues(
+    const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
+    const ::arrow::Array& array, ArrowWriteContext* ctx, ColumnWriterType* writer) {
   if (array.type_id() != ::arrow::Type::DOUBLE) {
     ARROW_UNSUPPORTED();
   }
   return WriteArrowZeroCopy<DoubleType>(array, num_levels, def_levels, rep_levels, ctx,
-                                        this);
+                                        writer);
 }
 
 // ----------------------------------------------------------------------
@@ -1736,6 +1832,34 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
   return Status::OK();
 }
 
+template <>
+struct SerializeFunctor<ByteArrayType, ::arrow::BinaryType> {
+  Status Serialize(const ::arrow::BinaryArray& array, ArrowWriteContext*,
+                   ByteArray* out) {
+    for (int64_t i = 0; i < array.length(); i++) {
+      if (array.IsValid(i)) {
+        out[i] = array.GetView(i);
+      }
+    }
+    return Status::OK();
+  }
+};
+
+// Only used for dictionary values, dense binary arrays are put into the
+// encoder without serialization
+template <>
+template <typename ColumnWriterType>
+Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowValues(
+    const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
+    const ::arrow::Array& array, ArrowWriteContext* ctx, ColumnWriterType* writer) {
+  if (array.type()->id() != ::arrow::Type::BINARY &&
+      array.type()->id() != ::arrow::Type::STRING) {
+    ARROW_UNSUPPORTED();
+  }
+  return WriteArrowSerialize<ByteArrayType, ::arrow::BinaryType>(
+      array, num_levels, def_levels, rep_levels, ctx, writer);
+}
+
 // ----------------------------------------------------------------------
 // Write Arrow to FIXED_LEN_BYTE_ARRAY
 
@@ -1820,11 +1944,10 @@ struct SerializeFunctor<ParquetType, ArrowType, ::arrow::enable_if_decimal<Arrow
 };
 
 template <>
-Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(const int16_t* def_levels,
-                                                        const int16_t* rep_levels,
-                                                        int64_t num_levels,
-                                                        const ::arrow::Array& array,
-                                                        ArrowWriteContext* ctx) {
+template <typename ColumnWriterType>
+Status TypedColumnWriterImpl<FLBAType>::WriteArrowValues(
+    const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
+    const ::arrow::Array& array, ArrowWriteContext* ctx, ColumnWriterType* writer) {
   switch (array.type()->id()) {
     WRITE_SERIALIZE_CASE(FIXED_SIZE_BINARY, FixedSizeBinaryType, FLBAType)
     WRITE_SERIALIZE_CASE(DECIMAL, Decimal128Type, FLBAType)
@@ -115,6 +115,12 @@ class PARQUET_EXPORT ColumnWriter {
                                             std::unique_ptr<PageWriter>,
                                             const WriterProperties* properties);
 
+  /// \brief Commits any buffered values and the dictionary to pages, leaving
+  /// only the column chunk metadata to Close().  No values can be written
+  /// afterwards.  The pages of a buffered row group's columns are kept in
+  /// memory, so those columns can be finished concurrently.
+  virtual void FinishPages() = 0;
+
   /// \brief Closes the ColumnWriter, commits any buffered values to pages.
   /// \return Total size of the column in bytes
   virtual int64_t Close() = 0;
@@ -136,6 +142,9 @@ class PARQUET_EXPORT ColumnWriter {
   /// dictionary pages to the ColumnChunk so far
   virtual int64_t total_bytes_written() const = 0;
 
+  /// \brief Estimated size of the values that are not written to a page yet
+  virtual int64_t EstimatedBufferedValueBytes() const = 0;
+
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
@@ -187,9 +196,6 @@ class TypedColumnWriter : public ColumnWriter {
   virtual void WriteBatchSpaced(int64_t num_values, const int16_t* def_levels,
                                 const int16_t* rep_levels, const uint8_t* valid_bits,
                                 int64_t valid_bits_offset, const T* values) = 0;
-
-  // Estimated size of the values that are not written to a page yet
-  virtual int64_t EstimatedBufferedValueBytes() const = 0;
 };
 
 using BoolWriter = TypedColumnWriter<BooleanType>;
@@ -416,18 +416,6 @@ TYPED_TEST(TestPrimitiveWriter, RequiredBitPacked) {
   this->TestRequiredWithEncoding(Encoding::BIT_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaBinaryPacked) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
-}
-
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaLengthByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
-}
-
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
-}
-
 TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
   this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
 }
@@ -634,6 +622,55 @@ TEST_F(TestNullValuesWriter, OptionalNullValueChunk) {
   ASSERT_EQ(0, this->values_read_);
 }
 
+// Delta encodings, which only apply to integer and byte array columns
+using TestInt64ValuesWriter = TestPrimitiveWriter<Int64Type>;
+using TestByteArrayValuesWriter = TestPrimitiveWriter<ByteArrayType>;
+
+TEST_F(TestNullValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithSettings(Encoding::DELTA_BINARY_PACKED,
+                                 Compression::UNCOMPRESSED, false, true, LARGE_SIZE);
+}
+
+TEST_F(TestInt64ValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithSettings(Encoding::DELTA_BINARY_PACKED,
+                                 Compression::UNCOMPRESSED, false, true, LARGE_SIZE);
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithSettings(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                 Compression::UNCOMPRESSED, false, true, LARGE_SIZE);
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithSettings(Encoding::DELTA_BYTE_ARRAY, Compression::UNCOMPRESSED,
+                                 false, true, LARGE_SIZE);
+}
+
+TEST_F(TestByteArrayValuesWriter, OptionalDeltaByteArray) {
+  // The values of the page exclude the nulls, the decoder must not rely on the
+  // number of levels
+  this->SetUpSchema(Repetition::OPTIONAL);
+  this->GenerateData(SMALL_SIZE);
+  std::vector<int16_t> definition_levels(SMALL_SIZE, 1);
+  for (int i = 0; i < SMALL_SIZE; i += 3) {
+    definition_levels[i] = 0;
+  }
+
+  ColumnProperties column_properties;
+  column_properties.set_encoding(Encoding::DELTA_BYTE_ARRAY);
+  auto writer = this->BuildWriter(SMALL_SIZE, column_properties);
+  writer->WriteBatch(this->values_.size(), definition_levels.data(), nullptr,
+                     this->values_ptr_);
+  writer->Close();
+  ASSERT_EQ(this->metadata_encodings()[0], Encoding::DELTA_BYTE_ARRAY);
+
+  this->ReadColumn();
+  ASSERT_EQ(SMALL_SIZE - (SMALL_SIZE + 2) / 3, this->values_read_);
+  this->values_.resize(this->values_read_);
+  this->values_out_.resize(this->values_read_);
+  ASSERT_EQ(this->values_, this->values_out_);
+}
+
 // PARQUET-764
 // Correct bitpacking for boolean write at non-byte boundaries
 using TestBooleanValuesWriter = TestPrimitiveWriter<BooleanType>;
@@ -653,7 +690,6 @@ TEST_F(TestBooleanValuesWriter, AlternateBooleanValues) {
 
 // PARQUET-979
 // Prevent writing large MIN, MAX stats
-using TestByteArrayValuesWriter = TestPrimitiveWriter<ByteArrayType>;
 TEST_F(TestByteArrayValuesWriter, OmitStats) {
   int min_len = 1024 * 4;
   int max_len = 1024 * 8;
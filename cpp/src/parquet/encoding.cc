@@ -20,15 +20,17 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/stl_allocator.h"
 #include "arrow/util/bit_stream_utils.h"
-#include "arrow/util/byte_stream_split.h"
+#include "arrow/util/bpacking.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
@@ -36,6 +38,7 @@
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
 
+#include "parquet/byte_stream_split.h"
 #include "parquet/exception.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
@@ -514,10 +517,12 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
 
   /// Encode value. Note that this does not actually write any data, just
   /// buffers the value's index to be written later.
-  inline void Put(const T& value);
+  inline void Put(const T& value) { buffered_indices_.push_back(Memoize(value)); }
 
   // Not implemented for other data types
-  inline void PutByteArray(const void* ptr, int32_t length);
+  inline void PutByteArray(const void* ptr, int32_t length) {
+    buffered_indices_.push_back(MemoizeByteArray(ptr, length));
+  }
 
   void Put(const T* src, int num_values) override {
     for (int32_t i = 0; i < num_values; i++) {
@@ -542,11 +547,21 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
   void Put(const arrow::Array& values) override;
   void PutDictionary(const arrow::Array& values) override;
 
+  void InsertDictionaryValues(const T* values, int num_values,
+                              int32_t* out_indices) override {
+    for (int i = 0; i < num_values; ++i) {
+      out_indices[i] = Memoize(values[i]);
+    }
+  }
+
   template <typename ArrowType>
-  void PutIndicesTyped(const arrow::Array& data) {
+  void PutIndicesTyped(const arrow::Array& data, const int32_t* transpose_map) {
     using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
     const auto& indices = checked_cast<const ArrayType&>(data);
     auto values = indices.raw_values();
+    auto map_index = [transpose_map](int64_t index) {
+      return transpose_map ? transpose_map[index] : static_cast<int32_t>(index);
+    };
 
     size_t buffer_position = buffered_indices_.size();
     buffered_indices_.resize(
@@ -556,27 +571,29 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
                                                       indices.offset(), indices.length());
       for (int64_t i = 0; i < indices.length(); ++i) {
         if (valid_bits_reader.IsSet()) {
-          buffered_indices_[buffer_position++] = static_cast<int32_t>(values[i]);
+          buffered_indices_[buffer_position++] = map_index(values[i]);
         }
         valid_bits_reader.Next();
       }
     } else {
       for (int64_t i = 0; i < indices.length(); ++i) {
-        buffered_indices_[buffer_position++] = static_cast<int32_t>(values[i]);
+        buffered_indices_[buffer_position++] = map_index(values[i]);
       }
     }
   }
 
-  void PutIndices(const arrow::Array& data) override {
+  void PutIndices(const arrow::Array& data) override { PutIndices(data, NULLPTR); }
+
+  void PutIndices(const arrow::Array& data, const int32_t* transpose_map) override {
     switch (data.type()->id()) {
       case arrow::Type::INT8:
-        return PutIndicesTyped<arrow::Int8Type>(data);
+        return PutIndicesTyped<arrow::Int8Type>(data, transpose_map);
       case arrow::Type::INT16:
-        return PutIndicesTyped<arrow::Int16Type>(data);
+        return PutIndicesTyped<arrow::Int16Type>(data, transpose_map);
       case arrow::Type::INT32:
-        return PutIndicesTyped<arrow::Int32Type>(data);
+        return PutIndicesTyped<arrow::Int32Type>(data, transpose_map);
       case arrow::Type::INT64:
-        return PutIndicesTyped<arrow::Int64Type>(data);
+        return PutIndicesTyped<arrow::Int64Type>(data, transpose_map);
       default:
         throw ParquetException("Dictionary indices were not signed integer");
     }
@@ -602,6 +619,12 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
   /// Clears all the indices (but leaves the dictionary).
   void ClearIndices() { buffered_indices_.clear(); }
 
+  /// Returns the dictionary index of a value, inserting it if needed
+  inline int32_t Memoize(const T& value);
+
+  // Not implemented for other data types
+  inline int32_t MemoizeByteArray(const void* ptr, int32_t length);
+
   /// Indices that have not yet be written out by WriteIndices().
   ArrowPoolVector<int32_t> buffered_indices_;
 
@@ -640,8 +663,8 @@ void DictEncoderImpl<FLBAType>::WriteDict(uint8_t* buffer) {
 }
 
 template <typename DType>
-inline void DictEncoderImpl<DType>::Put(const T& v) {
-  // Put() implementation for primitive types
+inline int32_t DictEncoderImpl<DType>::Memoize(const T& v) {
+  // Memoize() implementation for primitive types
   auto on_found = [](int32_t memo_index) {};
   auto on_not_found = [this](int32_t memo_index) {
     dict_encoded_size_ += static_cast<int>(sizeof(T));
@@ -649,17 +672,19 @@ inline void DictEncoderImpl<DType>::Put(const T& v) {
 
   int32_t memo_index;
   PARQUET_THROW_NOT_OK(memo_table_.GetOrInsert(v, on_found, on_not_found, &memo_index));
-  buffered_indices_.push_back(memo_index);
+  return memo_index;
 }
 
 template <typename DType>
-inline void DictEncoderImpl<DType>::PutByteArray(const void* ptr, int32_t length) {
+inline int32_t DictEncoderImpl<DType>::MemoizeByteArray(const void* ptr,
+                                                        int32_t length) {
   DCHECK(false);
+  return -1;
 }
 
 template <>
-inline void DictEncoderImpl<ByteArrayType>::PutByteArray(const void* ptr,
-                                                         int32_t length) {
+inline int32_t DictEncoderImpl<ByteArrayType>::MemoizeByteArray(const void* ptr,
+                                                                int32_t length) {
   static const uint8_t empty[] = {0};
 
   auto on_found = [](int32_t memo_index) {};
@@ -672,16 +697,16 @@ inline void DictEncoderImpl<ByteArrayType>::PutByteArray(const void* ptr,
   int32_t memo_index;
   PARQUET_THROW_NOT_OK(
       memo_table_.GetOrInsert(ptr, length, on_found, on_not_found, &memo_index));
-  buffered_indices_.push_back(memo_index);
+  return memo_index;
 }
 
 template <>
-inline void DictEncoderImpl<ByteArrayType>::Put(const ByteArray& val) {
-  return PutByteArray(val.ptr, static_cast<int32_t>(val.len));
+inline int32_t DictEncoderImpl<ByteArrayType>::Memoize(const ByteArray& val) {
+  return MemoizeByteArray(val.ptr, static_cast<int32_t>(val.len));
 }
 
 template <>
-inline void DictEncoderImpl<FLBAType>::Put(const FixedLenByteArray& v) {
+inline int32_t DictEncoderImpl<FLBAType>::Memoize(const FixedLenByteArray& v) {
   static const uint8_t empty[] = {0};
 
   auto on_found = [](int32_t memo_index) {};
@@ -692,7 +717,7 @@ inline void DictEncoderImpl<FLBAType>::Put(const FixedLenByteArray& v) {
   int32_t memo_index;
   PARQUET_THROW_NOT_OK(
       memo_table_.GetOrInsert(ptr, type_length_, on_found, on_not_found, &memo_index));
-  buffered_indices_.push_back(memo_index);
+  return memo_index;
 }
 
 template <>
@@ -858,18 +883,10 @@ int64_t ByteStreamSplitEncoder<DType>::EstimatedDataEncodedSize() {
 
 template <typename DType>
 std::shared_ptr<Buffer> ByteStreamSplitEncoder<DType>::FlushValues() {
-  constexpr size_t num_streams = sizeof(T);
   std::shared_ptr<ResizableBuffer> output_buffer =
       AllocateBuffer(this->memory_pool(), EstimatedDataEncodedSize());
-  uint8_t* output_buffer_raw = output_buffer->mutable_data();
-  const size_t num_values = values_.length();
-  const uint8_t* raw_values = reinterpret_cast<const uint8_t*>(values_.data());
-  for (size_t i = 0; i < num_values; ++i) {
-    for (size_t j = 0U; j < num_streams; ++j) {
-      const uint8_t byte_in_value = raw_values[i * num_streams + j];
-      output_buffer_raw[j * num_values + i] = byte_in_value;
-    }
-  }
+  internal::ByteStreamSplitEncode(values_.data(), values_.length(),
+                                  output_buffer->mutable_data());
   values_.Reset();
   return std::move(output_buffer);
 }
@@ -916,6 +933,393 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   Put(data, num_valid_values);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encoding
+
+// Delta-encoded values are split into blocks of this many deltas, each made of
+// miniblocks bit-packed with their own bit width.  Miniblocks of 32 values
+// keep the packed data of any bit width aligned on 32-bit words, as needed by
+// the unpacking routines of arrow/util/bpacking.h.
+constexpr uint32_t kDeltaBlockSize = 128;
+constexpr uint32_t kDeltaMiniBlocksPerBlock = 4;
+constexpr uint32_t kDeltaValuesPerMiniBlock = kDeltaBlockSize / kDeltaMiniBlocksPerBlock;
+
+// Pack the low `bit_width` bits of each value, least significant bits first,
+// into BytesForBits(num_values * bit_width) bytes of `out`
+template <typename UT>
+void PackBits(const UT* values, int num_values, int bit_width, uint8_t* out) {
+  uint64_t buffered = 0;
+  int buffered_bits = 0;
+  for (int i = 0; i < num_values; ++i) {
+    const uint64_t value = values[i];
+    buffered |= value << buffered_bits;
+    buffered_bits += bit_width;
+    if (buffered_bits >= 64) {
+      const uint64_t word = arrow::BitUtil::ToLittleEndian(buffered);
+      memcpy(out, &word, sizeof(word));
+      out += sizeof(word);
+      buffered_bits -= 64;
+      buffered = buffered_bits == 0 ? 0 : value >> (bit_width - buffered_bits);
+    }
+  }
+  const uint64_t word = arrow::BitUtil::ToLittleEndian(buffered);
+  memcpy(out, &word, static_cast<size_t>(arrow::BitUtil::BytesForBits(buffered_bits)));
+}
+
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool), sink_(pool) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    // Pending deltas are accounted for at their maximum size
+    return kMaxHeaderLength + sink_.length() + kMaxBlockHeaderLength +
+           num_deltas_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* src, int num_values) override;
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    std::shared_ptr<ResizableBuffer> buffer;
+    PARQUET_THROW_NOT_OK(arrow::AllocateResizableBuffer(this->memory_pool(),
+                                                        num_values * sizeof(T), &buffer));
+    int32_t num_valid_values = 0;
+    arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_values);
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    for (int32_t i = 0; i < num_values; i++) {
+      if (valid_bits_reader.IsSet()) {
+        data[num_valid_values++] = src[i];
+      }
+      valid_bits_reader.Next();
+    }
+    Put(data, num_valid_values);
+  }
+
+ private:
+  static constexpr int kMaxHeaderLength =
+      3 * arrow::BitUtil::BitReader::kMaxVlqByteLength +
+      arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64;
+  static constexpr int kMaxBlockHeaderLength =
+      arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64 + kDeltaMiniBlocksPerBlock;
+
+  // Bit-pack the buffered deltas as a block
+  void FlushBlock();
+
+  arrow::BufferBuilder sink_;
+  uint32_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  // Deltas are computed with wrapping unsigned arithmetic, as allowed by the format
+  UT deltas_[kDeltaBlockSize];
+  uint32_t num_deltas_ = 0;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+  if (ARROW_PREDICT_FALSE(static_cast<uint64_t>(total_value_count_) + num_values >
+                          std::numeric_limits<int32_t>::max())) {
+    throw ParquetException("Too many values for a DELTA_BINARY_PACKED page");
+  }
+  int i = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    i = 1;
+  }
+  total_value_count_ += num_values;
+  for (; i < num_values; ++i) {
+    deltas_[num_deltas_++] =
+        static_cast<UT>(static_cast<UT>(src[i]) - static_cast<UT>(current_value_));
+    current_value_ = src[i];
+    if (num_deltas_ == kDeltaBlockSize) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (num_deltas_ == 0) {
+    return;
+  }
+  T min_delta = std::numeric_limits<T>::max();
+  for (uint32_t i = 0; i < num_deltas_; ++i) {
+    min_delta = std::min(min_delta, static_cast<T>(deltas_[i]));
+  }
+  // The packed values are the (non-negative) differences to the minimum delta.
+  // The padding of the last miniblock packs as zeros.
+  const uint32_t num_mini_blocks = static_cast<uint32_t>(
+      arrow::BitUtil::CeilDiv(num_deltas_, kDeltaValuesPerMiniBlock));
+  const uint32_t num_padded = num_mini_blocks * kDeltaValuesPerMiniBlock;
+  for (uint32_t i = 0; i < num_deltas_; ++i) {
+    deltas_[i] = static_cast<UT>(deltas_[i] - static_cast<UT>(min_delta));
+  }
+  std::fill(deltas_ + num_deltas_, deltas_ + num_padded, 0);
+
+  uint8_t bit_widths[kDeltaMiniBlocksPerBlock] = {};
+  int64_t packed_length = 0;
+  for (uint32_t i = 0; i < num_mini_blocks; ++i) {
+    UT max_value = 0;
+    for (uint32_t j = 0; j < kDeltaValuesPerMiniBlock; ++j) {
+      max_value |= deltas_[i * kDeltaValuesPerMiniBlock + j];
+    }
+    bit_widths[i] = static_cast<uint8_t>(arrow::BitUtil::NumRequiredBits(max_value));
+    packed_length += kDeltaValuesPerMiniBlock * bit_widths[i] / 8;
+  }
+
+  // Block header: the minimum delta and the bit width of each miniblock,
+  // including unused ones
+  uint8_t header[kMaxBlockHeaderLength];
+  arrow::BitUtil::BitWriter header_writer(header, kMaxBlockHeaderLength);
+  header_writer.PutZigZagVlqInt(min_delta);
+  for (uint8_t bit_width : bit_widths) {
+    header_writer.PutAligned<uint8_t>(bit_width, 1);
+  }
+  header_writer.Flush();
+
+  PARQUET_THROW_NOT_OK(sink_.Reserve(header_writer.bytes_written() + packed_length));
+  sink_.UnsafeAppend(header, header_writer.bytes_written());
+  uint8_t packed[kDeltaValuesPerMiniBlock * sizeof(UT)];
+  for (uint32_t i = 0; i < num_mini_blocks; ++i) {
+    PackBits(deltas_ + i * kDeltaValuesPerMiniBlock, kDeltaValuesPerMiniBlock,
+             bit_widths[i], packed);
+    sink_.UnsafeAppend(packed, kDeltaValuesPerMiniBlock * bit_widths[i] / 8);
+  }
+  num_deltas_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  uint8_t header[kMaxHeaderLength];
+  arrow::BitUtil::BitWriter header_writer(header, kMaxHeaderLength);
+  header_writer.PutVlqInt(kDeltaBlockSize);
+  header_writer.PutVlqInt(kDeltaMiniBlocksPerBlock);
+  header_writer.PutVlqInt(total_value_count_);
+  header_writer.PutZigZagVlqInt(first_value_);
+  header_writer.Flush();
+
+  const int64_t header_length = header_writer.bytes_written();
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), header_length + sink_.length());
+  memcpy(buffer->mutable_data(), header, header_length);
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + header_length, sink_.data(), sink_.length());
+  }
+  sink_.Reset();
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+  return std::move(buffer);
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const arrow::Array& values) {
+  using ArrayType = arrow::NumericArray<typename EncodingTraits<DType>::ArrowType>;
+  if (values.type_id() != ArrayType::TypeClass::type_id) {
+    std::string type_name = ArrayType::TypeClass::type_name();
+    throw ParquetException("direct put to " + type_name + " from " +
+                           values.type()->ToString() + " not supported");
+  }
+  const auto& data = checked_cast<const ArrayType&>(values);
+  if (data.null_count() == 0) {
+    Put(data.raw_values(), static_cast<int>(data.length()));
+  } else {
+    PutSpaced(data.raw_values(), static_cast<int>(data.length()), data.null_bitmap_data(),
+              data.offset());
+  }
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY encoding
+
+// Put the non-null values of `src` to a BYTE_ARRAY encoder
+void PutValidByteArrays(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                        int64_t valid_bits_offset, TypedEncoder<ByteArrayType>* encoder) {
+  std::vector<ByteArray> valid_values;
+  valid_values.reserve(num_values);
+  arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                  num_values);
+  for (int32_t i = 0; i < num_values; i++) {
+    if (valid_bits_reader.IsSet()) {
+      valid_values.push_back(src[i]);
+    }
+    valid_bits_reader.Next();
+  }
+  encoder->Put(valid_values.data(), static_cast<int>(valid_values.size()));
+}
+
+// Put the non-null values of a BinaryArray to a BYTE_ARRAY encoder
+void PutBinaryArray(const arrow::Array& values, TypedEncoder<ByteArrayType>* encoder) {
+  AssertBinary(values);
+  const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+  std::vector<ByteArray> valid_values;
+  valid_values.reserve(data.length() - data.null_count());
+  for (int64_t i = 0; i < data.length(); i++) {
+    if (data.IsValid(i)) {
+      valid_values.emplace_back(data.GetView(i));
+    }
+  }
+  encoder->Put(valid_values.data(), static_cast<int>(valid_values.size()));
+}
+
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        length_encoder_(nullptr, pool),
+        sink_(pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), lengths->size() + sink_.length());
+    memcpy(buffer->mutable_data(), lengths->data(), lengths->size());
+    if (sink_.length() > 0) {
+      memcpy(buffer->mutable_data() + lengths->size(), sink_.data(), sink_.length());
+    }
+    sink_.Reset();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    int32_t lengths[kDeltaBlockSize];
+    for (int i = 0; i < num_values; i += kDeltaBlockSize) {
+      const int batch_size = std::min(num_values - i, static_cast<int>(kDeltaBlockSize));
+      int64_t batch_bytes = 0;
+      for (int j = 0; j < batch_size; ++j) {
+        lengths[j] = static_cast<int32_t>(src[i + j].len);
+        batch_bytes += src[i + j].len;
+      }
+      length_encoder_.Put(lengths, batch_size);
+      PARQUET_THROW_NOT_OK(sink_.Reserve(batch_bytes));
+      for (int j = 0; j < batch_size; ++j) {
+        sink_.UnsafeAppend(src[i + j].ptr, src[i + j].len);
+      }
+    }
+  }
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PutValidByteArrays(src, num_values, valid_bits, valid_bits_offset, this);
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  arrow::BufferBuilder sink_;
+};
+
+void DeltaLengthByteArrayEncoder::Put(const arrow::Array& values) {
+  PutBinaryArray(values, this);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_BYTE_ARRAY encoding
+
+// Each value is encoded as the length of its common prefix with the previous
+// value, and the remaining suffix.  The prefix lengths are DELTA_BINARY_PACKED
+// and the suffixes DELTA_LENGTH_BYTE_ARRAY encoded.
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer = AllocateBuffer(
+        this->memory_pool(), prefix_lengths->size() + suffixes->size());
+    memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+           suffixes->size());
+    // Prefixes don't span pages
+    last_value_.clear();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    int32_t prefix_lengths[kDeltaBlockSize];
+    ByteArray suffixes[kDeltaBlockSize];
+    for (int i = 0; i < num_values; i += kDeltaBlockSize) {
+      const int batch_size = std::min(num_values - i, static_cast<int>(kDeltaBlockSize));
+      for (int j = 0; j < batch_size; ++j) {
+        const ByteArray& value = src[i + j];
+        const uint32_t max_prefix_length =
+            std::min(value.len, static_cast<uint32_t>(last_value_.size()));
+        uint32_t prefix_length = 0;
+        while (prefix_length < max_prefix_length &&
+               value.ptr[prefix_length] ==
+                   static_cast<uint8_t>(last_value_[prefix_length])) {
+          ++prefix_length;
+        }
+        prefix_lengths[j] = static_cast<int32_t>(prefix_length);
+        suffixes[j] = ByteArray(value.len - prefix_length, value.ptr + prefix_length);
+        // The input values needn't outlive this call, keep a copy of the last one
+        last_value_.replace(prefix_length, std::string::npos,
+                            reinterpret_cast<const char*>(suffixes[j].ptr),
+                            suffixes[j].len);
+      }
+      prefix_length_encoder_.Put(prefix_lengths, batch_size);
+      suffix_encoder_.Put(suffixes, batch_size);
+    }
+  }
+
+  void Put(const arrow::Array& values) override;
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    PutValidByteArrays(src, num_values, valid_bits, valid_bits_offset, this);
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
+void DeltaByteArrayEncoder::Put(const arrow::Array& values) {
+  PutBinaryArray(values, this);
+}
+
 class DecoderImpl : virtual public Decoder {
  public:
   void SetData(int num_values, const uint8_t* data, int len) override {
@@ -1458,6 +1862,20 @@ class PlainFLBADecoder : public PlainDecoder<FLBAType>, virtual public FLBADecod
 // ----------------------------------------------------------------------
 // Dictionary encoding and decoding
 
+// Append dictionary indices to the Arrow dictionary builder of a Parquet type
+template <typename Type>
+Status AppendDictIndices(arrow::ArrayBuilder* builder, const int32_t* indices,
+                         int64_t length, const uint8_t* valid_bytes = NULLPTR) {
+  using Builder = typename EncodingTraits<Type>::DictAccumulator;
+  return checked_cast<Builder*>(builder)->AppendIndices(indices, length, valid_bytes);
+}
+
+template <>
+Status AppendDictIndices<Int96Type>(arrow::ArrayBuilder*, const int32_t*, int64_t,
+                                    const uint8_t*) {
+  return Status::NotImplemented("Dictionary indices of Int96 values");
+}
+
 template <typename Type>
 class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
  public:
@@ -1549,9 +1967,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       bit_reader.Next();
     }
 
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    PARQUET_THROW_NOT_OK(AppendDictIndices<Type>(builder, indices_buffer, num_values,
+                                                 valid_bytes.data()));
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1571,8 +1988,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    PARQUET_THROW_NOT_OK(AppendDictIndices<Type>(builder, indices_buffer, num_values));
     num_values_ -= num_values;
     return num_values;
   }
@@ -1609,8 +2025,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   // memory use in most cases
   std::shared_ptr<ResizableBuffer> byte_array_offsets_;
 
-  // Reusable buffer for decoding dictionary indices to be appended to a
-  // BinaryDictionary32Builder
+  // Reusable buffer for decoding dictionary indices to be appended to an
+  // Arrow dictionary builder
   std::shared_ptr<ResizableBuffer> indices_scratch_space_;
 
   arrow::util::RleDecoder idx_decoder_;
@@ -1837,7 +2253,31 @@ int DictDecoderImpl<Type>::DecodeArrow(
 
 template <typename Type>
 void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+  // Make a primitive array referencing the internal dictionary data
+  const auto& value_type =
+      checked_cast<const arrow::DictionaryType&>(*builder->type()).value_type();
+  auto arr = arrow::MakeArray(
+      arrow::ArrayData::Make(value_type, dictionary_length_, {nullptr, dictionary_}));
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+  PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(*arr));
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("InsertDictionary for Int96 values");
+}
+
+template <>
+void DictDecoderImpl<FLBAType>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  auto fixed_builder =
+      checked_cast<typename EncodingTraits<FLBAType>::DictAccumulator*>(builder);
+
+  // Make a FixedSizeBinaryArray referencing the internal dictionary data
+  auto arr = std::make_shared<arrow::FixedSizeBinaryArray>(
+      arrow::fixed_size_binary(descr_->type_length()), dictionary_length_,
+      byte_array_data_);
+  PARQUET_THROW_NOT_OK(fixed_builder->InsertMemoValues(*arr));
 }
 
 template <>
@@ -2061,10 +2501,55 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
 // ----------------------------------------------------------------------
 // DeltaBitPackDecoder
 
+// Unpack `num_values` values of `bit_width` bits packed by PackBits
+template <typename UT>
+void UnpackBits(const uint8_t* in, int bit_width, int num_values, UT* out) {
+  uint64_t bit_offset = 0;
+  for (int i = 0; i < num_values; ++i) {
+    uint64_t value = 0;
+    int bits_read = 0;
+    while (bits_read < bit_width) {
+      const int shift = static_cast<int>(bit_offset % 8);
+      const int num_bits = std::min(8 - shift, bit_width - bits_read);
+      const uint64_t bits = (in[bit_offset / 8] >> shift) & ((1U << num_bits) - 1);
+      value |= bits << bits_read;
+      bits_read += num_bits;
+      bit_offset += num_bits;
+    }
+    out[i] = static_cast<UT>(value);
+  }
+}
+
+// Unpack whole miniblocks of values of at most 32 bits with the batched
+// routines of arrow/util/bpacking.h
+inline void UnpackMiniBlock(const uint8_t* in, int bit_width, int num_values,
+                            uint32_t* out) {
+  arrow::internal::unpack32(reinterpret_cast<const uint32_t*>(in), out, num_values,
+                            bit_width);
+}
+
+inline void UnpackMiniBlock(const uint8_t* in, int bit_width, int num_values,
+                            uint64_t* out) {
+  if (bit_width > 32) {
+    UnpackBits(in, bit_width, num_values, out);
+    return;
+  }
+  uint32_t unpacked[kDeltaValuesPerMiniBlock];
+  for (int i = 0; i < num_values; i += kDeltaValuesPerMiniBlock) {
+    const int batch_size =
+        std::min(num_values - i, static_cast<int>(kDeltaValuesPerMiniBlock));
+    arrow::internal::unpack32(
+        reinterpret_cast<const uint32_t*>(in + i / 8 * bit_width), unpacked, batch_size,
+        bit_width);
+    std::copy(unpacked, unpacked + batch_size, out + i);
+  }
+}
+
 template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
-  typedef typename DType::c_type T;
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
@@ -2074,117 +2559,245 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
     }
   }
 
+  // The number of values is read from the page header, as `num_values` may
+  // include null slots
   void SetData(int num_values, const uint8_t* data, int len) override {
-    this->num_values_ = num_values;
-    decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    data_ = data;
+    len_ = len;
+    arrow::BitUtil::BitReader reader(data, len);
+    uint32_t total_value_count = 0;
+    if (!reader.GetVlqInt(&values_per_block_) ||
+        !reader.GetVlqInt(&mini_blocks_per_block_) ||
+        !reader.GetVlqInt(&total_value_count) || !reader.GetZigZagVlqInt(&last_value_)) {
+      ParquetException::EofException();
+    }
+    if (mini_blocks_per_block_ == 0 || values_per_block_ % mini_blocks_per_block_ != 0 ||
+        values_per_block_ / mini_blocks_per_block_ % 32 != 0 ||
+        total_value_count > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED header");
+    }
+    values_per_mini_block_ = values_per_block_ / mini_blocks_per_block_;
+    Advance(len - reader.bytes_left());
+
+    num_values_ = static_cast<int>(total_value_count);
+    first_value_pending_ = total_value_count > 0;
+    deltas_remaining_ = total_value_count > 0 ? total_value_count - 1 : 0;
+    bit_widths_.resize(mini_blocks_per_block_);
+    mini_block_idx_ = mini_blocks_per_block_;
+    mini_block_values_.resize(values_per_mini_block_);
+    mini_block_position_ = mini_block_length_ = 0;
   }
 
   int Decode(T* buffer, int max_values) override {
-    return GetInternal(buffer, max_values);
+    max_values = std::min(max_values, num_values_);
+    int i = 0;
+    if (max_values > 0 && first_value_pending_) {
+      buffer[i++] = last_value_;
+      first_value_pending_ = false;
+    }
+    while (i < max_values) {
+      if (mini_block_position_ == mini_block_length_) {
+        LoadMiniBlock();
+      }
+      const int batch_size = std::min(
+          max_values - i, static_cast<int>(mini_block_length_ - mini_block_position_));
+      // Undo the deltas, with wrapping arithmetic
+      const UT min_delta = static_cast<UT>(min_delta_);
+      const UT* deltas = mini_block_values_.data() + mini_block_position_;
+      UT value = static_cast<UT>(last_value_);
+      for (int j = 0; j < batch_size; ++j) {
+        value += min_delta + deltas[j];
+        buffer[i + j] = static_cast<T>(value);
+      }
+      last_value_ = static_cast<T>(value);
+      mini_block_position_ += batch_size;
+      i += batch_size;
+    }
+    num_values_ -= max_values;
+    return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int values_decoded = Decode(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    auto value = values.begin();
+    VisitNullBitmapInline(valid_bits, valid_bits_offset, num_values, null_count,
+                          [&](bool is_valid) {
+                            if (is_valid) {
+                              out->UnsafeAppend(*value++);
+                            } else {
+                              out->UnsafeAppendNull();
+                            }
+                          });
+    return values_decoded;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
+    std::vector<T> values(num_values - null_count);
+    const int values_decoded = Decode(values.data(), num_values - null_count);
+    if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+      ParquetException::EofException();
     }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
-    }
-    return num_values;
-  }
+    auto value = values.begin();
+    VisitNullBitmapInline(valid_bits, valid_bits_offset, num_values, null_count,
+                          [&](bool is_valid) {
+                            if (is_valid) {
+                              PARQUET_THROW_NOT_OK(out->Append(*value++));
+                            } else {
+                              PARQUET_THROW_NOT_OK(out->AppendNull());
+                            }
+                          });
+    return values_decoded;
+  }
+
+  /// \brief The number of bytes following the encoded values, once they have
+  /// all been decoded
+  int bytes_left() const { return len_; }
 
  private:
-  void InitBlock() {
-    // The number of values per block.
-    uint32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
-      ParquetException::EofException();
-    }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
-
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+  void Advance(int num_bytes) {
+    data_ += num_bytes;
+    len_ -= num_bytes;
+  }
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (uint32_t i = 0; i < num_mini_blocks_; ++i) {
-      if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
+  void InitBlock() {
+    arrow::BitUtil::BitReader reader(data_, len_);
+    if (!reader.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
+    for (uint32_t i = 0; i < mini_blocks_per_block_; ++i) {
+      if (!reader.GetAligned<uint8_t>(1, &bit_widths_[i])) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
+    Advance(len_ - reader.bytes_left());
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
-    values_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
-  int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
-      if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
-          InitBlock();
-          buffer[i] = last_value_;
-          continue;
-        }
+  void LoadMiniBlock() {
+    if (mini_block_idx_ == mini_blocks_per_block_) {
+      InitBlock();
+    }
+    const int bit_width = bit_widths_[mini_block_idx_++];
+    if (ARROW_PREDICT_FALSE(bit_width > static_cast<int>(sizeof(T) * 8))) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED bit width");
+    }
+    // Miniblocks are padded to their full size, except possibly the last one
+    // of a truncated page
+    const uint32_t num_values = std::min(values_per_mini_block_, deltas_remaining_);
+    const int mini_block_size = static_cast<int>(values_per_mini_block_ / 8 * bit_width);
+    if (ARROW_PREDICT_TRUE(len_ >= mini_block_size)) {
+      UnpackMiniBlock(data_, bit_width, static_cast<int>(values_per_mini_block_),
+                      mini_block_values_.data());
+      Advance(mini_block_size);
+    } else {
+      if (len_ < arrow::BitUtil::BytesForBits(num_values * bit_width)) {
+        ParquetException::EofException();
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      UnpackBits(data_, bit_width, static_cast<int>(num_values),
+                 mini_block_values_.data());
+      Advance(len_);
     }
-    this->num_values_ -= max_values;
-    return max_values;
+    mini_block_position_ = 0;
+    mini_block_length_ = num_values;
+    deltas_remaining_ -= num_values;
   }
 
   MemoryPool* pool_;
-  arrow::BitUtil::BitReader decoder_;
-  uint32_t values_current_block_;
-  uint32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
-  std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
-
-  int32_t last_value_;
+
+  uint32_t values_per_block_ = 0;
+  uint32_t mini_blocks_per_block_ = 0;
+  uint32_t values_per_mini_block_ = 0;
+  uint32_t deltas_remaining_ = 0;
+
+  // Whether the first value, stored in the page header, is still to be decoded
+  bool first_value_pending_ = false;
+  T last_value_ = 0;
+
+  // The current block
+  T min_delta_ = 0;
+  std::vector<uint8_t> bit_widths_;
+  uint32_t mini_block_idx_ = 0;
+
+  // The unpacked deltas (minus the minimum delta) of the current miniblock
+  ArrowPoolVector<UT> mini_block_values_{::arrow::stl::allocator<UT>(pool_)};
+  uint32_t mini_block_position_ = 0;
+  uint32_t mini_block_length_ = 0;
 };
 
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
+// Append the values decoded by a BYTE_ARRAY decoder to an Arrow accumulator,
+// with nulls at the unset bits of `valid_bits`
+Status DecodeByteArraysSpaced(TypedDecoder<ByteArrayType>* decoder, int num_values,
+                              int null_count, const uint8_t* valid_bits,
+                              int64_t valid_bits_offset,
+                              typename EncodingTraits<ByteArrayType>::Accumulator* out,
+                              int* out_values_decoded) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int values_decoded = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+
+  ArrowBinaryHelper helper(out);
+  RETURN_NOT_OK(helper.builder->Reserve(num_values));
+  int i = 0;
+  auto value = values.begin();
+  RETURN_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count, [&](bool is_valid) {
+        if (is_valid) {
+          if (ARROW_PREDICT_FALSE(!helper.CanFit(value->len))) {
+            // This element would exceed the capacity of a chunk
+            RETURN_NOT_OK(helper.PushChunk());
+            RETURN_NOT_OK(helper.builder->Reserve(num_values - i));
+          }
+          RETURN_NOT_OK(helper.Append(value->ptr, static_cast<int32_t>(value->len)));
+          ++value;
+        } else {
+          RETURN_NOT_OK(helper.AppendNull());
+        }
+        ++i;
+        return Status::OK();
+      }));
+  *out_values_decoded = values_decoded;
+  return Status::OK();
+}
+
+Status DecodeByteArraysSpaced(
+    TypedDecoder<ByteArrayType>* decoder, int num_values, int null_count,
+    const uint8_t* valid_bits, int64_t valid_bits_offset,
+    typename EncodingTraits<ByteArrayType>::DictAccumulator* out,
+    int* out_values_decoded) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int values_decoded = decoder->Decode(values.data(), num_values - null_count);
+  if (ARROW_PREDICT_FALSE(values_decoded != num_values - null_count)) {
+    ParquetException::EofException();
+  }
+
+  RETURN_NOT_OK(out->Reserve(num_values));
+  auto value = values.begin();
+  RETURN_NOT_OK(VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count, [&](bool is_valid) {
+        if (is_valid) {
+          RETURN_NOT_OK(out->Append(value->ptr, static_cast<int32_t>(value->len)));
+          ++value;
+          return Status::OK();
+        }
+        return out->AppendNull();
+      }));
+  *out_values_decoded = values_decoded;
+  return Status::OK();
+}
+
 class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                     virtual public TypedDecoder<ByteArrayType> {
  public:
@@ -2192,48 +2805,59 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
 
+  // The lengths of all the values are decoded upfront, to locate the values
+  // following them
   void SetData(int num_values, const uint8_t* data, int len) override {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    len_decoder_.SetData(num_values, data, len);
+    num_values_ = len_decoder_.values_left();
+    lengths_.resize(num_values_);
+    len_decoder_.Decode(lengths_.data(), num_values_);
+    const int lengths_size = len - len_decoder_.bytes_left();
+    data_ = data + lengths_size;
+    len_ = len - lengths_size;
+    length_idx_ = 0;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
     max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths_[length_idx_++];
+      if (ARROW_PREDICT_FALSE(length < 0 || length > len_)) {
+        ParquetException::EofException();
+      }
+      buffer[i].len = static_cast<uint32_t>(length);
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += length;
+      len_ -= length;
     }
-    this->num_values_ -= max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeByteArraysSpaced(this, num_values, null_count, valid_bits,
+                                                valid_bits_offset, out, &result));
+    return result;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeByteArraysSpaced(this, num_values, null_count, valid_bits,
+                                                valid_bits_offset, out, &result));
+    return result;
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> lengths_;
+  int length_idx_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2245,48 +2869,88 @@ class DeltaByteArrayDecoder : public DecoderImpl,
   explicit DeltaByteArrayDecoder(const ColumnDescriptor* descr,
                                  MemoryPool* pool = arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
+        pool_(pool),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        values_(pool) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
-
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+  // The values of the page are reassembled upfront into a buffer owned by the
+  // decoder, which the decoded ByteArrays point to until the next call
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    prefix_len_decoder_.SetData(num_values, data, len);
+    num_values_ = prefix_len_decoder_.values_left();
+    ArrowPoolVector<int32_t> prefix_lengths(num_values_,
+                                            ::arrow::stl::allocator<int32_t>(pool_));
+    prefix_len_decoder_.Decode(prefix_lengths.data(), num_values_);
+    const int prefix_lengths_size = len - prefix_len_decoder_.bytes_left();
+    suffix_decoder_.SetData(num_values_, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+
+    std::vector<ByteArray> suffixes(num_values_);
+    if (suffix_decoder_.Decode(suffixes.data(), num_values_) != num_values_) {
+      ParquetException::EofException();
+    }
+    int64_t total_length = 0;
+    for (int i = 0; i < num_values_; ++i) {
+      total_length += prefix_lengths[i] + static_cast<int64_t>(suffixes[i].len);
+    }
+    values_.Reset();
+    PARQUET_THROW_NOT_OK(values_.Reserve(total_length));
+    offsets_.resize(num_values_ + 1);
+    offsets_[0] = 0;
+    int64_t last_value_offset = 0;
+    for (int i = 0; i < num_values_; ++i) {
+      // The prefix is shared with the previous value
+      const int32_t prefix_length = prefix_lengths[i];
+      if (ARROW_PREDICT_FALSE(prefix_length < 0 ||
+                              prefix_length > offsets_[i] - last_value_offset)) {
+        throw ParquetException("Invalid DELTA_BYTE_ARRAY prefix length");
+      }
+      // The builder's capacity was reserved, its data doesn't move
+      values_.UnsafeAppend(values_.data() + last_value_offset, prefix_length);
+      values_.UnsafeAppend(suffixes[i].ptr, suffixes[i].len);
+      last_value_offset = offsets_[i];
+      offsets_[i + 1] = values_.length();
+    }
+    value_idx_ = 0;
+  }
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    for (int i = 0; i < max_values; ++i, ++value_idx_) {
+      buffer[i].ptr = values_.data() + offsets_[value_idx_];
+      buffer[i].len =
+          static_cast<uint32_t>(offsets_[value_idx_ + 1] - offsets_[value_idx_]);
     }
-    this->num_values_ -= max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeByteArraysSpaced(this, num_values, null_count, valid_bits,
+                                                valid_bits_offset, out, &result));
+    return result;
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    int result = 0;
+    PARQUET_THROW_NOT_OK(DecodeByteArraysSpaced(this, num_values, null_count, valid_bits,
+                                                valid_bits_offset, out, &result));
+    return result;
+  }
+
  private:
+  MemoryPool* pool_;
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  arrow::BufferBuilder values_;
+  std::vector<int64_t> offsets_;
+  int value_idx_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -2342,13 +3006,7 @@ int ByteStreamSplitDecoder<DType>::Decode(T* buffer, int max_values) {
   const int num_decoded_previously = num_values_in_buffer_ - num_values_;
   const uint8_t* data = data_ + num_decoded_previously;
 
-#if defined(ARROW_HAVE_SSE2)
-  arrow::util::internal::ByteStreamSlitDecodeSSE2<T>(data, values_to_decode,
-                                                     num_values_in_buffer_, buffer);
-#else
-  arrow::util::internal::ByteStreamSlitDecodeScalar<T>(data, values_to_decode,
-                                                       num_values_in_buffer_, buffer);
-#endif
+  internal::ByteStreamSplitDecode(data, values_to_decode, num_values_in_buffer_, buffer);
   num_values_ -= values_to_decode;
   len_ -= sizeof(T) * values_to_decode;
   return values_to_decode;
@@ -2370,12 +3028,11 @@ int ByteStreamSplitDecoder<DType>::DecodeArrow(
   const uint8_t* data = data_ + num_decoded_previously;
   int offset = 0;
 
-#if defined(ARROW_HAVE_SSE2)
   // Use fast decoding into intermediate buffer.  This will also decode
   // some null values, but it's fast enough that we don't care.
   T* decode_out = EnsureDecodeBuffer(values_decoded);
-  arrow::util::internal::ByteStreamSlitDecodeSSE2<T>(data, values_decoded,
-                                                     num_values_in_buffer_, decode_out);
+  internal::ByteStreamSplitDecode(data, values_decoded, num_values_in_buffer_,
+                                  decode_out);
 
   // XXX If null_count is 0, we could even append in bulk or decode directly into
   // builder
@@ -2390,24 +3047,6 @@ int ByteStreamSplitDecoder<DType>::DecodeArrow(
 
   VisitNullBitmapInline(valid_bits, valid_bits_offset, num_values, null_count,
                         std::move(decode_value));
-#else
-  auto decode_value = [&](bool is_valid) {
-    if (is_valid) {
-      uint8_t gathered_byte_data[kNumStreams];
-      for (size_t b = 0; b < kNumStreams; ++b) {
-        const size_t byte_index = b * num_values_in_buffer_ + offset;
-        gathered_byte_data[b] = data[byte_index];
-      }
-      builder->UnsafeAppend(arrow::util::SafeLoadAs<T>(&gathered_byte_data[0]));
-      ++offset;
-    } else {
-      builder->UnsafeAppendNull();
-    }
-  };
-
-  VisitNullBitmapInline(valid_bits, valid_bits_offset, num_values, null_count,
-                        std::move(decode_value));
-#endif
 
   num_values_ -= values_decoded;
   len_ -= sizeof(T) * values_decoded;
@@ -2481,6 +3120,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2521,6 +3180,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -237,6 +237,24 @@ class DictEncoder : virtual public TypedEncoder<DType> {
   /// supported
   virtual void PutIndices(const ::arrow::Array& indices) = 0;
 
+  /// \brief EXPERIMENTAL: Append dictionary indices into the encoder, after
+  /// mapping them to the encoder's dictionary with `transpose_map` (as
+  /// returned by InsertDictionaryValues).  Indices of null slots are ignored.
+  /// \param[in] indices the dictionary index values, of any signed integer type
+  /// \param[in] transpose_map the encoder's dictionary index for each index
+  virtual void PutIndices(const ::arrow::Array& indices,
+                          const int32_t* transpose_map) = 0;
+
+  /// \brief EXPERIMENTAL: Insert values into the dictionary, without
+  /// appending them to the encoded data, and return their dictionary indices.
+  /// Unlike PutDictionary, the dictionary may already contain values, so that
+  /// successive different dictionaries can be merged.
+  /// \param[in] values the values to insert
+  /// \param[in] num_values the number of values
+  /// \param[out] out_indices the dictionary index of each value
+  virtual void InsertDictionaryValues(const typename DType::c_type* values,
+                                      int num_values, int32_t* out_indices) = 0;
+
   /// \brief EXPERIMENTAL: Append dictionary into encoder, inserting indices
   /// separately. Currently throws exception if the current dictionary memo is
   /// non-empty
@@ -24,13 +24,14 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
-#include "arrow/util/byte_stream_split.h"
 
+#include "parquet/byte_stream_split.h"
 #include "parquet/encoding.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
 #include <cmath>
+#include <numeric>
 #include <random>
 
 using arrow::default_memory_pool;
@@ -199,47 +200,70 @@ static void BM_PlainDecodingFloat(benchmark::State& state) {
 
 BENCHMARK(BM_PlainDecodingFloat)->Range(MIN_RANGE, MAX_RANGE);
 
-template <typename T, typename DecodeFunc>
-static void BM_ByteStreamSplitDecode(benchmark::State& state, DecodeFunc&& decode_func) {
-  std::vector<T> values(state.range(0), 64.0);
-  const uint8_t* values_raw = reinterpret_cast<const uint8_t*>(values.data());
-  std::vector<T> output(state.range(0), 0);
+using internal::ByteStreamSplitImpl;
+
+template <typename T>
+static void BM_ByteStreamSplitEncode(benchmark::State& state, ByteStreamSplitImpl impl) {
+  if (!internal::IsByteStreamSplitImplAvailable(impl)) {
+    state.SkipWithError("Implementation not available on this CPU");
+    return;
+  }
+  std::vector<T> values(state.range(0));
+  std::iota(values.begin(), values.end(), T(0));
+  std::vector<uint8_t> output(values.size() * sizeof(T));
 
   for (auto _ : state) {
-    decode_func(values_raw, static_cast<int64_t>(values.size()),
-                static_cast<int64_t>(values.size()), output.data());
+    internal::ByteStreamSplitEncode(values.data(), static_cast<int64_t>(values.size()),
+                                    output.data(), impl);
     benchmark::ClobberMemory();
   }
   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(T));
 }
 
-static void BM_ByteStreamSplitDecode_Float_Scalar(benchmark::State& state) {
-  BM_ByteStreamSplitDecode<float>(
-      state, arrow::util::internal::ByteStreamSlitDecodeScalar<float>);
-}
-
-static void BM_ByteStreamSplitDecode_Double_Scalar(benchmark::State& state) {
-  BM_ByteStreamSplitDecode<double>(
-      state, arrow::util::internal::ByteStreamSlitDecodeScalar<double>);
-}
-
-BENCHMARK(BM_ByteStreamSplitDecode_Float_Scalar)->Range(MIN_RANGE, MAX_RANGE);
-BENCHMARK(BM_ByteStreamSplitDecode_Double_Scalar)->Range(MIN_RANGE, MAX_RANGE);
-
-#if defined(ARROW_HAVE_SSE2)
-static void BM_ByteStreamSplitDecode_Float_SSE2(benchmark::State& state) {
-  BM_ByteStreamSplitDecode<float>(state,
-                                  arrow::util::internal::ByteStreamSlitDecodeSSE2<float>);
-}
+template <typename T>
+static void BM_ByteStreamSplitDecode(benchmark::State& state, ByteStreamSplitImpl impl) {
+  if (!internal::IsByteStreamSplitImplAvailable(impl)) {
+    state.SkipWithError("Implementation not available on this CPU");
+    return;
+  }
+  std::vector<T> values(state.range(0), 64.0);
+  const uint8_t* values_raw = reinterpret_cast<const uint8_t*>(values.data());
+  std::vector<T> output(state.range(0), 0);
 
-static void BM_ByteStreamSplitDecode_Double_SSE2(benchmark::State& state) {
-  BM_ByteStreamSplitDecode<double>(
-      state, arrow::util::internal::ByteStreamSlitDecodeSSE2<double>);
+  for (auto _ : state) {
+    internal::ByteStreamSplitDecode(values_raw, static_cast<int64_t>(values.size()),
+                                    static_cast<int64_t>(values.size()), output.data(),
+                                    impl);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(T));
 }
 
-BENCHMARK(BM_ByteStreamSplitDecode_Float_SSE2)->Range(MIN_RANGE, MAX_RANGE);
-BENCHMARK(BM_ByteStreamSplitDecode_Double_SSE2)->Range(MIN_RANGE, MAX_RANGE);
-#endif
+#define BYTE_STREAM_SPLIT_BENCHMARKS(IMPL)                                          \
+  static void BM_ByteStreamSplitEncode_Float_##IMPL(benchmark::State& state) {      \
+    BM_ByteStreamSplitEncode<float>(state, ByteStreamSplitImpl::k##IMPL);           \
+  }                                                                                 \
+  static void BM_ByteStreamSplitEncode_Double_##IMPL(benchmark::State& state) {     \
+    BM_ByteStreamSplitEncode<double>(state, ByteStreamSplitImpl::k##IMPL);          \
+  }                                                                                 \
+  static void BM_ByteStreamSplitDecode_Float_##IMPL(benchmark::State& state) {      \
+    BM_ByteStreamSplitDecode<float>(state, ByteStreamSplitImpl::k##IMPL);           \
+  }                                                                                 \
+  static void BM_ByteStreamSplitDecode_Double_##IMPL(benchmark::State& state) {     \
+    BM_ByteStreamSplitDecode<double>(state, ByteStreamSplitImpl::k##IMPL);          \
+  }                                                                                 \
+  BENCHMARK(BM_ByteStreamSplitEncode_Float_##IMPL)->Range(MIN_RANGE, MAX_RANGE);    \
+  BENCHMARK(BM_ByteStreamSplitEncode_Double_##IMPL)->Range(MIN_RANGE, MAX_RANGE);   \
+  BENCHMARK(BM_ByteStreamSplitDecode_Float_##IMPL)->Range(MIN_RANGE, MAX_RANGE);    \
+  BENCHMARK(BM_ByteStreamSplitDecode_Double_##IMPL)->Range(MIN_RANGE, MAX_RANGE)
+
+// Implementations not supported by the CPU are reported as skipped
+BYTE_STREAM_SPLIT_BENCHMARKS(Scalar);
+BYTE_STREAM_SPLIT_BENCHMARKS(SSE2);
+BYTE_STREAM_SPLIT_BENCHMARKS(AVX2);
+BYTE_STREAM_SPLIT_BENCHMARKS(AVX512);
+
+#undef BYTE_STREAM_SPLIT_BENCHMARKS
 
 template <typename Type>
 static void DecodeDict(std::vector<typename Type::c_type>& values,
@@ -306,6 +330,56 @@ static void BM_DictDecodingInt64_literals(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecodingInt64_literals)->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED benchmarks, on increasing timestamps with small gaps
+
+template <typename T>
+static std::vector<T> MakeSortedTimestamps(int64_t num_values) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> gap(0, 1000);
+  std::vector<T> values(num_values);
+  T value = 1000000;
+  for (auto& v : values) {
+    value += static_cast<T>(gap(gen));
+    v = value;
+  }
+  return values;
+}
+
+template <typename Type>
+static void BM_DeltaBitPackEncoding(benchmark::State& state) {
+  using T = typename Type::c_type;
+  auto values = MakeSortedTimestamps<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename Type>
+static void BM_DeltaBitPackDecoding(benchmark::State& state) {
+  using T = typename Type::c_type;
+  auto values = MakeSortedTimestamps<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  for (auto _ : state) {
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK_TEMPLATE(BM_DeltaBitPackEncoding, Int32Type)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_DeltaBitPackEncoding, Int64Type)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_DeltaBitPackDecoding, Int32Type)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_DeltaBitPackDecoding, Int64Type)->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Shared benchmarks for decoding using arrow builders
 
@@ -587,4 +661,46 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryDict, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryDict, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Benchmark Decoding from DELTA_BYTE_ARRAY Encoding
+class BM_ArrowBinaryDeltaByteArray : public BenchmarkDecodeArrow {
+ public:
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, EncodeArrow)
+(benchmark::State& state) { EncodeArrowBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, EncodeArrow)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, EncodeLowLevel)
+    ->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowDenseBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dict)
+(benchmark::State& state) { DecodeArrowDictBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaByteArray, DecodeArrow_Dict)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
 }  // namespace parquet
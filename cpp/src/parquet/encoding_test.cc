@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -33,6 +34,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 
+#include "parquet/byte_stream_split.h"
 #include "parquet/encoding.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
@@ -838,6 +840,41 @@ TEST(DictEncodingAdHoc, PutDictionaryPutIndices) {
 
 TYPED_TEST(EncodingAdHocTyped, DictArrowDirectPutIndices) { this->DictPutIndices(); }
 
+TEST(DictEncodingAdHoc, InsertDictionaryValuesTransposedIndices) {
+  // Indices into successive dictionaries are remapped to the merged one
+  auto owned_encoder = MakeTypedEncoder<Int64Type>(Encoding::PLAIN,
+                                                   /*use_dictionary=*/true);
+  auto encoder = dynamic_cast<DictEncoder<Int64Type>*>(owned_encoder.get());
+
+  std::vector<int64_t> first_dict = {10, 20, 30};
+  std::vector<int32_t> first_map(first_dict.size());
+  ASSERT_NO_THROW(encoder->InsertDictionaryValues(
+      first_dict.data(), static_cast<int>(first_dict.size()), first_map.data()));
+  ASSERT_EQ(std::vector<int32_t>({0, 1, 2}), first_map);
+  auto first_indices = arrow::ArrayFromJSON(arrow::int8(), "[2, 0, null, 1]");
+  ASSERT_NO_THROW(encoder->PutIndices(*first_indices, nullptr));
+
+  std::vector<int64_t> second_dict = {30, 40, 10};
+  std::vector<int32_t> second_map(second_dict.size());
+  ASSERT_NO_THROW(encoder->InsertDictionaryValues(
+      second_dict.data(), static_cast<int>(second_dict.size()), second_map.data()));
+  ASSERT_EQ(std::vector<int32_t>({2, 3, 0}), second_map);
+  ASSERT_EQ(4, encoder->num_entries());
+  auto second_indices = arrow::ArrayFromJSON(arrow::int16(), "[1, null, 0, 2]");
+  ASSERT_NO_THROW(encoder->PutIndices(*second_indices, second_map.data()));
+
+  std::vector<int64_t> expected = {30, 10, 20, 40, 30, 10};
+  std::unique_ptr<TypedDecoder<Int64Type>> decoder;
+  std::shared_ptr<Buffer> buf, dict_buf;
+  GetDictDecoder(encoder, static_cast<int64_t>(expected.size()), &buf, &dict_buf,
+                 nullptr, &decoder);
+
+  std::vector<int64_t> decoded(expected.size());
+  ASSERT_EQ(static_cast<int>(expected.size()),
+            decoder->Decode(decoded.data(), static_cast<int>(expected.size())));
+  ASSERT_EQ(expected, decoded);
+}
+
 class DictEncoding : public TestArrowBuilderDecoding {
  public:
   void SetupEncoderDecoder() override {
@@ -1120,6 +1157,49 @@ TYPED_TEST(TestByteStreamSplitEncoding, CheckOnlyEncode) {
   ASSERT_NO_FATAL_FAILURE(this->CheckEncode());
 }
 
+TYPED_TEST(TestByteStreamSplitEncoding, AllImplementations) {
+  // Every vectorized implementation available on this CPU must agree with the
+  // scalar one, across block boundaries and for streams decoded from an offset
+  using T = typename TypeParam::c_type;
+  using internal::ByteStreamSplitImpl;
+  constexpr int64_t kNumStreams = sizeof(T);
+  for (auto impl : {ByteStreamSplitImpl::kAuto, ByteStreamSplitImpl::kSSE2,
+                    ByteStreamSplitImpl::kAVX2, ByteStreamSplitImpl::kAVX512}) {
+    if (!internal::IsByteStreamSplitImplAvailable(impl)) {
+      continue;
+    }
+    for (int64_t num_values : {1, 2, 15, 16, 17, 63, 64, 65, 200, 1337}) {
+      std::vector<uint8_t> bytes;
+      random_bytes(static_cast<int>(num_values * kNumStreams),
+                   static_cast<uint32_t>(num_values), &bytes);
+      std::vector<T> values(num_values);
+      std::memcpy(values.data(), bytes.data(), bytes.size());
+
+      std::vector<uint8_t> expected_encoded(bytes.size());
+      std::vector<uint8_t> encoded(bytes.size());
+      internal::ByteStreamSplitEncode(values.data(), num_values, expected_encoded.data(),
+                                      ByteStreamSplitImpl::kScalar);
+      internal::ByteStreamSplitEncode(values.data(), num_values, encoded.data(), impl);
+      ASSERT_EQ(encoded, expected_encoded) << "num_values " << num_values;
+
+      for (int64_t offset : {int64_t(0), num_values / 3}) {
+        const int64_t length = num_values - offset;
+        std::vector<uint8_t> expected(length * kNumStreams);
+        std::vector<uint8_t> decoded(length * kNumStreams);
+        internal::ByteStreamSplitDecode(encoded.data() + offset, length, num_values,
+                                        reinterpret_cast<T*>(expected.data()),
+                                        ByteStreamSplitImpl::kScalar);
+        internal::ByteStreamSplitDecode(encoded.data() + offset, length, num_values,
+                                        reinterpret_cast<T*>(decoded.data()), impl);
+        ASSERT_EQ(decoded, expected) << "num_values " << num_values << " offset "
+                                     << offset;
+        ASSERT_EQ(0, std::memcmp(decoded.data(), bytes.data() + offset * kNumStreams,
+                                 decoded.size()));
+      }
+    }
+  }
+}
+
 TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   // First check encoders.
   ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::BYTE_STREAM_SPLIT),
@@ -1148,5 +1228,281 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encode/decode tests
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    {
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+    }
+
+    {
+      // Try again but with a small step, across miniblock boundaries
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int step = 37;
+      int remaining = num_values_;
+      for (int i = 0; i < num_values_; i += step) {
+        int num_decoded = decoder->Decode(decode_buf_, step);
+        ASSERT_EQ(num_decoded, std::min(step, remaining));
+        ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, &draws_[i], num_decoded));
+        remaining -= num_decoded;
+      }
+      ASSERT_EQ(0, decoder->values_left());
+    }
+
+    {
+      std::vector<uint8_t> valid_bits(arrow::BitUtil::BytesForBits(num_values_), 0);
+      std::vector<T> expected_filtered_output;
+      arrow::internal::BitmapWriter writer{valid_bits.data(), 0, num_values_};
+      for (int i = 0; i < num_values_; ++i) {
+        if (i % 3 != 0) {
+          writer.Set();
+          expected_filtered_output.push_back(draws_[i]);
+        }
+        writer.Next();
+      }
+      writer.Finish();
+      const int expected_size = static_cast<int>(expected_filtered_output.size());
+      ASSERT_NO_THROW(encoder->PutSpaced(draws_, num_values_, valid_bits.data(), 0));
+      encode_buffer_ = encoder->FlushValues();
+
+      // The number of values is taken from the encoded data, not from the
+      // number of slots
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      ASSERT_EQ(expected_size, decoder->values_left());
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(expected_size, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(
+          VerifyResults<T>(decode_buf_, expected_filtered_output.data(), expected_size));
+    }
+  }
+
+  void ExecuteValues(const std::vector<T>& values) {
+    num_values_ = static_cast<int>(values.size());
+    this->input_bytes_.assign(reinterpret_cast<const uint8_t*>(values.data()),
+                              reinterpret_cast<const uint8_t*>(values.data()) +
+                                  values.size() * sizeof(T));
+    this->output_bytes_.resize(values.size() * sizeof(T));
+    draws_ = reinterpret_cast<T*>(this->input_bytes_.data());
+    decode_buf_ = reinterpret_cast<T*>(this->output_bytes_.data());
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Sizes around the boundaries of miniblocks (32 values) and blocks (128 values)
+  for (int values : {0, 1, 2, 31, 32, 33, 127, 128, 129, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->Execute(2000, 10));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, SortedValues) {
+  using T = typename TypeParam::c_type;
+  std::vector<T> values(1000);
+  T value = 1000000;
+  for (size_t i = 0; i < values.size(); ++i) {
+    value += static_cast<T>(i % 7);
+    values[i] = value;
+  }
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(values));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, ExtremeValues) {
+  // Deltas between the extreme values overflow and must wrap around
+  using T = typename TypeParam::c_type;
+  const T min = std::numeric_limits<T>::min();
+  const T max = std::numeric_limits<T>::max();
+  std::vector<T> values;
+  for (int i = 0; i < 300; ++i) {
+    values.push_back(i % 2 == 0 ? min : max);
+    values.push_back(i % 3 == 0 ? 0 : static_cast<T>(-1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteValues(values));
+}
+
+TEST(DeltaBitPackEncoding, SpecificationExample) {
+  // From the example of the Parquet format specification, values 1 to 5 have a
+  // constant delta and no bits are packed
+  std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+  std::vector<uint8_t> expected = {
+      // Block size, miniblocks per block, total count, zigzag first value
+      0x80, 0x01, 0x04, 0x05, 0x02,
+      // Zigzag min delta, bit widths of the miniblocks
+      0x02, 0x00, 0x00, 0x00, 0x00};
+  ASSERT_EQ(expected,
+            std::vector<uint8_t>(buffer->data(), buffer->data() + buffer->size()));
+}
+
+TEST(DeltaBitPackEncoding, InvalidDataTypes) {
+  ASSERT_THROW(MakeTypedEncoder<FloatType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<FLBAType>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<Int64Type>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::DELTA_LENGTH_BYTE_ARRAY),
+               ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests
+
+class DeltaByteArrayEncodingBase : public TestArrowBuilderDecoding {
+ public:
+  explicit DeltaByteArrayEncodingBase(Encoding::type encoding) : encoding_(encoding) {}
+
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(encoding_);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(encoding_);
+    decoder_ = plain_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), num_values_));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+
+  void CheckRoundtrip(const std::vector<std::string>& strings) {
+    std::vector<ByteArray> values;
+    for (const auto& s : strings) {
+      values.emplace_back(static_cast<uint32_t>(s.size()),
+                          reinterpret_cast<const uint8_t*>(s.data()));
+    }
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding_);
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding_);
+    const int num_values = static_cast<int>(values.size());
+    // Encode in two batches, and twice with the same encoder
+    for (int i = 0; i < 2; ++i) {
+      encoder->Put(values.data(), num_values / 2);
+      encoder->Put(values.data() + num_values / 2, num_values - num_values / 2);
+      auto buffer = encoder->FlushValues();
+
+      decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+      std::vector<ByteArray> decoded(values.size());
+      ASSERT_EQ(num_values, decoder->Decode(decoded.data(), num_values));
+      ASSERT_EQ(0, decoder->values_left());
+      for (int j = 0; j < num_values; ++j) {
+        ASSERT_EQ(values[j], decoded[j]) << "at value " << j;
+      }
+    }
+  }
+
+  void CheckSharedPrefixes() {
+    std::vector<std::string> strings = {"", "", "a", "apple", "application", "apply",
+                                        "apply", "b", "", "banana", "bandana"};
+    ASSERT_NO_FATAL_FAILURE(CheckRoundtrip(strings));
+    ASSERT_NO_FATAL_FAILURE(CheckRoundtrip({}));
+  }
+
+ protected:
+  Encoding::type encoding_;
+};
+
+class DeltaLengthByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaLengthByteArrayEncoding()
+      : DeltaByteArrayEncodingBase(Encoding::DELTA_LENGTH_BYTE_ARRAY) {}
+};
+
+class DeltaByteArrayEncoding : public DeltaByteArrayEncodingBase {
+ public:
+  DeltaByteArrayEncoding() : DeltaByteArrayEncodingBase(Encoding::DELTA_BYTE_ARRAY) {}
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckSharedPrefixes) {
+  this->CheckSharedPrefixes();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckSharedPrefixes) { this->CheckSharedPrefixes(); }
+
+TEST(DeltaByteArrayEncodingAdHoc, ArrowBinaryDirectPut) {
+  const int64_t size = 50;
+  const int32_t min_length = 0;
+  const int32_t max_length = 10;
+  const double null_probability = 0.25;
+
+  ::arrow::random::RandomArrayGenerator rag(0);
+  std::shared_ptr<::arrow::Array> values =
+      rag.String(size, min_length, max_length, null_probability);
+
+  auto encoder = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  auto decoder = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+  ASSERT_NO_THROW(encoder->Put(*values));
+  auto buf = encoder->FlushValues();
+
+  int num_values = static_cast<int>(values->length() - values->null_count());
+  decoder->SetData(num_values, buf->data(), static_cast<int>(buf->size()));
+
+  typename EncodingTraits<ByteArrayType>::Accumulator acc;
+  acc.builder.reset(new ::arrow::StringBuilder);
+  ASSERT_EQ(num_values,
+            decoder->DecodeArrow(static_cast<int>(values->length()),
+                                 static_cast<int>(values->null_count()),
+                                 values->null_bitmap_data(), values->offset(), &acc));
+
+  std::shared_ptr<::arrow::Array> result;
+  ASSERT_OK(acc.builder->Finish(&result));
+  ASSERT_EQ(50, result->length());
+  ::arrow::AssertArraysEqual(*values, *result);
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -62,6 +62,15 @@ int64_t RowGroupWriter::total_bytes_written() const {
   return contents_->total_bytes_written();
 }
 
+int64_t RowGroupWriter::estimated_buffered_value_bytes() const {
+  return contents_->estimated_buffered_value_bytes();
+}
+
+int64_t RowGroupWriter::EstimatedTotalBytes() const {
+  return contents_->total_bytes_written() + contents_->total_compressed_bytes() +
+         contents_->estimated_buffered_value_bytes();
+}
+
 int RowGroupWriter::current_column() { return contents_->current_column(); }
 
 int RowGroupWriter::num_columns() const { return contents_->num_columns(); }
@@ -177,6 +186,16 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     return total_bytes_written;
   }
 
+  int64_t estimated_buffered_value_bytes() const override {
+    int64_t estimated_bytes = 0;
+    for (size_t i = 0; i < column_writers_.size(); i++) {
+      if (column_writers_[i]) {
+        estimated_bytes += column_writers_[i]->EstimatedBufferedValueBytes();
+      }
+    }
+    return estimated_bytes;
+  }
+
   void Close() override {
     if (!closed_) {
       closed_ = true;
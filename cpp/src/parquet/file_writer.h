@@ -57,6 +57,8 @@ class PARQUET_EXPORT RowGroupWriter {
     virtual int64_t total_bytes_written() const = 0;
     // total bytes still compressed but not written
     virtual int64_t total_compressed_bytes() const = 0;
+    // estimated size of the values not written to a page yet
+    virtual int64_t estimated_buffered_value_bytes() const = 0;
   };
 
   explicit RowGroupWriter(std::unique_ptr<Contents> contents);
@@ -90,6 +92,11 @@ class PARQUET_EXPORT RowGroupWriter {
 
   int64_t total_bytes_written() const;
   int64_t total_compressed_bytes() const;
+  int64_t estimated_buffered_value_bytes() const;
+
+  /// \brief Estimated size of the row group once closed: the pages written or
+  /// buffered so far plus the values not written to a page yet.
+  int64_t EstimatedTotalBytes() const;
 
  private:
   // Holds a pointer to an instance of Contents implementation
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/level_conversion.h"
+
+#include <cstdint>
+#include <limits>
+
+#include "arrow/util/cpu_info.h"
+#include "parquet/schema.h"
+
+#define PARQUET_IMPL_NAMESPACE standard
+#include "parquet/level_conversion_inc.h"
+#undef PARQUET_IMPL_NAMESPACE
+
+namespace parquet {
+namespace internal {
+
+#define DECLARE_LEVEL_CONVERSION_KERNELS(NAMESPACE)                                     \
+  namespace NAMESPACE {                                                                 \
+  void DefRepLevelsToBitmapImpl(const int16_t* def_levels, const int16_t* rep_levels,  \
+                                int64_t num_levels, LevelInfo level_info,               \
+                                int16_t max_def_level, uint8_t* valid_bits,             \
+                                int64_t valid_bits_offset, int64_t* num_slots,          \
+                                int64_t* null_count);                                   \
+  void DefRepLevelsToListImpl(const int16_t* def_levels, const int16_t* rep_levels,    \
+                              int64_t num_levels, LevelInfo level_info,                 \
+                              int32_t* offsets, uint8_t* valid_bits, int64_t* num_slots, \
+                              int64_t* null_count);                                     \
+  }
+
+#if defined(PARQUET_HAVE_RUNTIME_AVX2)
+DECLARE_LEVEL_CONVERSION_KERNELS(avx2)
+#endif
+#if defined(PARQUET_HAVE_RUNTIME_AVX512)
+DECLARE_LEVEL_CONVERSION_KERNELS(avx512)
+#endif
+
+#undef DECLARE_LEVEL_CONVERSION_KERNELS
+
+namespace {
+
+struct LevelConversionKernels {
+  decltype(&standard::DefRepLevelsToBitmapImpl) def_rep_levels_to_bitmap;
+  decltype(&standard::DefRepLevelsToListImpl) def_rep_levels_to_list;
+};
+
+LevelConversionKernels SelectKernels() {
+  using ::arrow::internal::CpuInfo;
+  const int64_t hardware_flags = CpuInfo::GetInstance()->hardware_flags();
+  auto supports = [&](int64_t flags) { return (hardware_flags & flags) == flags; };
+#if defined(PARQUET_HAVE_RUNTIME_AVX512)
+  if (supports(CpuInfo::AVX512 | CpuInfo::BMI2)) {
+    return {&avx512::DefRepLevelsToBitmapImpl, &avx512::DefRepLevelsToListImpl};
+  }
+#endif
+#if defined(PARQUET_HAVE_RUNTIME_AVX2)
+  if (supports(CpuInfo::AVX2 | CpuInfo::BMI2)) {
+    return {&avx2::DefRepLevelsToBitmapImpl, &avx2::DefRepLevelsToListImpl};
+  }
+#endif
+  ARROW_UNUSED(supports);
+  return {&standard::DefRepLevelsToBitmapImpl, &standard::DefRepLevelsToListImpl};
+}
+
+const LevelConversionKernels& GetKernels() {
+  static const LevelConversionKernels kernels = SelectKernels();
+  return kernels;
+}
+
+}  // namespace
+
+LevelInfo LevelInfo::ComputeLevelInfo(const ColumnDescriptor* descr) {
+  LevelInfo info;
+  info.def_level = descr->max_definition_level();
+  info.rep_level = descr->max_repetition_level();
+
+  // Walk up to the closest repeated node (possibly the leaf itself), discounting
+  // the optional nodes below it.  The schema root doesn't count.
+  int16_t repeated_ancestor_def_level = descr->max_definition_level();
+  const schema::Node* node = descr->schema_node().get();
+  while (node != nullptr && !node->is_repeated()) {
+    if (node->is_optional()) {
+      --repeated_ancestor_def_level;
+    }
+    node = node->parent();
+    if (node != nullptr && node->parent() == nullptr) {
+      break;
+    }
+  }
+  info.repeated_ancestor_def_level = repeated_ancestor_def_level;
+  return info;
+}
+
+void DefinitionLevelsToBitmap(const int16_t* def_levels, int64_t num_def_levels,
+                              const int16_t max_definition_level,
+                              const int16_t max_repetition_level, int64_t* values_read,
+                              int64_t* null_count, uint8_t* valid_bits,
+                              int64_t valid_bits_offset) {
+  LevelInfo level_info;
+  level_info.def_level = max_definition_level;
+  level_info.rep_level = max_repetition_level;
+  int16_t max_def_level = max_definition_level;
+  if (max_repetition_level > 0) {
+    // Repeated leaf: lower levels than the null element are empty or null lists
+    level_info.repeated_ancestor_def_level = max_definition_level - 1;
+    max_def_level = std::numeric_limits<int16_t>::max();
+  }
+  int64_t nulls = 0;
+  GetKernels().def_rep_levels_to_bitmap(def_levels, /*rep_levels=*/nullptr,
+                                        num_def_levels, level_info, max_def_level,
+                                        valid_bits, valid_bits_offset, values_read,
+                                        &nulls);
+  *null_count += nulls;
+}
+
+void DefRepLevelsToBitmap(const int16_t* def_levels, const int16_t* rep_levels,
+                          int64_t num_levels, LevelInfo level_info, uint8_t* valid_bits,
+                          int64_t valid_bits_offset, int64_t* num_slots,
+                          int64_t* null_count) {
+  GetKernels().def_rep_levels_to_bitmap(
+      def_levels, rep_levels, num_levels, level_info,
+      std::numeric_limits<int16_t>::max(), valid_bits, valid_bits_offset, num_slots,
+      null_count);
+}
+
+void DefRepLevelsToList(const int16_t* def_levels, const int16_t* rep_levels,
+                        int64_t num_levels, LevelInfo level_info, int32_t* offsets,
+                        uint8_t* valid_bits, int64_t* num_slots, int64_t* null_count) {
+  GetKernels().def_rep_levels_to_list(def_levels, rep_levels, num_levels, level_info,
+                                      offsets, valid_bits, num_slots, null_count);
+}
+
+}  // namespace internal
+}  // namespace parquet
@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Conversion of Parquet definition and repetition levels to Arrow validity
+// bitmaps and list offsets, for the reassembly of nested records.
+//
+// The conversions are vectorized, with implementations for SSE2, AVX2 and
+// AVX-512 selected at runtime depending on the CPU.
+
+#pragma once
+
+#include <cstdint>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+
+namespace internal {
+
+/// \brief Where a node of a nested schema has slots in its Arrow array, in
+/// terms of the definition and repetition levels of any leaf below it.
+///
+/// A level denotes a slot of the node if its definition level is at least
+/// repeated_ancestor_def_level and its repetition level is at most rep_level.
+/// The slot is non-null if the definition level is at least def_level.
+struct PARQUET_EXPORT LevelInfo {
+  /// The definition level at which the node is not null
+  int16_t def_level = 0;
+
+  /// The maximum repetition level of a level starting a new slot
+  int16_t rep_level = 0;
+
+  /// The definition level at which the closest repeated ancestor has an
+  /// element, i.e. lower definition levels denote a null or empty ancestor
+  int16_t repeated_ancestor_def_level = 0;
+
+  /// \brief Whether the node can have null slots
+  bool HasNullableValues() const { return def_level > repeated_ancestor_def_level; }
+
+  /// \brief Compute the level information of a leaf column
+  static LevelInfo ComputeLevelInfo(const ColumnDescriptor* descr);
+};
+
+/// \brief Compute the validity bitmap of a flat leaf column.
+///
+/// For a column without repeated ancestors, every level denotes a value, which
+/// is null unless the level equals max_definition_level.  For a repeated leaf,
+/// levels equal to max_definition_level - 1 denote null values and lower
+/// levels empty or null lists.
+///
+/// \param[out] values_read the number of values (including nulls)
+/// \param[in,out] null_count incremented by the number of null values
+PARQUET_EXPORT
+void DefinitionLevelsToBitmap(const int16_t* def_levels, int64_t num_def_levels,
+                              const int16_t max_definition_level,
+                              const int16_t max_repetition_level, int64_t* values_read,
+                              int64_t* null_count, uint8_t* valid_bits,
+                              int64_t valid_bits_offset);
+
+/// \brief Compute the validity bitmap of a struct or leaf node.
+///
+/// `valid_bits` must have room for `num_levels` bits past `valid_bits_offset`.
+/// `rep_levels` may be null if all repetition levels are zero.
+///
+/// \param[out] num_slots the number of slots of the node
+/// \param[out] null_count the number of null slots
+PARQUET_EXPORT
+void DefRepLevelsToBitmap(const int16_t* def_levels, const int16_t* rep_levels,
+                          int64_t num_levels, LevelInfo level_info, uint8_t* valid_bits,
+                          int64_t valid_bits_offset, int64_t* num_slots,
+                          int64_t* null_count);
+
+/// \brief Compute the offsets and validity bitmap of a list node.
+///
+/// `level_info` describes the list itself: elements are present at definition
+/// levels above level_info.def_level, and continue the current list at
+/// repetition level level_info.rep_level + 1.  `offsets` must have room for
+/// `num_levels + 1` values, and `valid_bits` for `num_levels` bits.
+///
+/// \param[out] num_slots the number of slots (lists) of the node
+/// \param[out] null_count the number of null lists
+PARQUET_EXPORT
+void DefRepLevelsToList(const int16_t* def_levels, const int16_t* rep_levels,
+                        int64_t num_levels, LevelInfo level_info, int32_t* offsets,
+                        uint8_t* valid_bits, int64_t* num_slots, int64_t* null_count);
+
+}  // namespace internal
+}  // namespace parquet
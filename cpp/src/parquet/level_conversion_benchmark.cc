@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "arrow/util/bit_util.h"
+#include "parquet/level_conversion.h"
+
+namespace parquet {
+
+using internal::LevelInfo;
+
+namespace benchmark {
+
+constexpr int64_t kNumLevels = 1 << 16;
+
+// Generate levels equal to `max_level` with the given probability, and
+// uniformly distributed lower levels otherwise
+std::vector<int16_t> GenerateLevels(int16_t max_level, double max_level_probability,
+                                    uint32_t seed = 42) {
+  std::default_random_engine rng(seed);
+  std::bernoulli_distribution is_max(max_level_probability);
+  std::uniform_int_distribution<int> lower_level(0, max_level > 0 ? max_level - 1 : 0);
+  std::vector<int16_t> levels(kNumLevels);
+  for (auto& level : levels) {
+    level = static_cast<int16_t>(is_max(rng) ? max_level : lower_level(rng));
+  }
+  return levels;
+}
+
+void SetLevelsProcessed(::benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations() * kNumLevels);
+  state.SetBytesProcessed(state.iterations() * kNumLevels * sizeof(int16_t));
+}
+
+// Flat optional column, the argument is the percentage of nulls
+static void BM_DefinitionLevelsToBitmap(::benchmark::State& state) {
+  const auto def_levels = GenerateLevels(1, 1.0 - state.range(0) / 100.0);
+  std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(kNumLevels));
+  for (auto _ : state) {
+    int64_t values_read = 0;
+    int64_t null_count = 0;
+    internal::DefinitionLevelsToBitmap(def_levels.data(), kNumLevels,
+                                       /*max_definition_level=*/1,
+                                       /*max_repetition_level=*/0, &values_read,
+                                       &null_count, valid_bits.data(), 0);
+    ::benchmark::DoNotOptimize(null_count);
+  }
+  SetLevelsProcessed(state);
+}
+
+BENCHMARK(BM_DefinitionLevelsToBitmap)->Arg(0)->Arg(1)->Arg(10)->Arg(50);
+
+// Struct within a list: only levels at or above the list's element level
+// are slots of the struct
+static void BM_DefRepLevelsToBitmapNested(::benchmark::State& state) {
+  LevelInfo level_info;
+  level_info.def_level = 3;
+  level_info.rep_level = 1;
+  level_info.repeated_ancestor_def_level = 2;
+  const auto def_levels = GenerateLevels(4, 0.9);
+  const auto rep_levels = GenerateLevels(1, 0.8, /*seed=*/43);
+  std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(kNumLevels));
+  for (auto _ : state) {
+    int64_t num_slots = 0;
+    int64_t null_count = 0;
+    internal::DefRepLevelsToBitmap(def_levels.data(), rep_levels.data(), kNumLevels,
+                                   level_info, valid_bits.data(), 0, &num_slots,
+                                   &null_count);
+    ::benchmark::DoNotOptimize(null_count);
+  }
+  SetLevelsProcessed(state);
+}
+
+BENCHMARK(BM_DefRepLevelsToBitmapNested);
+
+// Optional list of optional values, the argument is the average list length
+static void BM_DefRepLevelsToList(::benchmark::State& state) {
+  LevelInfo level_info;
+  level_info.def_level = 1;
+  const auto def_levels = GenerateLevels(3, 0.9);
+  const auto rep_levels = GenerateLevels(1, 1.0 - 1.0 / state.range(0), /*seed=*/43);
+  std::vector<int32_t> offsets(kNumLevels + 1);
+  std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(kNumLevels));
+  for (auto _ : state) {
+    int64_t num_slots = 0;
+    int64_t null_count = 0;
+    internal::DefRepLevelsToList(def_levels.data(), rep_levels.data(), kNumLevels,
+                                 level_info, offsets.data(), valid_bits.data(),
+                                 &num_slots, &null_count);
+    ::benchmark::DoNotOptimize(null_count);
+  }
+  SetLevelsProcessed(state);
+}
+
+BENCHMARK(BM_DefRepLevelsToList)->Arg(1)->Arg(4)->Arg(32);
+
+}  // namespace benchmark
+}  // namespace parquet
@@ -0,0 +1,239 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Level conversion kernels.  This file is included by one translation unit
+// per supported instruction set, each compiled with the matching compiler
+// flags and defining PARQUET_IMPL_NAMESPACE to a distinct namespace.  The
+// kernels work on batches of 64 levels, comparing them with SIMD
+// instructions into 64-bit masks and then deriving slots, validity and list
+// offsets with bit manipulations.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+#include "parquet/exception.h"
+#include "parquet/level_conversion.h"
+
+#if defined(__AVX2__) || defined(__AVX512BW__) || defined(__BMI2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#ifndef PARQUET_IMPL_NAMESPACE
+#error "PARQUET_IMPL_NAMESPACE must be defined"
+#endif
+
+namespace parquet {
+namespace internal {
+namespace PARQUET_IMPL_NAMESPACE {
+
+constexpr int64_t kLevelBatchSize = 64;
+
+inline uint64_t LowBitsMask(int64_t num_bits) {
+  return num_bits >= 64 ? ~uint64_t(0) : (uint64_t(1) << num_bits) - 1;
+}
+
+/// \brief Return a mask with bit i set iff levels[i] > rhs, for the first
+/// `num_levels` (at most 64) levels
+inline uint64_t GreaterThanBitmap(const int16_t* levels, int64_t num_levels,
+                                  int16_t rhs) {
+  if (num_levels == kLevelBatchSize) {
+#if defined(__AVX512BW__)
+    const __m512i threshold = _mm512_set1_epi16(rhs);
+    const uint64_t low = _mm512_cmpgt_epi16_mask(_mm512_loadu_si512(levels), threshold);
+    const uint64_t high =
+        _mm512_cmpgt_epi16_mask(_mm512_loadu_si512(levels + 32), threshold);
+    return low | (high << 32);
+#elif defined(__AVX2__)
+    const __m256i threshold = _mm256_set1_epi16(rhs);
+    uint64_t result = 0;
+    for (int i = 0; i < 2; ++i) {
+      const auto in = reinterpret_cast<const __m256i*>(levels + 32 * i);
+      const __m256i low = _mm256_cmpgt_epi16(_mm256_loadu_si256(in), threshold);
+      const __m256i high = _mm256_cmpgt_epi16(_mm256_loadu_si256(in + 1), threshold);
+      // Packing interleaves the 128-bit lanes of its inputs, restore their order
+      const __m256i packed =
+          _mm256_permute4x64_epi64(_mm256_packs_epi16(low, high), 0xD8);
+      result |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(packed)))
+                << (32 * i);
+    }
+    return result;
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128i threshold = _mm_set1_epi16(rhs);
+    uint64_t result = 0;
+    for (int i = 0; i < 4; ++i) {
+      const auto in = reinterpret_cast<const __m128i*>(levels + 16 * i);
+      const __m128i low = _mm_cmpgt_epi16(_mm_loadu_si128(in), threshold);
+      const __m128i high = _mm_cmpgt_epi16(_mm_loadu_si128(in + 1), threshold);
+      result |= static_cast<uint64_t>(
+                    static_cast<uint16_t>(_mm_movemask_epi8(_mm_packs_epi16(low, high))))
+                << (16 * i);
+    }
+    return result;
+#endif
+  }
+  uint64_t result = 0;
+  for (int64_t i = 0; i < num_levels; ++i) {
+    result |= static_cast<uint64_t>(levels[i] > rhs) << i;
+  }
+  return result;
+}
+
+/// \brief Gather the bits of `bitmap` selected by `select` into the low bits
+/// of the result
+inline uint64_t ExtractBits(uint64_t bitmap, uint64_t select) {
+#if defined(__BMI2__)
+  return _pext_u64(bitmap, select);
+#else
+  uint64_t result = 0;
+  int64_t position = 0;
+  while (select != 0) {
+    const int bit = ::arrow::BitUtil::CountTrailingZeros(select);
+    result |= ((bitmap >> bit) & 1) << position++;
+    select &= select - 1;
+  }
+  return result;
+#endif
+}
+
+/// \brief Write the low `num_bits` bits of `word` at bit `*position` of
+/// `bitmap` and advance the position.  Bits preceding the position are
+/// preserved, later bits of the last byte written are not.
+inline void AppendBits(uint64_t word, int64_t num_bits, uint8_t* bitmap,
+                       int64_t* position) {
+  if (num_bits == 0) {
+    return;
+  }
+  word &= LowBitsMask(num_bits);
+  uint8_t* out = bitmap + *position / 8;
+  const int bit_offset = static_cast<int>(*position % 8);
+  *position += num_bits;
+  if (bit_offset != 0) {
+    *out = static_cast<uint8_t>((*out & ((1 << bit_offset) - 1)) | (word << bit_offset));
+    const int64_t bits_written = 8 - bit_offset;
+    if (num_bits <= bits_written) {
+      return;
+    }
+    word >>= bits_written;
+    num_bits -= bits_written;
+    ++out;
+  }
+  word = ::arrow::BitUtil::ToLittleEndian(word);
+  std::memcpy(out, &word, static_cast<size_t>(::arrow::BitUtil::BytesForBits(num_bits)));
+}
+
+/// \brief Batched implementation of DefRepLevelsToBitmap.  Definition levels
+/// greater than `max_def_level` raise an error.
+void DefRepLevelsToBitmapImpl(const int16_t* def_levels, const int16_t* rep_levels,
+                              int64_t num_levels, LevelInfo level_info,
+                              int16_t max_def_level, uint8_t* valid_bits,
+                              int64_t valid_bits_offset, int64_t* num_slots,
+                              int64_t* null_count) {
+  const bool check_max_def_level = max_def_level < std::numeric_limits<int16_t>::max();
+  const auto present_threshold =
+      static_cast<int16_t>(level_info.repeated_ancestor_def_level - 1);
+  const auto valid_threshold = static_cast<int16_t>(level_info.def_level - 1);
+  int64_t position = valid_bits_offset;
+  int64_t nulls = 0;
+  while (num_levels > 0) {
+    const int64_t batch_size = std::min(num_levels, kLevelBatchSize);
+    if (check_max_def_level &&
+        GreaterThanBitmap(def_levels, batch_size, max_def_level) != 0) {
+      throw ParquetException("definition level exceeds maximum");
+    }
+    uint64_t slots = LowBitsMask(batch_size);
+    if (present_threshold >= 0) {
+      // Skip null or empty repeated ancestors
+      slots &= GreaterThanBitmap(def_levels, batch_size, present_threshold);
+    }
+    if (rep_levels != nullptr) {
+      // Skip continuations of nested lists within a slot
+      slots &= ~GreaterThanBitmap(rep_levels, batch_size, level_info.rep_level);
+    }
+    uint64_t valid = GreaterThanBitmap(def_levels, batch_size, valid_threshold);
+    int64_t batch_slots = batch_size;
+    if (slots != LowBitsMask(batch_size)) {
+      valid = ExtractBits(valid, slots);
+      batch_slots = ::arrow::BitUtil::PopCount(slots);
+    }
+    AppendBits(valid, batch_slots, valid_bits, &position);
+    nulls += batch_slots - ::arrow::BitUtil::PopCount(valid);
+
+    def_levels += batch_size;
+    if (rep_levels != nullptr) {
+      rep_levels += batch_size;
+    }
+    num_levels -= batch_size;
+  }
+  *num_slots = position - valid_bits_offset;
+  *null_count = nulls;
+}
+
+/// \brief Batched implementation of DefRepLevelsToList
+void DefRepLevelsToListImpl(const int16_t* def_levels, const int16_t* rep_levels,
+                            int64_t num_levels, LevelInfo level_info, int32_t* offsets,
+                            uint8_t* valid_bits, int64_t* num_slots,
+                            int64_t* null_count) {
+  const auto present_threshold =
+      static_cast<int16_t>(level_info.repeated_ancestor_def_level - 1);
+  const auto valid_threshold = static_cast<int16_t>(level_info.def_level - 1);
+  const auto element_rep_level = static_cast<int16_t>(level_info.rep_level + 1);
+  int64_t position = 0;
+  int64_t nulls = 0;
+  int32_t num_elements = 0;
+  while (num_levels > 0) {
+    const int64_t batch_size = std::min(num_levels, kLevelBatchSize);
+    const uint64_t present = GreaterThanBitmap(def_levels, batch_size, present_threshold);
+    // Levels starting a new list, and levels adding an element to the current one
+    const uint64_t starts =
+        present & ~GreaterThanBitmap(rep_levels, batch_size, level_info.rep_level);
+    const uint64_t elements =
+        present & GreaterThanBitmap(def_levels, batch_size, level_info.def_level) &
+        ~GreaterThanBitmap(rep_levels, batch_size, element_rep_level);
+
+    uint64_t remaining_starts = starts;
+    while (remaining_starts != 0) {
+      const int bit = ::arrow::BitUtil::CountTrailingZeros(remaining_starts);
+      *offsets++ =
+          num_elements + ::arrow::BitUtil::PopCount(elements & LowBitsMask(bit));
+      remaining_starts &= remaining_starts - 1;
+    }
+    const int64_t batch_slots = ::arrow::BitUtil::PopCount(starts);
+    const uint64_t valid =
+        ExtractBits(GreaterThanBitmap(def_levels, batch_size, valid_threshold), starts);
+    AppendBits(valid, batch_slots, valid_bits, &position);
+    nulls += batch_slots - ::arrow::BitUtil::PopCount(valid);
+    num_elements += ::arrow::BitUtil::PopCount(elements);
+
+    def_levels += batch_size;
+    rep_levels += batch_size;
+    num_levels -= batch_size;
+  }
+  *offsets = num_elements;
+  *num_slots = position;
+  *null_count = nulls;
+}
+
+}  // namespace PARQUET_IMPL_NAMESPACE
+}  // namespace internal
+}  // namespace parquet
@@ -0,0 +1,193 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/bit_util.h"
+#include "parquet/exception.h"
+#include "parquet/level_conversion.h"
+
+namespace parquet {
+namespace internal {
+
+namespace {
+
+// Straightforward implementations to check the vectorized ones against
+
+void NaiveDefRepLevelsToBitmap(const int16_t* def_levels, const int16_t* rep_levels,
+                               int64_t num_levels, LevelInfo level_info,
+                               std::vector<bool>* valid) {
+  for (int64_t i = 0; i < num_levels; ++i) {
+    if (def_levels[i] < level_info.repeated_ancestor_def_level ||
+        (rep_levels != nullptr && rep_levels[i] > level_info.rep_level)) {
+      continue;
+    }
+    valid->push_back(def_levels[i] >= level_info.def_level);
+  }
+}
+
+void NaiveDefRepLevelsToList(const int16_t* def_levels, const int16_t* rep_levels,
+                             int64_t num_levels, LevelInfo level_info,
+                             std::vector<int32_t>* offsets, std::vector<bool>* valid) {
+  int32_t num_elements = 0;
+  for (int64_t i = 0; i < num_levels; ++i) {
+    if (def_levels[i] < level_info.repeated_ancestor_def_level) {
+      continue;
+    }
+    if (rep_levels[i] <= level_info.rep_level) {
+      offsets->push_back(num_elements);
+      valid->push_back(def_levels[i] >= level_info.def_level);
+    }
+    if (rep_levels[i] <= level_info.rep_level + 1 &&
+        def_levels[i] > level_info.def_level) {
+      ++num_elements;
+    }
+  }
+  offsets->push_back(num_elements);
+}
+
+std::vector<int16_t> RandomLevels(int64_t num_levels, int16_t max_level,
+                                  uint32_t seed) {
+  std::default_random_engine rng(seed);
+  std::uniform_int_distribution<int> dist(0, max_level);
+  std::vector<int16_t> levels(num_levels);
+  for (auto& level : levels) {
+    level = static_cast<int16_t>(dist(rng));
+  }
+  return levels;
+}
+
+void CheckBitmap(const std::vector<uint8_t>& bitmap, int64_t offset,
+                 const std::vector<bool>& expected) {
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(::arrow::BitUtil::GetBit(bitmap.data(), offset + i), expected[i])
+        << "at slot " << i;
+  }
+}
+
+void CheckDefRepLevelsToBitmap(const std::vector<int16_t>& def_levels,
+                               const std::vector<int16_t>* rep_levels,
+                               LevelInfo level_info, int64_t valid_bits_offset) {
+  const int64_t num_levels = static_cast<int64_t>(def_levels.size());
+  const int16_t* rep_data = rep_levels ? rep_levels->data() : nullptr;
+  std::vector<bool> expected;
+  NaiveDefRepLevelsToBitmap(def_levels.data(), rep_data, num_levels, level_info,
+                            &expected);
+
+  // Bits before the offset must be preserved
+  std::vector<uint8_t> valid_bits(
+      ::arrow::BitUtil::BytesForBits(valid_bits_offset + num_levels) + 1, 0xFF);
+  int64_t num_slots = -1;
+  int64_t null_count = -1;
+  DefRepLevelsToBitmap(def_levels.data(), rep_data, num_levels, level_info,
+                       valid_bits.data(), valid_bits_offset, &num_slots, &null_count);
+  ASSERT_EQ(num_slots, static_cast<int64_t>(expected.size()));
+  ASSERT_EQ(null_count, std::count(expected.begin(), expected.end(), false));
+  for (int64_t i = 0; i < valid_bits_offset; ++i) {
+    ASSERT_TRUE(::arrow::BitUtil::GetBit(valid_bits.data(), i));
+  }
+  ASSERT_NO_FATAL_FAILURE(CheckBitmap(valid_bits, valid_bits_offset, expected));
+}
+
+}  // namespace
+
+TEST(TestLevelConversion, DefLevelsToBitmapFlat) {
+  LevelInfo level_info;
+  level_info.def_level = 1;
+  for (int64_t num_levels : {0, 1, 7, 63, 64, 65, 200, 1000}) {
+    for (int64_t offset : {0, 3, 8, 13}) {
+      auto def_levels = RandomLevels(num_levels, 1, static_cast<uint32_t>(num_levels));
+      ASSERT_NO_FATAL_FAILURE(
+          CheckDefRepLevelsToBitmap(def_levels, nullptr, level_info, offset));
+    }
+  }
+}
+
+TEST(TestLevelConversion, DefLevelsToBitmapStruct) {
+  // optional group (def_level 1) within an optional group, leaf at level 3
+  LevelInfo level_info;
+  level_info.def_level = 2;
+  auto def_levels = RandomLevels(1000, 3, 42);
+  ASSERT_NO_FATAL_FAILURE(
+      CheckDefRepLevelsToBitmap(def_levels, nullptr, level_info, /*offset=*/5));
+}
+
+TEST(TestLevelConversion, DefRepLevelsToBitmapNested) {
+  // A struct within a list within a list
+  LevelInfo level_info;
+  level_info.def_level = 5;
+  level_info.rep_level = 2;
+  level_info.repeated_ancestor_def_level = 4;
+  auto def_levels = RandomLevels(1000, 6, 1);
+  auto rep_levels = RandomLevels(1000, 3, 2);
+  ASSERT_NO_FATAL_FAILURE(
+      CheckDefRepLevelsToBitmap(def_levels, &rep_levels, level_info, /*offset=*/0));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckDefRepLevelsToBitmap(def_levels, &rep_levels, level_info, /*offset=*/11));
+}
+
+TEST(TestLevelConversion, DefRepLevelsToList) {
+  for (int16_t rep_level : {0, 1}) {
+    // A list at definition level 2 within a list
+    LevelInfo level_info;
+    level_info.def_level = 2 + rep_level;
+    level_info.rep_level = rep_level;
+    level_info.repeated_ancestor_def_level = rep_level ? 1 : 0;
+    for (int64_t num_levels : {0, 1, 64, 100, 1000}) {
+      auto def_levels = RandomLevels(num_levels, 5, 3);
+      auto rep_levels = RandomLevels(num_levels, 3, 4);
+
+      std::vector<int32_t> expected_offsets;
+      std::vector<bool> expected_valid;
+      NaiveDefRepLevelsToList(def_levels.data(), rep_levels.data(), num_levels,
+                              level_info, &expected_offsets, &expected_valid);
+
+      std::vector<int32_t> offsets(num_levels + 1, -1);
+      std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(num_levels) + 1);
+      int64_t num_slots = -1;
+      int64_t null_count = -1;
+      DefRepLevelsToList(def_levels.data(), rep_levels.data(), num_levels, level_info,
+                         offsets.data(), valid_bits.data(), &num_slots, &null_count);
+      ASSERT_EQ(num_slots, static_cast<int64_t>(expected_valid.size()));
+      ASSERT_EQ(null_count,
+                std::count(expected_valid.begin(), expected_valid.end(), false));
+      offsets.resize(num_slots + 1);
+      ASSERT_EQ(offsets, expected_offsets);
+      ASSERT_NO_FATAL_FAILURE(CheckBitmap(valid_bits, 0, expected_valid));
+    }
+  }
+}
+
+TEST(TestLevelConversion, DefinitionLevelsToBitmapExceedsMaximum) {
+  std::vector<int16_t> def_levels(100, 1);
+  def_levels[70] = 2;
+  std::vector<uint8_t> valid_bits(13);
+  int64_t values_read = 0;
+  int64_t null_count = 0;
+  ASSERT_THROW(DefinitionLevelsToBitmap(def_levels.data(), 100, /*max_def_level=*/1,
+                                        /*max_rep_level=*/0, &values_read, &null_count,
+                                        valid_bits.data(), 0),
+               ParquetException);
+}
+
+}  // namespace internal
+}  // namespace parquet
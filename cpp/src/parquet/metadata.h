@@ -264,6 +264,10 @@ class PARQUET_EXPORT FileMetaData {
   // Merge row-group metadata from "other" FileMetaData object
   void AppendRowGroups(const FileMetaData& other);
 
+  /// \brief Return a FileMetaData containing a subset of the row groups in this
+  /// FileMetaData.
+  std::shared_ptr<FileMetaData> Subset(const std::vector<int>& row_groups) const;
+
  private:
   friend FileMetaDataBuilder;
   friend class SerializedFile;
@@ -212,6 +212,18 @@ TEST(Metadata, TestBuildAccess) {
   ASSERT_EQ(ParquetVersion::PARQUET_2_0, f_accessor->version());
   ASSERT_EQ(DEFAULT_CREATED_BY, f_accessor->created_by());
   ASSERT_EQ(3, f_accessor->num_schema_elements());
+
+  // Test Subset
+  auto f_accessor_1 = f_accessor->Subset({2, 3});
+  ASSERT_EQ(2, f_accessor_1->num_row_groups());
+  ASSERT_EQ(nrows, f_accessor_1->num_rows());
+  ASSERT_EQ(f_accessor_2->SerializeToString(), f_accessor_1->SerializeToString());
+  f_accessor_1 = f_accessor_2->Subset({0});
+  f_accessor_1->AppendRowGroups(*f_accessor->Subset({0}));
+  ASSERT_EQ(f_accessor->Subset({2, 0})->SerializeToString(),
+            f_accessor_1->SerializeToString());
+  ASSERT_THROW(f_accessor->Subset({4}), ParquetException);
+  ASSERT_THROW(f_accessor->Subset({0, -1}), ParquetException);
 }
 
 TEST(Metadata, TestV1Version) {
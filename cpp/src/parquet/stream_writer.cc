@@ -17,6 +17,7 @@
 
 #include "parquet/stream_writer.h"
 
+#include <algorithm>
 #include <utility>
 
 namespace parquet {
@@ -37,6 +38,9 @@ StreamWriter::FixedStringView::FixedStringView(const char* data_ptr, std::size_t
 StreamWriter::StreamWriter(std::unique_ptr<ParquetFileWriter> writer)
     : file_writer_{std::move(writer)},
       row_group_writer_{file_writer_->AppendBufferedRowGroup()} {
+  if (file_writer_->properties()->max_row_group_bytes() > 0) {
+    max_row_group_size_ = file_writer_->properties()->max_row_group_bytes();
+  }
   auto schema = file_writer_->schema();
   auto group_node = schema->group_node();
 
@@ -53,6 +57,7 @@ void StreamWriter::SetDefaultMaxRowGroupSize(int64_t max_size) {
 
 void StreamWriter::SetMaxRowGroupSize(int64_t max_size) {
   max_row_group_size_ = max_size;
+  next_size_check_rows_ = 0;
 }
 
 int StreamWriter::num_columns() const { return static_cast<int>(nodes_.size()); }
@@ -156,9 +161,6 @@ StreamWriter& StreamWriter::WriteVariableLength(const char* data_ptr,
   } else {
     writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
   }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->EstimatedBufferedValueBytes();
-  }
   return *this;
 }
 
@@ -177,9 +179,6 @@ StreamWriter& StreamWriter::WriteFixedLength(const char* data_ptr, std::size_t d
   } else {
     writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
   }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->EstimatedBufferedValueBytes();
-  }
   return *this;
 }
 
@@ -287,17 +286,26 @@ void StreamWriter::EndRow() {
   }
   column_index_ = 0;
   ++current_row_;
+  ++row_group_rows_;
 
-  if (max_row_group_size_ > 0) {
-    if (row_group_size_ > max_row_group_size_) {
-      EndRowGroup();
-    }
-    // Initialize for each row with size already written
-    // (compressed + uncompressed).
-    //
-    row_group_size_ = row_group_writer_->total_bytes_written() +
-                      row_group_writer_->total_compressed_bytes();
+  // Estimating the row group size visits every column writer, so it is not
+  // done after each row
+  if (max_row_group_size_ > 0 && row_group_rows_ >= next_size_check_rows_) {
+    CheckRowGroupSize();
+  }
+}
+
+void StreamWriter::CheckRowGroupSize() {
+  const int64_t estimated_size = row_group_writer_->EstimatedTotalBytes();
+  if (estimated_size > max_row_group_size_) {
+    EndRowGroup();
+    return;
   }
+  // Check again halfway to where the rows so far extrapolate to the limit, so
+  // that the row group ends within a few rows of reaching it
+  const int64_t bytes_per_row = std::max<int64_t>(1, estimated_size / row_group_rows_);
+  const int64_t rows_to_limit = (max_row_group_size_ - estimated_size) / bytes_per_row;
+  next_size_check_rows_ = row_group_rows_ + std::max<int64_t>(1, rows_to_limit / 2);
 }
 
 void StreamWriter::EndRowGroup() {
@@ -309,6 +317,8 @@ void StreamWriter::EndRowGroup() {
     row_group_writer_->Close();
     row_group_writer_.reset(file_writer_->AppendBufferedRowGroup());
   }
+  row_group_rows_ = 0;
+  next_size_check_rows_ = 0;
 }
 
 StreamWriter& operator<<(StreamWriter& os, EndRowType) {
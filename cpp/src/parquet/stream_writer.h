@@ -41,9 +41,13 @@ namespace parquet {
 /// EndRow() function or EndRow output manipulator.
 ///
 /// A maximum row group size can be configured, the default size is
-/// 512MB.  Alternatively the row group size can be set to zero and the
-/// user can create new row groups by calling the EndRowGroup()
-/// function or using the EndRowGroup output manipulator.
+/// 512MB unless WriterProperties::max_row_group_bytes is set.  The size
+/// of the current row group is estimated from the pages and values
+/// buffered by its column writers, at row counts extrapolated toward the
+/// limit from the bytes per row so far.  Alternatively the row
+/// group size can be set to zero and the user can create new row groups
+/// by calling the EndRowGroup() function or using the EndRowGroup output
+/// manipulator.
 ///
 /// Required and optional fields are supported:
 /// - Required fields are written using operator<<(T)
@@ -183,10 +187,6 @@ class PARQUET_EXPORT StreamWriter {
     auto writer = static_cast<WriterType*>(row_group_writer_->column(column_index_++));
 
     writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &v);
-
-    if (max_row_group_size_ > 0) {
-      row_group_size_ += writer->EstimatedBufferedValueBytes();
-    }
     return *this;
   }
 
@@ -204,6 +204,10 @@ class PARQUET_EXPORT StreamWriter {
 
   void WriteNullValue(ColumnWriter* writer);
 
+  /// \brief End the row group if its estimated size exceeds the maximum,
+  /// otherwise choose the row count at which to estimate it again.
+  void CheckRowGroupSize();
+
  private:
   using node_ptr_type = std::shared_ptr<schema::PrimitiveNode>;
 
@@ -213,7 +217,8 @@ class PARQUET_EXPORT StreamWriter {
 
   int32_t column_index_{0};
   int64_t current_row_{0};
-  int64_t row_group_size_{0};
+  int64_t row_group_rows_{0};
+  int64_t next_size_check_rows_{0};
   int64_t max_row_group_size_{default_row_group_size_};
 
   std::unique_ptr<ParquetFileWriter> file_writer_;
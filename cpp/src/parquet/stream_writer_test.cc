@@ -25,6 +25,7 @@
 
 #include "arrow/io/api.h"
 #include "parquet/exception.h"
+#include "parquet/file_reader.h"
 
 namespace parquet {
 namespace test {
@@ -286,6 +287,38 @@ TEST_F(TestStreamWriter, EndRowGroup) {
   EXPECT_NO_THROW(writer_ << EndRowGroup);
 }
 
+TEST_F(TestStreamWriter, MaxRowGroupBytes) {
+  const int64_t max_row_group_bytes = 64 * 1024;
+  auto properties = WriterProperties::Builder()
+                        .disable_dictionary()
+                        ->max_row_group_bytes(max_row_group_bytes)
+                        ->build();
+  PARQUET_ASSIGN_OR_THROW(auto sink, arrow::io::BufferOutputStream::Create());
+  writer_ = StreamWriter{ParquetFileWriter::Open(sink, GetSchema(), properties)};
+
+  const int num_rows = 20000;
+  for (int i = 0; i < num_rows; ++i) {
+    writer_ << bool(i & 1) << std::to_string(i) << char(i % 26 + 'A')
+            << std::array<char, 4>{'A', 'B', 'C', 'D'} << int8_t(i & 0x7f)
+            << uint16_t(7 * i) << int32_t(i) << uint64_t(i) << float(i) << double(i)
+            << EndRow;
+  }
+  writer_ = StreamWriter{};
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  auto reader =
+      ParquetFileReader::Open(std::make_shared<arrow::io::BufferReader>(buffer));
+  auto metadata = reader->metadata();
+  ASSERT_GT(metadata->num_row_groups(), 4);
+  int64_t rows_read = 0;
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    rows_read += metadata->RowGroup(i)->num_rows();
+    // Row groups are ended after the first row reaching the limit
+    EXPECT_LT(metadata->RowGroup(i)->total_byte_size(), max_row_group_bytes * 5 / 4);
+  }
+  EXPECT_EQ(num_rows, rows_read);
+}
+
 TEST_F(TestStreamWriter, SkipColumns) {
   EXPECT_EQ(0, writer_.SkipColumns(0));
   EXPECT_THROW(writer_.SkipColumns(2), ParquetException);
@@ -192,12 +192,33 @@ class MockPageReader : public PageReader {
     return pages_[page_index_++];
   }
 
+  int64_t SkipDataPages(int64_t max_values) override {
+    int64_t values_skipped = 0;
+    while (page_index_ < static_cast<int>(pages_.size())) {
+      const Page& page = *pages_[page_index_];
+      if (page.type() != PageType::DATA_PAGE && page.type() != PageType::DATA_PAGE_V2) {
+        break;
+      }
+      const int64_t num_values = static_cast<const DataPage&>(page).num_values();
+      if (values_skipped + num_values > max_values) {
+        break;
+      }
+      values_skipped += num_values;
+      ++page_index_;
+      ++num_skipped_pages_;
+    }
+    return values_skipped;
+  }
+
   // No-op
   void set_max_page_header_size(uint32_t size) override {}
 
+  int num_skipped_pages() const { return num_skipped_pages_; }
+
  private:
   std::vector<std::shared_ptr<Page>> pages_;
   int page_index_;
+  int num_skipped_pages_ = 0;
 };
 
 // TODO(wesm): this is only used for testing for now. Refactor to form part of